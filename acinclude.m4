@@ -6,6 +6,15 @@ dnl Function to detect if libexe dependencies are available
 AC_DEFUN([AX_LIBEXE_CHECK_LOCAL],
   [dnl Check for internationalization functions in libexe/libexe_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers included in libexe/libexe_memory_map.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  dnl Check for memory mapping functions in libexe/libexe_memory_map.c
+  AC_CHECK_FUNCS([close fstat mmap munmap open])
+
+  dnl Check for memory access advice functions in libexe/libexe_memory_map.c
+  AC_CHECK_FUNCS([posix_madvise sysconf])
   ])
 
 dnl Function to check if DLL support is needed
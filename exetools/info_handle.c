@@ -393,7 +393,7 @@ int info_handle_file_fprint(
 		 "%s: unable to retrieve number of sections.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	fprintf(
 	 info_handle->notify_stream,
@@ -421,7 +421,7 @@ int info_handle_file_fprint(
 			 "Section: %d\n",
 			 section_index );
 
-			if( libexe_file_get_section_by_index(
+			if( libexe_file_borrow_section_by_index(
 			     info_handle->input_file,
 			     section_index,
 			     &section,
@@ -435,7 +435,7 @@ int info_handle_file_fprint(
 				 function,
 				 section_index );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( libexe_section_get_name(
 			     section,
@@ -451,7 +451,7 @@ int info_handle_file_fprint(
 				 function,
 				 section_index );
 
-				goto on_error;
+				return( -1 );
 			}
 			fprintf(
 			 info_handle->notify_stream,
@@ -471,7 +471,7 @@ int info_handle_file_fprint(
 				 function,
 				 section_index );
 
-				goto on_error;
+				return( -1 );
 			}
 			fprintf(
 			 info_handle->notify_stream,
@@ -491,7 +491,7 @@ int info_handle_file_fprint(
 				 function,
 				 section_index );
 
-				goto on_error;
+				return( -1 );
 			}
 			fprintf(
 			 info_handle->notify_stream,
@@ -511,40 +511,18 @@ int info_handle_file_fprint(
 				 function,
 				 section_index );
 
-				goto on_error;
+				return( -1 );
 			}
 			fprintf(
 			 info_handle->notify_stream,
 			 "\tVirtual address\t\t: 0x%08" PRIx32 "\n",
 			 virtual_address );
 
-			if( libexe_section_free(
-			     &section,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free section.",
-				 function );
-
-				goto on_error;
-			}
 			fprintf(
 			 info_handle->notify_stream,
 			 "\n" );
 		}
 	}
 	return( 1 );
-
-on_error:
-	if( section != NULL )
-	{
-		libexe_section_free(
-		 &section,
-		 NULL );
-	}
-	return( -1 );
 }
 
@@ -0,0 +1,98 @@
+/*
+ * The export table definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_EXPORT_TABLE_H )
+#define _EXE_EXPORT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_export_table_header exe_export_table_header_t;
+
+struct exe_export_table_header
+{
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The creation time
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t creation_time[ 4 ];
+
+	/* The major version
+	 * Consists of 2 bytes
+	 */
+	uint8_t major_version[ 2 ];
+
+	/* The minor version
+	 * Consists of 2 bytes
+	 */
+	uint8_t minor_version[ 2 ];
+
+	/* The name relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_rva[ 4 ];
+
+	/* The ordinal base
+	 * Consists of 4 bytes
+	 */
+	uint8_t ordinal_base[ 4 ];
+
+	/* The number of export address table entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_export_address_table_entries[ 4 ];
+
+	/* The number of name pointer table entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_name_pointer_table_entries[ 4 ];
+
+	/* The export address table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t export_address_table_rva[ 4 ];
+
+	/* The name pointer table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_pointer_table_rva[ 4 ];
+
+	/* The ordinal table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t ordinal_table_rva[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXE_EXPORT_TABLE_H ) */
+
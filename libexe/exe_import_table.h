@@ -0,0 +1,118 @@
+/*
+ * The import table definition of an executable (EXE) file
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXE_IMPORT_TABLE_H )
+#define _EXE_IMPORT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct exe_import_descriptor exe_import_descriptor_t;
+
+struct exe_import_descriptor
+{
+	/* The import name table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 * Also referred to as the import lookup table or original first thunk
+	 */
+	uint8_t import_name_table_rva[ 4 ];
+
+	/* The creation time
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t creation_time[ 4 ];
+
+	/* The forwarder chain
+	 * Consists of 4 bytes
+	 */
+	uint8_t forwarder_chain[ 4 ];
+
+	/* The name relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_rva[ 4 ];
+
+	/* The import address table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 * Also referred to as the first thunk
+	 */
+	uint8_t import_address_table_rva[ 4 ];
+};
+
+typedef struct exe_delay_import_descriptor exe_delay_import_descriptor_t;
+
+struct exe_delay_import_descriptor
+{
+	/* The attributes
+	 * Consists of 4 bytes
+	 * Bit 0 is set if the descriptor contains relative virtual addresses (RVAs)
+	 * instead of virtual addresses
+	 */
+	uint8_t attributes[ 4 ];
+
+	/* The name relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_rva[ 4 ];
+
+	/* The module handle relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t module_handle_rva[ 4 ];
+
+	/* The import address table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t import_address_table_rva[ 4 ];
+
+	/* The import name table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t import_name_table_rva[ 4 ];
+
+	/* The bound import address table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t bound_import_address_table_rva[ 4 ];
+
+	/* The unload import address table relative virtual address (RVA)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unload_import_address_table_rva[ 4 ];
+
+	/* The time stamp
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp of the bound module
+	 */
+	uint8_t time_stamp[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXE_IMPORT_TABLE_H ) */
+
@@ -0,0 +1,445 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_arena.h"
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+
+/* The size of the block header rounded up to the alignment so that the block data is aligned
+ */
+#define LIBEXE_ARENA_BLOCK_HEADER_SIZE \
+	( ( ( sizeof( libexe_arena_block_t ) + LIBEXE_ARENA_ALIGNMENT - 1 ) / LIBEXE_ARENA_ALIGNMENT ) * LIBEXE_ARENA_ALIGNMENT )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_initialize(
+     libexe_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) LIBEXE_MAXIMUM_ARENA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libexe_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libexe_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+	/* Round the block size up to the alignment
+	 */
+	( *arena )->block_size = ( ( block_size + LIBEXE_ARENA_ALIGNMENT - 1 ) / LIBEXE_ARENA_ALIGNMENT ) * LIBEXE_ARENA_ALIGNMENT;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All the memory allocated from the arena is released
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_free(
+     libexe_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libexe_arena_block_t *arena_block = NULL;
+	libexe_arena_block_t *next_block  = NULL;
+	static char *function             = "libexe_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		arena_block = ( *arena )->first_block;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All the memory allocated from the arena is released in one go. The first block
+ * is retained so that an arena that is reused does not allocate it again, other
+ * blocks are freed so that the memory footprint does not keep growing
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_reset(
+     libexe_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libexe_arena_block_t *arena_block = NULL;
+	libexe_arena_block_t *next_block  = NULL;
+	static char *function             = "libexe_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena->first_block != NULL )
+	{
+		arena_block = arena->first_block->next_block;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		arena->first_block->next_block  = NULL;
+		arena->first_block->data_offset = 0;
+
+		arena->allocated_size = LIBEXE_ARENA_BLOCK_HEADER_SIZE + arena->first_block->data_size;
+	}
+	arena->current_block = arena->first_block;
+
+	return( 1 );
+}
+
+/* Allocates a new block in the arena and makes it the current block
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_allocate_block(
+     libexe_arena_t *arena,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libexe_arena_block_t *arena_block = NULL;
+	static char *function             = "libexe_arena_allocate_block";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBEXE_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block = (libexe_arena_block_t *) memory_allocate(
+	                                        LIBEXE_ARENA_BLOCK_HEADER_SIZE + data_size );
+
+	if( arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena block.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block->next_block  = NULL;
+	arena_block->data_size   = data_size;
+	arena_block->data_offset = 0;
+
+	if( arena->current_block == NULL )
+	{
+		arena->first_block = arena_block;
+	}
+	else
+	{
+		arena->current_block->next_block = arena_block;
+	}
+	arena->current_block   = arena_block;
+	arena->allocated_size += LIBEXE_ARENA_BLOCK_HEADER_SIZE + data_size;
+
+	return( 1 );
+}
+
+/* Allocates memory from the arena
+ * The memory is aligned to LIBEXE_ARENA_ALIGNMENT and is not cleared. It cannot be
+ * freed individually but is released when the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_allocate(
+     libexe_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_arena_allocate";
+	size_t aligned_size   = 0;
+	size_t block_size     = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBEXE_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( ( size + LIBEXE_ARENA_ALIGNMENT - 1 ) / LIBEXE_ARENA_ALIGNMENT ) * LIBEXE_ARENA_ALIGNMENT;
+
+	if( ( arena->current_block == NULL )
+	 || ( aligned_size > ( arena->current_block->data_size - arena->current_block->data_offset ) ) )
+	{
+		/* An allocation that does not fit in a regular block gets a block of its own
+		 */
+		block_size = arena->block_size;
+
+		if( aligned_size > block_size )
+		{
+			block_size = aligned_size;
+		}
+		if( libexe_arena_allocate_block(
+		     arena,
+		     block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate arena block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*data = (void *) &( ( (uint8_t *) arena->current_block )[ LIBEXE_ARENA_BLOCK_HEADER_SIZE + arena->current_block->data_offset ] );
+
+	arena->current_block->data_offset += aligned_size;
+
+	return( 1 );
+}
+
+/* Retrieves the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_get_block_size(
+     libexe_arena_t *arena,
+     size_t *block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_arena_get_block_size";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = arena->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes allocated for the blocks of the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_arena_get_allocated_size(
+     libexe_arena_t *arena,
+     size_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_arena_get_allocated_size";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = arena->allocated_size;
+
+	return( 1 );
+}
+
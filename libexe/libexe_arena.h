@@ -0,0 +1,111 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_ARENA_H )
+#define _LIBEXE_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_arena_block libexe_arena_block_t;
+
+struct libexe_arena_block
+{
+	/* The next block
+	 */
+	libexe_arena_block_t *next_block;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the unused data
+	 */
+	size_t data_offset;
+};
+
+typedef struct libexe_arena libexe_arena_t;
+
+struct libexe_arena
+{
+	/* The first block, which is retained when the arena is reset
+	 */
+	libexe_arena_block_t *first_block;
+
+	/* The block allocations are currently made from
+	 */
+	libexe_arena_block_t *current_block;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of bytes allocated for the blocks
+	 */
+	size_t allocated_size;
+};
+
+int libexe_arena_initialize(
+     libexe_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libexe_arena_free(
+     libexe_arena_t **arena,
+     libcerror_error_t **error );
+
+int libexe_arena_reset(
+     libexe_arena_t *arena,
+     libcerror_error_t **error );
+
+int libexe_arena_allocate_block(
+     libexe_arena_t *arena,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_arena_allocate(
+     libexe_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error );
+
+int libexe_arena_get_block_size(
+     libexe_arena_t *arena,
+     size_t *block_size,
+     libcerror_error_t **error );
+
+int libexe_arena_get_allocated_size(
+     libexe_arena_t *arena,
+     size_t *allocated_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_ARENA_H ) */
+
@@ -0,0 +1,1225 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libexe_batch.h"
+#include "libexe_batch_entry.h"
+#include "libexe_definitions.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_libcthreads.h"
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * The files of the batch are opened with at most number_of_threads threads
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_initialize(
+     libexe_batch_t **batch,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEXE_MAXIMUM_BATCH_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = memory_allocate_structure(
+	                  libexe_internal_batch_t );
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch,
+	     0,
+	     sizeof( libexe_internal_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		memory_free(
+		 internal_batch );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_batch->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_batch->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_batch->failed_opens_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize failed opens mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_batch->number_of_threads            = number_of_threads;
+	internal_batch->maximum_number_of_open_files = LIBEXE_MAXIMUM_BATCH_NUMBER_OF_OPEN_FILES;
+
+	*batch = (libexe_batch_t *) internal_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch != NULL )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( internal_batch->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_batch->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_batch->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_batch->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * The files opened by the batch are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_free(
+     libexe_batch_t **batch,
+     libcerror_error_t **error )
+{
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_free";
+	int result                              = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		internal_batch = (libexe_internal_batch_t *) *batch;
+		*batch         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_batch->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_batch_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_batch->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_batch->failed_opens_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free failed opens mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_batch );
+	}
+	return( result );
+}
+
+/* Appends a filename to the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_append_filename(
+     libexe_batch_t *batch,
+     const char *filename,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry       = NULL;
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_append_filename";
+	size_t filename_length                  = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libexe_batch_entry_initialize(
+	     &batch_entry,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libexe_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_append_entry(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t *) batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry to array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_batch->read_write_lock,
+	 NULL );
+#endif
+	if( batch_entry != NULL )
+	{
+		libexe_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the files of the batch that were not opened before
+ * The files are opened concurrently by a pool of threads. A file that cannot
+ * be opened does not fail the batch, use libexe_batch_get_file to determine
+ * which files were opened and libexe_batch_get_open_error why not
+ *
+ * The number of files that are open at the same time is limited. When the limit
+ * is reached the remaining files are not opened until the open files are closed
+ * using libexe_batch_close_files
+ *
+ * Returns 1 if all files were processed, 0 if the maximum number of open files
+ * was reached or -1 on error
+ */
+int libexe_batch_open(
+     libexe_batch_t *batch,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry       = NULL;
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_open";
+	int entry_index                         = 0;
+	int first_entry_index                   = 0;
+	int number_of_entries                   = 0;
+	int number_of_open_files                = 0;
+	int open_result                         = 0;
+	int result                              = 1;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool  = NULL;
+	int maximum_number_of_queued_entries    = 0;
+	int number_of_threads                   = 0;
+#endif
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_batch->access_flags = access_flags;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	number_of_threads = internal_batch->number_of_threads;
+
+	if( number_of_threads > number_of_entries )
+	{
+		number_of_threads = number_of_entries;
+	}
+	maximum_number_of_queued_entries = number_of_entries;
+
+	if( maximum_number_of_queued_entries > LIBEXE_MAXIMUM_BATCH_NUMBER_OF_QUEUED_ENTRIES )
+	{
+		maximum_number_of_queued_entries = LIBEXE_MAXIMUM_BATCH_NUMBER_OF_QUEUED_ENTRIES;
+	}
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_queued_entries,
+		     (int (*)(intptr_t *, void *)) &libexe_batch_open_entry_callback,
+		     (void *) internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* The entries before the next entry index were processed before
+	 */
+	first_entry_index    = internal_batch->next_entry_index;
+	number_of_open_files = internal_batch->number_of_open_files;
+
+	internal_batch->number_of_failed_opens = 0;
+
+	for( entry_index = first_entry_index;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve batch entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( batch_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing batch entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( batch_entry->is_processed != 0 )
+		{
+			continue;
+		}
+		/* Every queued entry is counted as an open file until it is known
+		 * that its file could not be opened
+		 */
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( ( thread_pool != NULL )
+		 && ( number_of_open_files >= internal_batch->maximum_number_of_open_files ) )
+		{
+			if( libcthreads_mutex_grab(
+			     internal_batch->failed_opens_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab failed opens mutex.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_open_files -= internal_batch->number_of_failed_opens;
+
+			internal_batch->number_of_failed_opens = 0;
+
+			if( libcthreads_mutex_release(
+			     internal_batch->failed_opens_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release failed opens mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		if( number_of_open_files >= internal_batch->maximum_number_of_open_files )
+		{
+			result = 0;
+
+			break;
+		}
+		number_of_open_files++;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			/* The push blocks while the queue of the thread pool is full
+			 */
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push batch entry: %d onto thread pool.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		open_result = libexe_batch_entry_open(
+		               batch_entry,
+		               access_flags,
+		               error );
+
+		if( open_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open batch entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( open_result == 0 )
+		{
+			number_of_open_files--;
+		}
+	}
+	internal_batch->next_entry_index = entry_index;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Files that could not be opened do not count as open files
+	 */
+	for( entry_index = first_entry_index;
+	     entry_index < internal_batch->next_entry_index;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve batch entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( batch_entry != NULL )
+		 && ( batch_entry->file != NULL ) )
+		{
+			internal_batch->number_of_open_files += 1;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	libcthreads_read_write_lock_release_for_write(
+	 internal_batch->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Opens the file of a batch entry
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_open_entry_callback(
+     libexe_batch_entry_t *batch_entry,
+     libexe_internal_batch_t *internal_batch )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libexe_batch_open_entry_callback";
+	int result               = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_batch_entry_open(
+	          batch_entry,
+	          internal_batch->access_flags,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open batch entry.",
+		 function );
+	}
+	if( result != 1 )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		/* The file does not count as an open file
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_batch->failed_opens_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab failed opens mutex.",
+			 function );
+
+			goto on_error;
+		}
+		internal_batch->number_of_failed_opens += 1;
+
+		if( libcthreads_mutex_release(
+		     internal_batch->failed_opens_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release failed opens mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_get_number_of_entries(
+     libexe_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_get_number_of_entries";
+	int result                              = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file of a specific entry
+ * The file is owned by the batch and remains valid until the files of the batch
+ * are closed or the batch is freed
+ * Returns 1 if successful, 0 if the file is not open or -1 on error
+ */
+int libexe_batch_get_file(
+     libexe_batch_t *batch,
+     int entry_index,
+     libexe_file_t **file,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry       = NULL;
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_get_file";
+	int result                              = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve batch entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing batch entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( batch_entry->file != NULL )
+	{
+		*file  = batch_entry->file;
+		result = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the open error of a specific entry
+ * The open error is owned by the batch and remains valid until the batch is freed
+ * Returns 1 if successful, 0 if the file was opened or not processed or -1 on error
+ */
+int libexe_batch_get_open_error(
+     libexe_batch_t *batch,
+     int entry_index,
+     libcerror_error_t **open_error,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry       = NULL;
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_get_open_error";
+	int result                              = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+	if( open_error == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open error.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_batch->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve batch entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing batch entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else if( batch_entry->open_error != NULL )
+	{
+		*open_error = batch_entry->open_error;
+		result      = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes the files of the batch that are open
+ * The entries remain processed and are not opened again by libexe_batch_open
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_close_files(
+     libexe_batch_t *batch,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry       = NULL;
+	libexe_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "libexe_batch_close_files";
+	int entry_index                         = 0;
+	int result                              = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (libexe_internal_batch_t *) batch;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Only the entries that were processed after the previous close can have an open file
+	 */
+	for( entry_index = internal_batch->first_open_entry_index;
+	     entry_index < internal_batch->next_entry_index;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve batch entry: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+
+			break;
+		}
+		if( libexe_batch_entry_close(
+		     batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close batch entry: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_batch->first_open_entry_index = internal_batch->next_entry_index;
+		internal_batch->number_of_open_files   = 0;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_batch->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,145 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_INTERNAL_BATCH_H )
+#define _LIBEXE_INTERNAL_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_batch_entry.h"
+#include "libexe_extern.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_internal_batch libexe_internal_batch_t;
+
+struct libexe_internal_batch
+{
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The number of threads used to open the files
+	 */
+	int number_of_threads;
+
+	/* The access flags used to open the files
+	 */
+	int access_flags;
+
+	/* The maximum number of files that are open at the same time
+	 */
+	int maximum_number_of_open_files;
+
+	/* The number of files that are open
+	 */
+	int number_of_open_files;
+
+	/* The index of the first entry that can have an open file
+	 */
+	int first_open_entry_index;
+
+	/* The index of the first entry that was not processed
+	 */
+	int next_entry_index;
+
+	/* The number of queued files that could not be opened, which no longer
+	 * count against the maximum number of open files
+	 */
+	int number_of_failed_opens;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the number of failed opens
+	 */
+	libcthreads_mutex_t *failed_opens_mutex;
+
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBEXE_EXTERN \
+int libexe_batch_initialize(
+     libexe_batch_t **batch,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_free(
+     libexe_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_append_filename(
+     libexe_batch_t *batch,
+     const char *filename,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_open(
+     libexe_batch_t *batch,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libexe_batch_open_entry_callback(
+     libexe_batch_entry_t *batch_entry,
+     libexe_internal_batch_t *internal_batch );
+
+LIBEXE_EXTERN \
+int libexe_batch_get_number_of_entries(
+     libexe_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_get_file(
+     libexe_batch_t *batch,
+     int entry_index,
+     libexe_file_t **file,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_get_open_error(
+     libexe_batch_t *batch,
+     int entry_index,
+     libcerror_error_t **open_error,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_batch_close_files(
+     libexe_batch_t *batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_INTERNAL_BATCH_H ) */
+
@@ -0,0 +1,350 @@
+/*
+ * Batch entry functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libexe_batch_entry.h"
+#include "libexe_file.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+
+/* Creates a batch entry
+ * Make sure the value batch_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_entry_initialize(
+     libexe_batch_entry_t **batch_entry,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_entry_initialize";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_entry = memory_allocate_structure(
+	                libexe_batch_entry_t );
+
+	if( *batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_entry,
+	     0,
+	     sizeof( libexe_batch_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch entry.",
+		 function );
+
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+
+		return( -1 );
+	}
+	( *batch_entry )->filename = narrow_string_allocate(
+	                              filename_length + 1 );
+
+	if( ( *batch_entry )->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     ( *batch_entry )->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_entry )->filename[ filename_length ] = 0;
+
+	( *batch_entry )->filename_size = filename_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( *batch_entry != NULL )
+	{
+		if( ( *batch_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename );
+		}
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_entry_free(
+     libexe_batch_entry_t **batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_entry_free";
+	int result            = 1;
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		if( ( *batch_entry )->file != NULL )
+		{
+			if( libexe_file_free(
+			     &( ( *batch_entry )->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *batch_entry )->open_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *batch_entry )->open_error ) );
+		}
+		if( ( *batch_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename );
+		}
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( result );
+}
+
+/* Opens the file of a batch entry
+ * The reason the file could not be opened is stored in the batch entry
+ * Returns 1 if successful, 0 if the file could not be opened or -1 on error
+ */
+int libexe_batch_entry_open(
+     libexe_batch_entry_t *batch_entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error = NULL;
+	libexe_file_t *file           = NULL;
+	static char *function         = "libexe_batch_entry_open";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->is_processed = 1;
+
+	/* A file that cannot be opened does not fail the batch
+	 */
+	if( libexe_file_open(
+	     file,
+	     batch_entry->filename,
+	     access_flags,
+	     &open_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open file: %s.\n",
+			 function,
+			 batch_entry->filename );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		batch_entry->open_error = open_error;
+
+		libexe_file_free(
+		 &file,
+		 NULL );
+
+		return( 0 );
+	}
+	batch_entry->file = file;
+
+	return( 1 );
+}
+
+/* Closes the file of a batch entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_batch_entry_close(
+     libexe_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_batch_entry_close";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->file != NULL )
+	{
+		if( libexe_file_free(
+		     &( batch_entry->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
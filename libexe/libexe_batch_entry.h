@@ -0,0 +1,84 @@
+/*
+ * Batch entry functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_BATCH_ENTRY_H )
+#define _LIBEXE_BATCH_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_batch_entry libexe_batch_entry_t;
+
+struct libexe_batch_entry
+{
+	/* The filename
+	 */
+	char *filename;
+
+	/* The filename size
+	 */
+	size_t filename_size;
+
+	/* The file, set when the file was opened
+	 */
+	libexe_file_t *file;
+
+	/* The open error, set when the file could not be opened
+	 */
+	libcerror_error_t *open_error;
+
+	/* Value to indicate if the entry was processed
+	 */
+	uint8_t is_processed;
+};
+
+int libexe_batch_entry_initialize(
+     libexe_batch_entry_t **batch_entry,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libexe_batch_entry_free(
+     libexe_batch_entry_t **batch_entry,
+     libcerror_error_t **error );
+
+int libexe_batch_entry_open(
+     libexe_batch_entry_t *batch_entry,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libexe_batch_entry_close(
+     libexe_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_BATCH_ENTRY_H ) */
+
@@ -0,0 +1,997 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_block_cache.h"
+#include "libexe_data_block.h"
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_libfcache.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * A cache size of 0 disables block caching
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_initialize(
+     libexe_block_cache_t **block_cache,
+     size64_t cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_initialize";
+	int number_of_blocks  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size > (size64_t) LIBEXE_MAXIMUM_BLOCK_CACHE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libexe_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libexe_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	number_of_blocks = (int) ( cache_size / LIBEXE_BLOCK_CACHE_BLOCK_SIZE );
+
+	if( number_of_blocks > 0 )
+	{
+		if( libfcache_cache_initialize(
+		     &( ( *block_cache )->cache ),
+		     number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_date_time_get_timestamp(
+	     &( ( *block_cache )->cache_timestamp ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_cache )->cache_size = cache_size;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *block_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *block_cache )->cache ),
+			 NULL );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_free(
+     libexe_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_free";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *block_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *block_cache )->cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( ( *block_cache )->cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Clears the block cache
+ * Removes the cached blocks and resets the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_clear(
+     libexe_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_clear";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_cache->cache != NULL )
+	{
+		if( libfcache_cache_empty(
+		     block_cache->cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_date_time_get_timestamp(
+	     &( block_cache->cache_timestamp ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	block_cache->number_of_hits   = 0;
+	block_cache->number_of_misses = 0;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 block_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_get_cache_size(
+     libexe_block_cache_t *block_cache,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_get_cache_size";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*cache_size = block_cache->cache_size;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the cache size
+ * The cache size is rounded down to a multiple of the block size
+ * and a cache size of 0 disables block caching. Cached blocks are discarded.
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_set_cache_size(
+     libexe_block_cache_t *block_cache,
+     size64_t cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_set_cache_size";
+	int number_of_blocks  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size > (size64_t) LIBEXE_MAXIMUM_BLOCK_CACHE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = (int) ( cache_size / LIBEXE_BLOCK_CACHE_BLOCK_SIZE );
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_cache->cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( block_cache->cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	block_cache->cache_size = 0;
+
+	if( number_of_blocks > 0 )
+	{
+		if( libfcache_cache_initialize(
+		     &( block_cache->cache ),
+		     number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	block_cache->cache_size = cache_size;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 block_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_block_cache_get_statistics(
+     libexe_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = block_cache->number_of_hits;
+	*number_of_misses = block_cache->number_of_misses;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads section data at a specific offset into a buffer
+ * The section data is read in blocks of LIBEXE_BLOCK_CACHE_BLOCK_SIZE, relative to
+ * the start of the section, that are identified by the section index and block index.
+ * When block caching is disabled the data is read directly from the file IO handle.
+ * Data blocks that are not cached are read without holding the lock of the block cache.
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libexe_block_cache_read_buffer(
+         libexe_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         int section_index,
+         off64_t data_offset,
+         size64_t data_size,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libexe_data_block_t *data_block      = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libexe_block_cache_read_buffer";
+	size64_t block_data_offset           = 0;
+	size64_t block_data_size             = 0;
+	size_t block_offset                  = 0;
+	size_t buffer_offset                 = 0;
+	size_t data_block_size               = 0;
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	uint64_t block_index                 = 0;
+	int result                           = 0;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	int is_locked                        = 0;
+#endif
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( data_size - (size64_t) offset );
+	}
+	/* The cache is checked without holding the lock, so that positional reads
+	 * are not serialized when block caching is disabled
+	 */
+	if( block_cache->cache == NULL )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              data_offset + offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file IO handle.",
+			 function,
+			 data_offset + offset,
+			 data_offset + offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	block_index  = (uint64_t) offset / LIBEXE_BLOCK_CACHE_BLOCK_SIZE;
+	block_offset = (size_t) ( (uint64_t) offset % LIBEXE_BLOCK_CACHE_BLOCK_SIZE );
+
+	while( buffer_offset < buffer_size )
+	{
+		/* The lock is only held to look up, copy and insert a data block
+		 * and not while the data block is read from the file IO handle
+		 */
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+		is_locked = 1;
+#endif
+		result    = 0;
+
+		if( block_cache->cache != NULL )
+		{
+			result = libfcache_cache_get_value_by_identifier(
+			          block_cache->cache,
+			          section_index,
+			          (off64_t) block_index,
+			          block_cache->cache_timestamp,
+			          &cache_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %" PRIu64 " from cache.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( libfcache_cache_value_get_value(
+				     cache_value,
+				     (intptr_t **) &data_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve data block: %" PRIu64 " from cache value.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+				block_cache->number_of_hits += 1;
+			}
+		}
+		if( result == 0 )
+		{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     block_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+			is_locked = 0;
+#endif
+
+			block_data_offset = block_index * LIBEXE_BLOCK_CACHE_BLOCK_SIZE;
+			block_data_size   = data_size - block_data_offset;
+
+			if( block_data_size > (size64_t) LIBEXE_BLOCK_CACHE_BLOCK_SIZE )
+			{
+				block_data_size = (size64_t) LIBEXE_BLOCK_CACHE_BLOCK_SIZE;
+			}
+			if( libexe_data_block_initialize(
+			     &data_block,
+			     (size_t) block_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create data block: %" PRIu64 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			if( libexe_data_block_read_file_io_handle(
+			     data_block,
+			     file_io_handle,
+			     data_offset + (off64_t) block_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block: %" PRIu64 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		/* A data block is shorter than expected when the end of the file is reached
+		 */
+		data_block_size = data_block->data_size;
+		read_size       = 0;
+
+		if( block_offset < data_block_size )
+		{
+			read_size = data_block_size - block_offset;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( data_block->data[ block_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data block: %" PRIu64 " data.",
+				 function,
+				 block_index );
+
+				if( result != 0 )
+				{
+					data_block = NULL;
+				}
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			/* Insert the data block read without holding the lock, unless block caching
+			 * was disabled in the meantime
+			 */
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     block_cache->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+			is_locked = 1;
+#endif
+
+			if( block_cache->cache != NULL )
+			{
+				if( libfcache_cache_set_value_by_identifier(
+				     block_cache->cache,
+				     section_index,
+				     (off64_t) block_index,
+				     block_cache->cache_timestamp,
+				     (intptr_t *) data_block,
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_data_block_free,
+				     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set data block: %" PRIu64 " in cache.",
+					 function,
+					 block_index );
+
+					goto on_error;
+				}
+				block_cache->number_of_misses += 1;
+			}
+			else if( libexe_data_block_free(
+			          &data_block,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block: %" PRIu64 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		/* The data block is owned by the cache and can be evicted once the lock is released
+		 */
+		data_block = NULL;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+		is_locked = 0;
+#endif
+
+		if( read_size == 0 )
+		{
+			break;
+		}
+		buffer_offset += read_size;
+		block_offset   = 0;
+
+		if( data_block_size < LIBEXE_BLOCK_CACHE_BLOCK_SIZE )
+		{
+			break;
+		}
+		block_index += 1;
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libexe_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( is_locked != 0 )
+	{
+		libcthreads_read_write_lock_release_for_write(
+		 block_cache->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_BLOCK_CACHE_H )
+#define _LIBEXE_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_block_cache libexe_block_cache_t;
+
+struct libexe_block_cache
+{
+	/* The cache, which is NULL when block caching is disabled
+	 */
+	libfcache_cache_t *cache;
+
+	/* The cache size
+	 */
+	size64_t cache_size;
+
+	/* The cache timestamp
+	 */
+	int64_t cache_timestamp;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libexe_block_cache_initialize(
+     libexe_block_cache_t **block_cache,
+     size64_t cache_size,
+     libcerror_error_t **error );
+
+int libexe_block_cache_free(
+     libexe_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libexe_block_cache_clear(
+     libexe_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libexe_block_cache_get_cache_size(
+     libexe_block_cache_t *block_cache,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libexe_block_cache_set_cache_size(
+     libexe_block_cache_t *block_cache,
+     size64_t cache_size,
+     libcerror_error_t **error );
+
+int libexe_block_cache_get_statistics(
+     libexe_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+ssize_t libexe_block_cache_read_buffer(
+         libexe_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         int section_index,
+         off64_t data_offset,
+         size64_t data_size,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_BLOCK_CACHE_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libexe_arena.h"
 #include "libexe_coff_header.h"
 #include "libexe_debug.h"
 #include "libexe_libcerror.h"
@@ -34,10 +35,12 @@
 
 /* Creates a COFF header
  * Make sure the value coff_header is referencing, is set to NULL
+ * The COFF header is allocated from the arena if one is provided
  * Returns 1 if successful or -1 on error
  */
 int libexe_coff_header_initialize(
      libexe_coff_header_t **coff_header,
+     libexe_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libexe_coff_header_initialize";
@@ -64,19 +67,40 @@ int libexe_coff_header_initialize(
 
 		return( -1 );
 	}
-	*coff_header = memory_allocate_structure(
-	                libexe_coff_header_t );
+	if( arena != NULL )
+	{
+		if( libexe_arena_allocate(
+		     arena,
+		     sizeof( libexe_coff_header_t ),
+		     (void **) coff_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create COFF header.",
+			 function );
 
-	if( *coff_header == NULL )
+			goto on_error;
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create COFF header.",
-		 function );
+		*coff_header = memory_allocate_structure(
+		                libexe_coff_header_t );
 
-		goto on_error;
+		if( *coff_header == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create COFF header.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     *coff_header,
@@ -92,14 +116,18 @@ int libexe_coff_header_initialize(
 
 		goto on_error;
 	}
+	( *coff_header )->arena = arena;
+
 	return( 1 );
 
 on_error:
 	if( *coff_header != NULL )
 	{
-		memory_free(
-		 *coff_header );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *coff_header );
+		}
 		*coff_header = NULL;
 	}
 	return( -1 );
@@ -127,9 +155,13 @@ int libexe_coff_header_free(
 	}
 	if( *coff_header != NULL )
 	{
-		memory_free(
-		 *coff_header );
-
+		/* Memory allocated from an arena is released when the arena is reset
+		 */
+		if( ( *coff_header )->arena == NULL )
+		{
+			memory_free(
+			 *coff_header );
+		}
 		*coff_header = NULL;
 	}
 	return( 1 );
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_arena.h"
 #include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
 
@@ -47,10 +48,16 @@ struct libexe_coff_header
 	/* COFF optional header size
 	 */
 	uint16_t optional_header_size;
+
+	/* The arena the COFF header was allocated from, which is NULL
+	 * when it was allocated from the heap
+	 */
+	libexe_arena_t *arena;
 };
 
 int libexe_coff_header_initialize(
      libexe_coff_header_t **coff_header,
+     libexe_arena_t *arena,
      libcerror_error_t **error );
 
 int libexe_coff_header_free(
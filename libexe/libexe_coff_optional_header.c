@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libexe_arena.h"
 #include "libexe_coff_optional_header.h"
 #include "libexe_data_directory_descriptor.h"
 #include "libexe_debug.h"
@@ -35,10 +36,12 @@
 
 /* Creates a COFF optional header
  * Make sure the value coff_optional_header is referencing, is set to NULL
+ * The COFF optional header is allocated from the arena if one is provided
  * Returns 1 if successful or -1 on error
  */
 int libexe_coff_optional_header_initialize(
      libexe_coff_optional_header_t **coff_optional_header,
+     libexe_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libexe_coff_optional_header_initialize";
@@ -65,19 +68,40 @@ int libexe_coff_optional_header_initialize(
 
 		return( -1 );
 	}
-	*coff_optional_header = memory_allocate_structure(
-	                         libexe_coff_optional_header_t );
+	if( arena != NULL )
+	{
+		if( libexe_arena_allocate(
+		     arena,
+		     sizeof( libexe_coff_optional_header_t ),
+		     (void **) coff_optional_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create COFF optional header.",
+			 function );
 
-	if( *coff_optional_header == NULL )
+			goto on_error;
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create COFF optional header.",
-		 function );
+		*coff_optional_header = memory_allocate_structure(
+		                         libexe_coff_optional_header_t );
 
-		goto on_error;
+		if( *coff_optional_header == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create COFF optional header.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     *coff_optional_header,
@@ -93,14 +117,18 @@ int libexe_coff_optional_header_initialize(
 
 		goto on_error;
 	}
+	( *coff_optional_header )->arena = arena;
+
 	return( 1 );
 
 on_error:
 	if( *coff_optional_header != NULL )
 	{
-		memory_free(
-		 *coff_optional_header );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *coff_optional_header );
+		}
 		*coff_optional_header = NULL;
 	}
 	return( -1 );
@@ -128,9 +156,13 @@ int libexe_coff_optional_header_free(
 	}
 	if( *coff_optional_header != NULL )
 	{
-		memory_free(
-		 *coff_optional_header );
-
+		/* Memory allocated from an arena is released when the arena is reset
+		 */
+		if( ( *coff_optional_header )->arena == NULL )
+		{
+			memory_free(
+			 *coff_optional_header );
+		}
 		*coff_optional_header = NULL;
 	}
 	return( 1 );
@@ -292,8 +324,16 @@ int libexe_coff_optional_header_read_data(
 
 		return( -1 );
 	}
+	coff_optional_header->signature = signature;
+
 	data_offset = sizeof( exe_coff_optional_header_t );
 
+	/* The PE32+ optional header does not contain the data base offset
+	 */
+	if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		data_offset -= 4;
+	}
 	if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
 	{
 		if( sizeof( exe_coff_optional_header_pe32_t ) > ( data_size - data_offset ) )
@@ -487,7 +527,7 @@ int libexe_coff_optional_header_read_data(
 
 		data_offset += sizeof( exe_coff_optional_header_pe32_t );
 	}
-	else if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	else if( signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
 	{
 		if( sizeof( exe_coff_optional_header_pe32_plus_t ) > ( data_size - data_offset ) )
 		{
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_arena.h"
 #include "libexe_data_directory_descriptor.h"
 #include "libexe_definitions.h"
 #include "libexe_libbfio.h"
@@ -38,13 +39,23 @@ typedef struct libexe_coff_optional_header libexe_coff_optional_header_t;
 
 struct libexe_coff_optional_header
 {
+	/* The signature
+	 */
+	uint16_t signature;
+
 	/* The data directories
 	 */
         libexe_data_directory_descriptor_t data_directories[ LIBEXE_NUMBER_OF_DATA_DIRECTORIES ];
+
+	/* The arena the COFF optional header was allocated from, which is NULL
+	 * when it was allocated from the heap
+	 */
+	libexe_arena_t *arena;
 };
 
 int libexe_coff_optional_header_initialize(
      libexe_coff_optional_header_t **coff_optional_header,
+     libexe_arena_t *arena,
      libcerror_error_t **error );
 
 int libexe_coff_optional_header_free(
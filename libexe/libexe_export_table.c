@@ -20,14 +20,18 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libexe_export_table.h"
+#include "libexe_libcdata.h"
 #include "libexe_libcerror.h"
 #include "libexe_libcnotify.h"
-#include "libexe_libfcache.h"
-#include "libexe_libfdata.h"
+#include "libexe_rva_index.h"
+#include "libexe_rva_reader.h"
+
+#include "exe_export_table.h"
 
 /* Creates an export table
  * Make sure the value export_table is referencing, is set to NULL
@@ -129,6 +133,26 @@ int libexe_export_table_free(
 	}
 	if( *export_table != NULL )
 	{
+		if( ( *export_table )->string_pool != NULL )
+		{
+			memory_free(
+			 ( *export_table )->string_pool );
+		}
+		if( ( *export_table )->name_offsets != NULL )
+		{
+			memory_free(
+			 ( *export_table )->name_offsets );
+		}
+		if( ( *export_table )->name_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *export_table )->name_entry_indexes );
+		}
+		if( ( *export_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *export_table )->entries );
+		}
 		memory_free(
 		 *export_table );
 
@@ -137,19 +161,42 @@ int libexe_export_table_free(
 	return( 1 );
 }
 
-/* Reads the export table
+/* Reads the export table data
+ * The data contains the export table header at the data offset and is mapped at
+ * the virtual address, the tables and names can be stored anywhere in the data
  * Returns 1 if successful or -1 on error
  */
-int libexe_export_table_read(
+int libexe_export_table_read_data(
      libexe_export_table_t *export_table,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     uint32_t size,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint32_t virtual_address,
      libcerror_error_t **error )
 {
-	uint8_t *data         = NULL;
-	static char *function = "libexe_export_table_read";
-	size_t read_count     = 0;
+	exe_export_table_header_t *export_table_header  = NULL;
+	static char *function                           = "libexe_export_table_read_data";
+	size_t export_address_table_offset              = 0;
+	size_t name_data_offset                         = 0;
+	size_t name_pointer_table_offset                = 0;
+	size_t name_size                                = 0;
+	size_t ordinal_table_offset                     = 0;
+	size_t string_pool_offset                       = 0;
+	uint32_t entry_index                            = 0;
+	uint32_t export_address_table_rva               = 0;
+	uint32_t name_index                             = 0;
+	uint32_t name_pointer_table_rva                 = 0;
+	uint32_t name_rva                               = 0;
+	uint32_t number_of_export_address_table_entries = 0;
+	uint32_t number_of_name_pointer_table_entries   = 0;
+	uint32_t ordinal_table_rva                      = 0;
+	uint16_t name_entry_index                       = 0;
+	int result                                      = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                            = 0;
+	uint16_t value_16bit                            = 0;
+#endif
 
 	if( export_table == NULL )
 	{
@@ -162,87 +209,1089 @@ int libexe_export_table_read(
 
 		return( -1 );
 	}
-	if( ( size == 0 )
-	 || ( size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( ( export_table->entries != NULL )
+	 || ( export_table->name_entry_indexes != NULL )
+	 || ( export_table->name_offsets != NULL )
+	 || ( export_table->string_pool != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export table - values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( exe_export_table_header_t ) )
+	 || ( data_size > (size_t) UINT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid size value out of bounds.",
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	data = (uint8_t *) memory_allocate(
-	                    sizeof( uint8_t ) * size );
-
-	if( data == NULL )
+	if( ( data_offset > data_size )
+	 || ( sizeof( exe_export_table_header_t ) > ( data_size - data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create export table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	export_table_header = (exe_export_table_header_t *) &( data[ data_offset ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->ordinal_base,
+	 export_table->ordinal_base );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->number_of_export_address_table_entries,
+	 number_of_export_address_table_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->number_of_name_pointer_table_entries,
+	 number_of_name_pointer_table_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->export_address_table_rva,
+	 export_address_table_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->name_pointer_table_rva,
+	 name_pointer_table_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 export_table_header->ordinal_table_rva,
+	 ordinal_table_rva );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
+		byte_stream_copy_to_uint32_little_endian(
+		 export_table_header->flags,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 export_table_header->creation_time,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: creation time\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 export_table_header->major_version,
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: major version\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 value_16bit );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 export_table_header->minor_version,
+		 value_16bit );
+		libcnotify_printf(
+		 "%s: minor version\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 value_16bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 export_table_header->name_rva,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: name RVA\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
 		libcnotify_printf(
-		 "%s: reading export table at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 "%s: ordinal base\t\t\t\t: %" PRIu32 "\n",
 		 function,
-		 file_offset,
-		 file_offset );
+		 export_table->ordinal_base );
+
+		libcnotify_printf(
+		 "%s: number of export address table entries\t: %" PRIu32 "\n",
+		 function,
+		 number_of_export_address_table_entries );
+
+		libcnotify_printf(
+		 "%s: number of name pointer table entries\t: %" PRIu32 "\n",
+		 function,
+		 number_of_name_pointer_table_entries );
+
+		libcnotify_printf(
+		 "%s: export address table RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 export_address_table_rva );
+
+		libcnotify_printf(
+		 "%s: name pointer table RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 name_pointer_table_rva );
+
+		libcnotify_printf(
+		 "%s: ordinal table RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 ordinal_table_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* The ordinals and the name ordinal table are 16-bit values
+	 */
+	if( ( number_of_export_address_table_entries > 65536 )
+	 || ( number_of_name_pointer_table_entries > 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* The tables are not necessarily stored in the range of the export table
+	 * data directory but must be stored in the data
+	 */
+	if( number_of_export_address_table_entries > 0 )
+	{
+		export_address_table_offset = (size_t) export_address_table_rva - virtual_address;
+
+		if( ( export_address_table_rva < virtual_address )
+		 || ( export_address_table_offset > data_size )
+		 || ( ( (size_t) number_of_export_address_table_entries * 4 ) > ( data_size - export_address_table_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid export address table RVA value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_name_pointer_table_entries > 0 )
+	{
+		name_pointer_table_offset = (size_t) name_pointer_table_rva - virtual_address;
+
+		if( ( name_pointer_table_rva < virtual_address )
+		 || ( name_pointer_table_offset > data_size )
+		 || ( ( (size_t) number_of_name_pointer_table_entries * 4 ) > ( data_size - name_pointer_table_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name pointer table RVA value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		ordinal_table_offset = (size_t) ordinal_table_rva - virtual_address;
+
+		if( ( ordinal_table_rva < virtual_address )
+		 || ( ordinal_table_offset > data_size )
+		 || ( ( (size_t) number_of_name_pointer_table_entries * 2 ) > ( data_size - ordinal_table_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid ordinal table RVA value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
 	}
+	if( number_of_export_address_table_entries > 0 )
+	{
+		export_table->entries = (libexe_export_entry_t *) memory_allocate(
+		                                                   sizeof( libexe_export_entry_t ) * number_of_export_address_table_entries );
+
+		if( export_table->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_export_address_table_entries;
+		     entry_index++ )
+		{
+			export_table->entries[ entry_index ].ordinal = export_table->ordinal_base + entry_index;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ export_address_table_offset ] ),
+			 export_table->entries[ entry_index ].relative_virtual_address );
+
+			export_table->entries[ entry_index ].name_offset = 0;
+			export_table->entries[ entry_index ].name_size   = 0;
+
+			export_address_table_offset += 4;
+		}
+		export_table->number_of_entries = number_of_export_address_table_entries;
+	}
+	if( number_of_name_pointer_table_entries > 0 )
+	{
+		export_table->name_entry_indexes = (uint16_t *) memory_allocate(
+		                                                 sizeof( uint16_t ) * number_of_name_pointer_table_entries );
+
+		if( export_table->name_entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+		export_table->name_offsets = (uint32_t *) memory_allocate(
+		                                           sizeof( uint32_t ) * number_of_name_pointer_table_entries );
+
+		if( export_table->name_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name offsets.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the size of the string pool
+		 */
+		for( name_index = 0;
+		     name_index < number_of_name_pointer_table_entries;
+		     name_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ name_pointer_table_offset + ( name_index * 4 ) ] ),
+			 name_rva );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ ordinal_table_offset + ( name_index * 2 ) ] ),
+			 name_entry_index );
+
+			if( (uint32_t) name_entry_index >= number_of_export_address_table_entries )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name: %" PRIu32 " ordinal value out of bounds.",
+				 function,
+				 name_index );
+
+				goto on_error;
+			}
+			name_data_offset = (size_t) name_rva - virtual_address;
+
+			if( ( name_rva < virtual_address )
+			 || ( name_data_offset >= data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name: %" PRIu32 " RVA value out of bounds.",
+				 function,
+				 name_index );
+
+				goto on_error;
+			}
+			for( name_size = 0;
+			     ( name_data_offset + name_size ) < data_size;
+			     name_size++ )
+			{
+				if( data[ name_data_offset + name_size ] == 0 )
+				{
+					break;
+				}
+			}
+			if( ( name_data_offset + name_size ) >= data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name: %" PRIu32 " missing end-of-string character.",
+				 function,
+				 name_index );
+
+				goto on_error;
+			}
+			export_table->name_entry_indexes[ name_index ] = name_entry_index;
+			export_table->name_offsets[ name_index ]       = (uint32_t) name_data_offset;
+
+			export_table->string_pool_size += name_size + 1;
+		}
+		export_table->string_pool = (uint8_t *) memory_allocate(
+		                                         sizeof( uint8_t ) * export_table->string_pool_size );
+
+		if( export_table->string_pool == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* Copy the names into the string pool and replace the data offsets
+		 * of the names by their string pool offsets
+		 */
+		export_table->names_are_sorted = 1;
+
+		for( name_index = 0;
+		     name_index < number_of_name_pointer_table_entries;
+		     name_index++ )
+		{
+			name_data_offset = (size_t) export_table->name_offsets[ name_index ];
+
+			for( name_size = 0;
+			     data[ name_data_offset + name_size ] != 0;
+			     name_size++ )
+			{
+				export_table->string_pool[ string_pool_offset + name_size ] = data[ name_data_offset + name_size ];
+			}
+			export_table->string_pool[ string_pool_offset + name_size ] = 0;
+
+			name_size += 1;
+
+			export_table->name_offsets[ name_index ] = (uint32_t) string_pool_offset;
+
+			name_entry_index = export_table->name_entry_indexes[ name_index ];
+
+			if( export_table->entries[ name_entry_index ].name_size == 0 )
+			{
+				export_table->entries[ name_entry_index ].name_offset = (uint32_t) string_pool_offset;
+				export_table->entries[ name_entry_index ].name_size   = (uint32_t) name_size;
+			}
+			if( ( name_index > 0 )
+			 && ( export_table->names_are_sorted != 0 ) )
+			{
+				result = libexe_export_table_compare_name(
+				          export_table,
+				          export_table->name_offsets[ name_index - 1 ],
+				          (char *) &( export_table->string_pool[ string_pool_offset ] ),
+				          name_size - 1,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare name: %" PRIu32 ".",
+					 function,
+					 name_index );
+
+					goto on_error;
+				}
+				else if( result == LIBCDATA_COMPARE_GREATER )
+				{
+					export_table->names_are_sorted = 0;
+				}
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: name: %05" PRIu32 " ordinal: %05" PRIu32 "\t\t: %s\n",
+				 function,
+				 name_index,
+				 export_table->ordinal_base + name_entry_index,
+				 (char *) &( export_table->string_pool[ string_pool_offset ] ) );
+			}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              size,
-	              file_offset,
-	              error );
+			string_pool_offset += name_size;
+		}
+		export_table->number_of_names = number_of_name_pointer_table_entries;
+	}
+	return( 1 );
+
+on_error:
+	if( export_table->string_pool != NULL )
+	{
+		memory_free(
+		 export_table->string_pool );
+
+		export_table->string_pool = NULL;
+	}
+	if( export_table->name_offsets != NULL )
+	{
+		memory_free(
+		 export_table->name_offsets );
+
+		export_table->name_offsets = NULL;
+	}
+	if( export_table->name_entry_indexes != NULL )
+	{
+		memory_free(
+		 export_table->name_entry_indexes );
+
+		export_table->name_entry_indexes = NULL;
+	}
+	if( export_table->entries != NULL )
+	{
+		memory_free(
+		 export_table->entries );
+
+		export_table->entries = NULL;
+	}
+	export_table->number_of_entries = 0;
+	export_table->number_of_names   = 0;
+	export_table->string_pool_size  = 0;
+
+	return( -1 );
+}
+
+/* Reads the export table
+ * The export table is read from the data of the section that contains it
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_export_table_read(
+     libexe_export_table_t *export_table,
+     libexe_rva_reader_t *rva_reader,
+     uint32_t virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entry = NULL;
+	const uint8_t *data             = NULL;
+	static char *function           = "libexe_export_table_read";
+	size_t data_size                = 0;
+	int result                      = 0;
 
-	if( read_count != (ssize_t) size )
+	if( export_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read export table data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( rva_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA reader.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_index_get_entry_by_rva(
+	          rva_reader->rva_index,
+	          virtual_address,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section for RVA: 0x%08" PRIx32 ".",
 		 function,
-		 file_offset,
-		 file_offset );
+		 virtual_address );
 
-		goto on_error;
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libexe_rva_reader_get_data(
+		          rva_reader,
+		          entry->virtual_address,
+		          &data,
+		          &data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section data for RVA: 0x%08" PRIx32 ".",
+			 function,
+			 virtual_address );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export table RVA: 0x%08" PRIx32 " value out of bounds.",
+		 function,
+		 virtual_address );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: export table:\n",
-		 function );
-		libcnotify_print_data(
-		 data,
-		 (size_t) size,
-		 0 );
+		 "%s: reading export table at RVA: 0x%08" PRIx32 " in section: %d\n",
+		 function,
+		 virtual_address,
+		 entry->section_index );
 	}
 #endif
-	/* TODO extract values */
+	if( libexe_export_table_read_data(
+	     export_table,
+	     data,
+	     data_size,
+	     (size_t) ( virtual_address - entry->virtual_address ),
+	     entry->virtual_address,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read export table data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_export_table_get_number_of_entries(
+     libexe_export_table_t *export_table,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_number_of_entries";
 
-	memory_free(
-	 data );
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) export_table->number_of_entries;
 
 	return( 1 );
+}
 
-on_error:
-	if( data != NULL )
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_export_table_get_entry_by_index(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_entry_by_index";
+
+	if( export_table == NULL )
 	{
-		memory_free(
-		 data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= export_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ordinal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ordinal.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	*ordinal                  = export_table->entries[ entry_index ].ordinal;
+	*relative_virtual_address = export_table->entries[ entry_index ].relative_virtual_address;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the name of a specific entry
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the entry has no name or -1 on error
+ */
+int libexe_export_table_get_entry_name_size(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_entry_name_size";
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= export_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_table->entries[ entry_index ].name_size == 0 )
+	{
+		return( 0 );
+	}
+	*string_size = (size_t) export_table->entries[ entry_index ].name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a specific entry
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the entry has no name or -1 on error
+ */
+int libexe_export_table_get_entry_name(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_entry_name";
+	size_t name_size      = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= export_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = (size_t) export_table->entries[ entry_index ].name_size;
+
+	if( name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( string_size < name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string,
+	     &( export_table->string_pool[ export_table->entries[ entry_index ].name_offset ] ),
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares a name in the string pool with a name
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libexe_export_table_compare_name(
+     libexe_export_table_t *export_table,
+     uint32_t name_offset,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *pool_name = NULL;
+	static char *function    = "libexe_export_table_compare_name";
+	size_t name_index        = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_table->string_pool == NULL )
+	 || ( (size_t) name_offset >= export_table->string_pool_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The names in the string pool are terminated by an end-of-string character
+	 * which is less than any other character. The comparison stops at the
+	 * end-of-string character so that a name that contains an end-of-string
+	 * character does not read beyond the name in the string pool
+	 */
+	pool_name = &( export_table->string_pool[ name_offset ] );
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( pool_name[ name_index ] == 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( pool_name[ name_index ] < (uint8_t) name[ name_index ] )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( pool_name[ name_index ] > (uint8_t) name[ name_index ] )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	if( pool_name[ name_index ] != 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the index of the entry with a specific name
+ * The names are binary searched in the order of the name pointer table, which
+ * is sorted, otherwise the names are searched sequentially
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libexe_export_table_get_entry_index_by_name(
+     libexe_export_table_t *export_table,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_entry_index_by_name";
+	uint32_t end_index    = 0;
+	uint32_t name_index   = 0;
+	uint32_t start_index  = 0;
+	int result            = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	end_index = export_table->number_of_names;
+
+	while( start_index < end_index )
+	{
+		if( export_table->names_are_sorted != 0 )
+		{
+			name_index = start_index + ( ( end_index - start_index ) / 2 );
+		}
+		else
+		{
+			name_index = start_index;
+		}
+		result = libexe_export_table_compare_name(
+		          export_table,
+		          export_table->name_offsets[ name_index ],
+		          name,
+		          name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare name: %" PRIu32 ".",
+			 function,
+			 name_index );
+
+			return( -1 );
+		}
+		else if( result == LIBCDATA_COMPARE_EQUAL )
+		{
+			*entry_index = (int) export_table->name_entry_indexes[ name_index ];
+
+			return( 1 );
+		}
+		else if( ( result == LIBCDATA_COMPARE_LESS )
+		      || ( export_table->names_are_sorted == 0 ) )
+		{
+			start_index = name_index + 1;
+		}
+		else
+		{
+			end_index = name_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry with a specific ordinal
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libexe_export_table_get_entry_index_by_ordinal(
+     libexe_export_table_t *export_table,
+     uint32_t ordinal,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_export_table_get_entry_index_by_ordinal";
+	uint32_t safe_index   = 0;
+
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ordinal < export_table->ordinal_base )
+	{
+		return( 0 );
+	}
+	safe_index = ordinal - export_table->ordinal_base;
+
+	/* Unused entries in the export address table have a RVA of 0
+	 */
+	if( ( safe_index >= export_table->number_of_entries )
+	 || ( export_table->entries[ safe_index ].relative_virtual_address == 0 ) )
+	{
+		return( 0 );
+	}
+	*entry_index = (int) safe_index;
+
+	return( 1 );
 }
 
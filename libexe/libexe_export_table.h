@@ -25,20 +25,74 @@
 #include <common.h>
 #include <types.h>
 
-#include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
+#include "libexe_rva_reader.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libexe_export_entry libexe_export_entry_t;
+
+struct libexe_export_entry
+{
+	/* The ordinal
+	 */
+	uint32_t ordinal;
+
+	/* The relative virtual address (RVA)
+	 */
+	uint32_t relative_virtual_address;
+
+	/* The offset of the name in the string pool
+	 */
+	uint32_t name_offset;
+
+	/* The size of the name including the end-of-string character
+	 * or 0 if the entry has no name
+	 */
+	uint32_t name_size;
+};
+
 typedef struct libexe_export_table libexe_export_table_t;
 
 struct libexe_export_table
 {
-	/* Dummy
+	/* The ordinal base
+	 */
+	uint32_t ordinal_base;
+
+	/* The entries, which are stored in ordinal order
 	 */
-	int dummy;
+	libexe_export_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The entry indexes of the names, which are stored in the order of the name pointer table
+	 */
+	uint16_t *name_entry_indexes;
+
+	/* The offsets of the names in the string pool, which are stored in the order of the name pointer table
+	 */
+	uint32_t *name_offsets;
+
+	/* The number of names
+	 */
+	uint32_t number_of_names;
+
+	/* Value to indicate the names are sorted, which allows them to be binary searched
+	 */
+	uint8_t names_are_sorted;
+
+	/* The string pool, which contains the names including their end-of-string character
+	 */
+	uint8_t *string_pool;
+
+	/* The string pool size
+	 */
+	size_t string_pool_size;
 };
 
 int libexe_export_table_initialize(
@@ -49,11 +103,63 @@ int libexe_export_table_free(
      libexe_export_table_t **export_table,
      libcerror_error_t **error );
 
+int libexe_export_table_read_data(
+     libexe_export_table_t *export_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint32_t virtual_address,
+     libcerror_error_t **error );
+
 int libexe_export_table_read(
      libexe_export_table_t *export_table,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     uint32_t size,
+     libexe_rva_reader_t *rva_reader,
+     uint32_t virtual_address,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_number_of_entries(
+     libexe_export_table_t *export_table,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_entry_by_index(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_entry_name_size(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_entry_name(
+     libexe_export_table_t *export_table,
+     int entry_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libexe_export_table_compare_name(
+     libexe_export_table_t *export_table,
+     uint32_t name_offset,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_entry_index_by_name(
+     libexe_export_table_t *export_table,
+     const char *name,
+     size_t name_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libexe_export_table_get_entry_index_by_ordinal(
+     libexe_export_table_t *export_table,
+     uint32_t ordinal,
+     int *entry_index,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -25,12 +25,15 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libexe_arena.h"
+#include "libexe_block_cache.h"
 #include "libexe_data_directory_descriptor.h"
 #include "libexe_codepage.h"
 #include "libexe_debug.h"
 #include "libexe_debug_data.h"
 #include "libexe_definitions.h"
 #include "libexe_export_table.h"
+#include "libexe_import_hash.h"
 #include "libexe_import_table.h"
 #include "libexe_io_handle.h"
 #include "libexe_file.h"
@@ -38,6 +41,10 @@
 #include "libexe_libcdata.h"
 #include "libexe_libcerror.h"
 #include "libexe_libcnotify.h"
+#include "libexe_libcthreads.h"
+#include "libexe_memory_map.h"
+#include "libexe_rva_index.h"
+#include "libexe_rva_reader.h"
 #include "libexe_section.h"
 #include "libexe_section_descriptor.h"
 
@@ -132,6 +139,35 @@ int libexe_file_initialize(
 
 		goto on_error;
 	}
+	if( libexe_block_cache_initialize(
+	     &( internal_file->block_cache ),
+	     LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libexe_file_t *) internal_file;
 
 	return( 1 );
@@ -139,6 +175,18 @@ int libexe_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+		if( internal_file->block_cache != NULL )
+		{
+			libexe_block_cache_free(
+			 &( internal_file->block_cache ),
+			 NULL );
+		}
+		if( internal_file->io_handle != NULL )
+		{
+			libexe_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
 		if( internal_file->sections_array != NULL )
 		{
 			libcdata_array_free(
@@ -210,6 +258,34 @@ int libexe_file_free(
 
 			result = -1;
 		}
+		/* The RVA index and section name index are retained when the file was reset
+		 */
+		if( libexe_rva_index_free(
+		     &( internal_file->rva_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free RVA index.",
+			 function );
+
+			result = -1;
+		}
+		if( libexe_section_name_index_free(
+		     &( internal_file->section_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section name index.",
+			 function );
+
+			result = -1;
+		}
 		if( libexe_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -223,6 +299,34 @@ int libexe_file_free(
 
 			result = -1;
 		}
+		if( libexe_block_cache_free(
+		     &( internal_file->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -392,8 +496,38 @@ int libexe_file_open(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	internal_file->file_io_handle_created_in_library = 1;
 
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -532,8 +666,38 @@ int libexe_file_open_wide(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	internal_file->file_io_handle_created_in_library = 1;
 
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -548,19 +712,19 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file using a read-only memory mapping of the file
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_open_file_io_handle(
+int libexe_file_open_mmap(
      libexe_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const char *filename,
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle      = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_open_file_io_handle";
-	int bfio_access_flags                 = 0;
-	int file_io_handle_is_open            = 0;
+	libexe_memory_map_t *memory_map       = NULL;
+	static char *function                 = "libexe_file_open_mmap";
 
 	if( file == NULL )
 	{
@@ -575,6 +739,28 @@ int libexe_file_open_file_io_handle(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory map already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
@@ -586,13 +772,13 @@ int libexe_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -620,86 +806,160 @@ int libexe_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) != 0 )
+	if( libexe_memory_map_initialize(
+	     &memory_map,
+	     error ) != 1 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
 
-	if( file_io_handle_is_open == -1 )
+		goto on_error;
+	}
+	if( libexe_memory_map_open(
+	     memory_map,
+	     filename,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     memory_map->data,
+	     memory_map->data_size,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		internal_file->file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libexe_file_open_read(
-	     internal_file,
+	/* The file data is set before the file is opened so that the headers
+	 * are parsed in place
+	 */
+	internal_file->io_handle->file_data      = memory_map->data;
+	internal_file->io_handle->file_data_size = memory_map->data_size;
+
+	if( libexe_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	internal_file->file_io_handle = file_io_handle;
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->memory_map                        = memory_map;
 
-	return( 1 );
+	/* The access hints are best-effort
+	 */
+	libexe_internal_file_advise_data_ranges(
+	 internal_file,
+	 NULL );
 
-on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
+#endif
+	return( 1 );
+
+on_error:
+	internal_file->io_handle->file_data      = NULL;
+	internal_file->io_handle->file_data_size = 0;
 
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libexe_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a file from a buffer in memory
+ * The headers are parsed in place and the section data can be accessed without
+ * copying using libexe_section_get_data_pointer. The buffer is not copied and
+ * must remain valid and unchanged until the file is closed
+ * Returns 1 if successful or -1 on error
  */
-int libexe_file_close(
+int libexe_file_open_memory(
      libexe_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle      = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_close";
-	int result                            = 0;
+	static char *function                 = "libexe_file_open_memory";
 
 	if( file == NULL )
 	{
@@ -714,122 +974,189 @@ int libexe_file_close(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_file->file_io_handle != NULL )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libexe_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( data == NULL )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-	if( libexe_io_handle_clear(
-	     internal_file->io_handle,
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file IO handle is only used by the section data streams, reads by
+	 * the library are served from the file data directly
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_resize(
-	     internal_file->sections_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize sections array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	return( result );
+	/* The file data is set before the file is opened so that the headers
+	 * are parsed in place
+	 */
+	internal_file->io_handle->file_data      = data;
+	internal_file->io_handle->file_data_size = data_size;
+
+	if( libexe_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	internal_file->io_handle->file_data      = NULL;
+	internal_file->io_handle->file_data_size = 0;
+
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
+/* Opens a file using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_open_read(
-     libexe_internal_file_t *internal_file,
+int libexe_file_open_file_io_handle(
+     libexe_file_t *file,
      libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
-	libexe_debug_data_t *debug_data                               = NULL;
-	libexe_export_table_t *export_table                           = NULL;
-	libexe_import_table_t *import_table                           = NULL;
-	static char *function                                         = "libexe_file_open_read";
-	off64_t file_offset                                           = 0;
-	uint16_t number_of_sections                                   = 0;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_open_file_io_handle";
+	int bfio_access_flags                 = 0;
+	int file_io_handle_is_open            = 0;
+	int result                            = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -840,295 +1167,5431 @@ int libexe_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
+	if( file_io_handle == NULL )
 	{
-		internal_file->io_handle->abort = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libexe_io_handle_read_file_header(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     &number_of_sections,
-	     error ) != 1 )
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_sections > 0 )
+	else if( file_io_handle_is_open == 0 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading section table:\n" );
-		}
-#endif
-		if( libexe_io_handle_read_section_table(
-		     internal_file->io_handle,
+		if( libbfio_handle_open(
 		     file_io_handle,
-		     number_of_sections,
-		     internal_file->sections_array,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read section table.",
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
 			 function );
 
 			goto on_error;
 		}
+		internal_file->file_io_handle_opened_in_library = 1;
 	}
-	if( internal_file->io_handle->coff_optional_header != NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		data_directory_descriptor = &( internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_EXPORT_TABLE ] );
-
-		if( data_directory_descriptor->size > 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libexe_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+	}
+	else
+	{
+		internal_file->file_io_handle = file_io_handle;
+		internal_file->access_flags   = access_flags;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	return( -1 );
+}
+
+/* Reopens a file using a Basic File IO (bfio) handle
+ * The file is reset if it is open, hence the buffers allocated for the file
+ * are reused instead of freed and allocated again
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_reopen_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_reopen_file_io_handle";
+
+	if( libexe_file_reset(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to reset file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file from a forward only stream using a Basic File IO (bfio) handle
+ * The file IO handle is only read sequentially and is never seeked or sized,
+ * so that it can refer to a pipe or socket. The headers and section table are
+ * read first after which the section data is passed to the callback function
+ * in file offset order, the data between sections is read and discarded
+ * The callback function must return 1 to continue or -1 to stop and must not
+ * call functions of the file. After the stream was read the file provides
+ * the header and section information, but section data cannot be read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_stream_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     int (*callback_function)(
+            int section_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_open_stream_file_io_handle";
+	int bfio_access_flags                 = 0;
+	int file_io_handle_is_open            = 0;
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
 		{
-			if( libexe_file_get_offset_by_relative_virtual_address(
-			     internal_file,
-			     data_directory_descriptor->virtual_address,
-			     &file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
-				 function,
-				 data_directory_descriptor->virtual_address );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
 
-				goto on_error;
-			}
-			if( libexe_export_table_initialize(
-			     &export_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create export table.",
-				 function );
+			return( -1 );
+		}
+		internal_file->file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-				goto on_error;
-			}
-			if( libexe_export_table_read(
-			     export_table,
-			     file_io_handle,
-			     file_offset,
-			     data_directory_descriptor->size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read export table.",
-				 function );
+		goto on_error;
+	}
+#endif
+	internal_file->io_handle->is_stream = 1;
 
-				goto on_error;
-			}
-			if( libexe_export_table_free(
-			     &export_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free export table.",
+	result = libexe_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		internal_file->io_handle->is_stream = 0;
+	}
+	else
+	{
+		internal_file->file_io_handle = file_io_handle;
+		internal_file->access_flags   = access_flags;
+
+		result = libexe_internal_file_read_stream_sections(
+		          internal_file,
+		          file_io_handle,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sections from stream.",
+			 function );
+
+			libexe_internal_file_close(
+			 internal_file,
+			 0,
+			 NULL );
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_file_close(
+     libexe_file_t *file,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_close";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_close(
+	          internal_file,
+	          0,
+	          error );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes a file
+ * When the buffers are retained the sections array, the RVA index and the section
+ * name index keep their allocated entries so that the next open does not need
+ * to allocate them again
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_internal_file_close(
+     libexe_internal_file_t *internal_file,
+     uint8_t retain_buffers,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_file_close";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libexe_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
 				 function );
 
-				goto on_error;
-			}
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		if( libexe_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->file_io_handle = NULL;
+	internal_file->access_flags   = 0;
+
+	if( internal_file->export_table != NULL )
+	{
+		if( libexe_export_table_free(
+		     &( internal_file->export_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free export table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->export_table_is_read = 0;
+
+	if( internal_file->import_table != NULL )
+	{
+		if( libexe_import_table_free(
+		     &( internal_file->import_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free import table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->import_table_is_read = 0;
+
+	if( internal_file->debug_data != NULL )
+	{
+		if( libexe_debug_data_free(
+		     &( internal_file->debug_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free debug data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libexe_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libexe_block_cache_clear(
+	     internal_file->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		result = -1;
+	}
+	if( retain_buffers != 0 )
+	{
+		if( internal_file->rva_index != NULL )
+		{
+			if( libexe_rva_index_clear(
+			     internal_file->rva_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear RVA index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->section_name_index != NULL )
+		{
+			if( libexe_section_name_index_clear(
+			     internal_file->section_name_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear section name index.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	else
+	{
+		if( libexe_rva_index_free(
+		     &( internal_file->rva_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free RVA index.",
+			 function );
+
+			result = -1;
+		}
+		if( libexe_section_name_index_free(
+		     &( internal_file->section_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free section name index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->borrowed_sections != NULL )
+	{
+		/* Memory allocated from an arena is released when the arena is reset
+		 */
+		if( internal_file->io_handle->arena == NULL )
+		{
+			memory_free(
+			 internal_file->borrowed_sections );
+		}
+		internal_file->borrowed_sections = NULL;
+	}
+	internal_file->number_of_borrowed_sections = 0;
+
+	if( libcdata_array_resize(
+	     internal_file->sections_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sections array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->io_handle->arena != NULL )
+	{
+		if( libexe_arena_reset(
+		     internal_file->io_handle->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset arena.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Resets a file for reuse
+ * Closes the file if it is open but, unlike libexe_file_close, retains the buffers
+ * allocated for the file so that a subsequent open can reuse them
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_reset(
+     libexe_file_t *file,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_reset";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_io_handle != NULL )
+	{
+		if( libexe_internal_file_close(
+		     internal_file,
+		     1,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_open_read(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function       = "libexe_file_open_read";
+	uint16_t number_of_sections = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libexe_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sections > 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading section table:\n" );
+		}
+#endif
+		if( libexe_io_handle_read_section_table(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     number_of_sections,
+		     internal_file->sections_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read section table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The RVA index is retained when the file was reset
+	 */
+	if( internal_file->rva_index == NULL )
+	{
+		if( libexe_rva_index_initialize(
+		     &( internal_file->rva_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RVA index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libexe_rva_index_set_sections(
+	     internal_file->rva_index,
+	     internal_file->sections_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sections in RVA index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The section name index is retained when the file was reset
+	 */
+	if( internal_file->section_name_index == NULL )
+	{
+		if( libexe_section_name_index_initialize(
+		     &( internal_file->section_name_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create section name index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libexe_section_name_index_set_sections(
+	     internal_file->section_name_index,
+	     internal_file->sections_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sections in section name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_internal_file_set_borrowed_sections(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set borrowed sections.",
+		 function );
+
+		goto on_error;
+	}
+	/* The header data is only needed to open the file, the data directories
+	 * are read on demand. A stream keeps the header data since it can contain
+	 * the start of the section data
+	 */
+	if( internal_file->io_handle->is_stream == 0 )
+	{
+		if( libexe_io_handle_free_header_data(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free header data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of reads\t\t\t: %d\n",
+		 function,
+		 internal_file->io_handle->number_of_reads );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_file->borrowed_sections != NULL )
+	{
+		/* Memory allocated from an arena is released when the arena is reset
+		 */
+		if( internal_file->io_handle->arena == NULL )
+		{
+			memory_free(
+			 internal_file->borrowed_sections );
+		}
+		internal_file->borrowed_sections = NULL;
+	}
+	internal_file->number_of_borrowed_sections = 0;
+
+	if( internal_file->section_name_index != NULL )
+	{
+		libexe_section_name_index_free(
+		 &( internal_file->section_name_index ),
+		 NULL );
+	}
+	if( internal_file->rva_index != NULL )
+	{
+		libexe_rva_index_free(
+		 &( internal_file->rva_index ),
+		 NULL );
+	}
+	libcdata_array_resize(
+	 internal_file->sections_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	 NULL );
+
+	if( internal_file->io_handle->coff_optional_header != NULL )
+	{
+		libexe_coff_optional_header_free(
+		 &( internal_file->io_handle->coff_optional_header ),
+		 NULL );
+	}
+	if( internal_file->io_handle->coff_header != NULL )
+	{
+		libexe_coff_header_free(
+		 &( internal_file->io_handle->coff_header ),
+		 NULL );
+	}
+	libexe_io_handle_free_header_data(
+	 internal_file->io_handle,
+	 NULL );
+
+	if( internal_file->io_handle->arena != NULL )
+	{
+		libexe_arena_reset(
+		 internal_file->io_handle->arena,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the section data from a forward only stream
+ * The stream is positioned at the end of the header data, section data that
+ * is part of the header data is passed from the header data
+ * If the stream ends before the end of the section data the available data
+ * is passed and the remaining sections are not read
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_file_read_stream_sections(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int section_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t **section_descriptors = NULL;
+	libexe_section_descriptor_t *section_descriptor   = NULL;
+	uint8_t *stream_data                              = NULL;
+	static char *function                             = "libexe_internal_file_read_stream_sections";
+	size64_t remaining_data_size                      = 0;
+	size_t read_size                                  = 0;
+	ssize_t read_count                                = 0;
+	off64_t data_end_offset                           = 0;
+	off64_t data_offset                               = 0;
+	off64_t section_data_offset                       = 0;
+	off64_t stream_offset                             = 0;
+	int end_of_stream                                 = 0;
+	int number_of_sections                            = 0;
+	int section_index                                 = 0;
+	int sort_index                                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sections > 0 )
+	{
+		section_descriptors = (libexe_section_descriptor_t **) memory_allocate(
+		                                                        sizeof( libexe_section_descriptor_t * ) * number_of_sections );
+
+		if( section_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create section descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		stream_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * LIBEXE_STREAM_DATA_BLOCK_SIZE );
+
+		if( stream_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create stream data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The section descriptors are sorted by data offset, since sections
+	 * are typically stored in file offset order an insertion sort is used
+	 */
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( section_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		sort_index = section_index;
+
+		while( ( sort_index > 0 )
+		    && ( section_descriptors[ sort_index - 1 ]->data_offset > section_descriptor->data_offset ) )
+		{
+			section_descriptors[ sort_index ] = section_descriptors[ sort_index - 1 ];
+
+			sort_index--;
+		}
+		section_descriptors[ sort_index ] = section_descriptor;
+	}
+	/* The stream is positioned at the end of the header data
+	 */
+	stream_offset = (off64_t) internal_file->io_handle->header_data_size;
+
+	for( sort_index = 0;
+	     sort_index < number_of_sections;
+	     sort_index++ )
+	{
+		if( end_of_stream != 0 )
+		{
+			break;
+		}
+		section_descriptor = section_descriptors[ sort_index ];
+
+		if( section_descriptor->data_size == 0 )
+		{
+			continue;
+		}
+		data_offset     = section_descriptor->data_offset;
+		data_end_offset = data_offset + (off64_t) section_descriptor->data_size;
+
+		section_data_offset = 0;
+
+		if( data_offset < (off64_t) internal_file->io_handle->header_data_size )
+		{
+			read_size = internal_file->io_handle->header_data_size - (size_t) data_offset;
+
+			if( (size64_t) read_size > section_descriptor->data_size )
+			{
+				read_size = (size_t) section_descriptor->data_size;
+			}
+			if( callback_function(
+			     section_descriptor->index,
+			     section_data_offset,
+			     &( internal_file->io_handle->header_data[ data_offset ] ),
+			     read_size,
+			     callback_data ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for section: %d.",
+				 function,
+				 section_descriptor->index );
+
+				goto on_error;
+			}
+			data_offset         += (off64_t) read_size;
+			section_data_offset += (off64_t) read_size;
+		}
+		if( data_offset >= data_end_offset )
+		{
+			continue;
+		}
+		if( data_offset < stream_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported section: %d data offset: 0x%08" PRIx64 " overlaps data already read from stream.",
+			 function,
+			 section_descriptor->index,
+			 data_offset );
+
+			goto on_error;
+		}
+		/* The data before the section data is skipped without seeking
+		 */
+		while( ( end_of_stream == 0 )
+		    && ( stream_offset < data_end_offset ) )
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				goto on_error;
+			}
+			if( stream_offset < data_offset )
+			{
+				remaining_data_size = (size64_t) ( data_offset - stream_offset );
+			}
+			else
+			{
+				remaining_data_size = (size64_t) ( data_end_offset - stream_offset );
+			}
+			read_size = LIBEXE_STREAM_DATA_BLOCK_SIZE;
+
+			if( remaining_data_size < (size64_t) read_size )
+			{
+				read_size = (size_t) remaining_data_size;
+			}
+			read_count = libexe_io_handle_read_stream_data(
+			              internal_file->io_handle,
+			              file_io_handle,
+			              stream_data,
+			              read_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ") from stream.",
+				 function,
+				 stream_offset,
+				 stream_offset );
+
+				goto on_error;
+			}
+			/* The stream can end before the end of the section data,
+			 * in which case the available section data is passed
+			 */
+			if( (size_t) read_count < read_size )
+			{
+				read_size     = (size_t) read_count;
+				end_of_stream = 1;
+			}
+			if( ( stream_offset >= data_offset )
+			 && ( read_size > 0 ) )
+			{
+				if( callback_function(
+				     section_descriptor->index,
+				     section_data_offset,
+				     stream_data,
+				     read_size,
+				     callback_data ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback function failed for section: %d.",
+					 function,
+					 section_descriptor->index );
+
+					goto on_error;
+				}
+				section_data_offset += (off64_t) read_size;
+			}
+			stream_offset += (off64_t) read_size;
+		}
+	}
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	if( section_descriptors != NULL )
+	{
+		memory_free(
+		 section_descriptors );
+	}
+	if( libexe_io_handle_free_header_data(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free header data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	if( section_descriptors != NULL )
+	{
+		memory_free(
+		 section_descriptors );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_ascii_codepage(
+     libexe_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_ascii_codepage(
+     libexe_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEXE_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of reads that were needed to open the file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_open_reads(
+     libexe_file_t *file,
+     int *number_of_reads,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_open_reads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_reads = internal_file->io_handle->number_of_reads;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the section data block cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_cache_size(
+     libexe_file_t *file,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	/* The block cache has its own read/write lock
+	 */
+	if( libexe_block_cache_get_cache_size(
+	     internal_file->block_cache,
+	     cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the section data block cache size
+ * The cache size is rounded down to a multiple of the block size
+ * and a cache size of 0 disables block caching
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_cache_size(
+     libexe_file_t *file,
+     size64_t cache_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_block_cache_set_cache_size(
+	     internal_file->block_cache,
+	     cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the section data block cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_cache_statistics(
+     libexe_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( libexe_block_cache_get_statistics(
+	     internal_file->block_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the arena size
+ * An arena size of 0 indicates that no arena is used
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_arena_size(
+     libexe_file_t *file,
+     size_t *arena_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_arena_size";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->io_handle->arena == NULL )
+	{
+		*arena_size = 0;
+	}
+	else if( libexe_arena_get_block_size(
+	          internal_file->io_handle->arena,
+	          arena_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve arena block size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the arena size
+ * When an arena is used the metadata of the file, such as the headers and
+ * the section descriptors, is allocated from blocks of the arena size, which
+ * are released in one go when the file is closed. The first block is retained
+ * for the next file that is opened. An arena size of 0 disables the arena
+ * The arena size can only be changed while the file is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_set_arena_size(
+     libexe_file_t *file,
+     size_t arena_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_set_arena_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena_size > (size_t) LIBEXE_MAXIMUM_ARENA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid arena size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->arena != NULL )
+	{
+		if( libexe_arena_free(
+		     &( internal_file->io_handle->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( arena_size > 0 )
+	{
+		if( libexe_arena_initialize(
+		     &( internal_file->io_handle->arena ),
+		     arena_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file offset of a specific relative virtual address (RVA)
+ * Returns 1 if successful, 0 if the RVA is not stored in the file or -1 on error
+ */
+int libexe_file_get_offset_by_relative_virtual_address(
+     libexe_internal_file_t *internal_file,
+     uint32_t virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_get_offset_by_relative_virtual_address";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_index_get_offset_by_rva(
+	          internal_file->rva_index,
+	          virtual_address,
+	          offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset for RVA: 0x%08" PRIx32 " from index.",
+		 function,
+		 virtual_address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the file offset of a specific relative virtual address (RVA)
+ * Returns 1 if successful, 0 if the RVA is not stored in the file or -1 on error
+ */
+int libexe_file_get_offset_by_rva(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_offset_by_rva";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_file_get_offset_by_relative_virtual_address(
+	          internal_file,
+	          relative_virtual_address,
+	          offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset for RVA: 0x%08" PRIx32 ".",
+		 function,
+		 relative_virtual_address );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file offsets of multiple relative virtual addresses (RVAs)
+ * For every RVA the status is set to 1 if the RVA is stored in the file or 0 if not,
+ * in which case the offset is set to 0. The status array is optional
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_translate_rvas(
+     libexe_file_t *file,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_translate_rvas";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing RVA index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_rva_index_get_offsets_by_rvas(
+	     internal_file->rva_index,
+	     relative_virtual_addresses,
+	     number_of_relative_virtual_addresses,
+	     offsets,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offsets from index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads multiple ranges of file data
+ * Ranges that overlap or are nearby are merged so that the data is read
+ * with as few reads as possible. Every range must be stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_read_ranges(
+     libexe_file_t *file,
+     const libexe_range_t *ranges,
+     size_t number_of_ranges,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_read_ranges";
+	int number_of_reads                   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_io_handle_read_ranges(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     ranges,
+	     number_of_ranges,
+	     &number_of_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ranges.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the borrowed sections
+ * The borrowed sections are created in a single allocation when the file is opened
+ * so that retrieving a borrowed section does not allocate
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_file_set_borrowed_sections(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libexe_internal_section_t *borrowed_sections    = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_internal_file_set_borrowed_sections";
+	int number_of_sections                          = 0;
+	int section_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->borrowed_sections != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - borrowed sections value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sections == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_sections < 0 )
+	 || ( (size_t) number_of_sections > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libexe_internal_section_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sections value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->arena != NULL )
+	{
+		if( libexe_arena_allocate(
+		     internal_file->io_handle->arena,
+		     sizeof( libexe_internal_section_t ) * number_of_sections,
+		     (void **) &borrowed_sections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate borrowed sections from arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		borrowed_sections = (libexe_internal_section_t *) memory_allocate(
+		                                                   sizeof( libexe_internal_section_t ) * number_of_sections );
+	}
+	if( borrowed_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create borrowed sections.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     borrowed_sections,
+	     0,
+	     sizeof( libexe_internal_section_t ) * number_of_sections ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear borrowed sections.",
+		 function );
+
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_internal_section_set_borrowed(
+		     &( borrowed_sections[ section_index ] ),
+		     internal_file->io_handle,
+		     file_io_handle,
+		     section_descriptor,
+		     internal_file->block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set borrowed section: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+	}
+	internal_file->borrowed_sections           = borrowed_sections;
+	internal_file->number_of_borrowed_sections = number_of_sections;
+
+	return( 1 );
+
+on_error:
+	if( ( borrowed_sections != NULL )
+	 && ( internal_file->io_handle->arena == NULL ) )
+	{
+		memory_free(
+		 borrowed_sections );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file offset and size of a data directory
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_internal_file_get_data_directory_range(
+     libexe_internal_file_t *internal_file,
+     int data_directory_index,
+     off64_t *file_offset,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	libexe_data_directory_descriptor_t *data_directory_descriptor = NULL;
+	static char *function                                         = "libexe_internal_file_get_data_directory_range";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_directory_index < 0 )
+	 || ( data_directory_index >= LIBEXE_NUMBER_OF_DATA_DIRECTORIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEXE_ACCESS_FLAG_HEADERS_ONLY ) != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_file->io_handle->coff_optional_header == NULL )
+	{
+		return( 0 );
+	}
+	data_directory_descriptor = &( internal_file->io_handle->coff_optional_header->data_directories[ data_directory_index ] );
+
+	if( data_directory_descriptor->size == 0 )
+	{
+		return( 0 );
+	}
+	if( libexe_file_get_offset_by_relative_virtual_address(
+	     internal_file,
+	     data_directory_descriptor->virtual_address,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+		 function,
+		 data_directory_descriptor->virtual_address );
+
+		return( -1 );
+	}
+	*size = data_directory_descriptor->size;
+
+	return( 1 );
+}
+
+/* Advises the operating system which data ranges of the file will be read
+ * This issues a best-effort hint for the export, import, debug and delay import
+ * data directory ranges, which are read on first use of the corresponding data.
+ * The hint is only applied to memory mapped files, since the file IO handle
+ * does not expose its file descriptor
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libexe_internal_file_advise_data_ranges(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	int data_directory_indexes[ 4 ] = {
+		LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+		LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+		LIBEXE_DATA_DIRECTORY_DEBUG_DATA,
+		LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR };
+
+	static char *function           = "libexe_internal_file_advise_data_ranges";
+	off64_t file_offset             = 0;
+	uint32_t size                   = 0;
+	int index                       = 0;
+	int result                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->access_flags & LIBEXE_ACCESS_FLAG_ADVISE_DATA_RANGES ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_file->access_flags & LIBEXE_ACCESS_FLAG_HEADERS_ONLY ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( internal_file->memory_map == NULL )
+	 || ( internal_file->io_handle->coff_optional_header == NULL ) )
+	{
+		return( 0 );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libexe_internal_file_get_data_directory_range(
+		          internal_file,
+		          data_directory_indexes[ index ],
+		          &file_offset,
+		          &size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data directory: %d range.",
+			 function,
+			 data_directory_indexes[ index ] );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( (size64_t) file_offset >= (size64_t) internal_file->memory_map->data_size )
+		{
+			continue;
+		}
+		result = libexe_memory_map_advise_range(
+		          internal_file->memory_map,
+		          (size_t) file_offset,
+		          (size_t) size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise data directory: %d range.",
+			 function,
+			 data_directory_indexes[ index ] );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the export table
+ * The export table is read on first use and cached by the file, the caller
+ * must hold the write lock unless the export table was read before
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_internal_file_get_export_table(
+     libexe_internal_file_t *internal_file,
+     libexe_export_table_t **export_table,
+     libcerror_error_t **error )
+{
+	libexe_rva_reader_t *rva_reader = NULL;
+	static char *function           = "libexe_internal_file_get_export_table";
+	off64_t file_offset             = 0;
+	uint32_t size                   = 0;
+	int result                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->export_table_is_read == 0 )
+	{
+		result = libexe_internal_file_get_data_directory_range(
+		          internal_file,
+		          LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+		          &file_offset,
+		          &size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve export table data directory range.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libexe_export_table_initialize(
+			     &( internal_file->export_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create export table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_rva_reader_initialize(
+			     &rva_reader,
+			     internal_file->file_io_handle,
+			     internal_file->rva_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create RVA reader.",
+				 function );
+
+				goto on_error;
+			}
+			if( libexe_export_table_read(
+			     internal_file->export_table,
+			     rva_reader,
+			     internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_EXPORT_TABLE ].virtual_address,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read export table.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->io_handle->number_of_reads += rva_reader->number_of_reads;
+
+			if( libexe_rva_reader_free(
+			     &rva_reader,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free RVA reader.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_file->export_table_is_read = 1;
+	}
+	if( internal_file->export_table == NULL )
+	{
+		return( 0 );
+	}
+	*export_table = internal_file->export_table;
+
+	return( 1 );
+
+on_error:
+	if( rva_reader != NULL )
+	{
+		libexe_rva_reader_free(
+		 &rva_reader,
+		 NULL );
+	}
+	if( internal_file->export_table != NULL )
+	{
+		libexe_export_table_free(
+		 &( internal_file->export_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the import table
+ * The import table is read on first use and cached by the file, the caller
+ * must hold the write lock unless the import table was read before
+ * It contains the modules of the import table followed by those of the delay-load import table
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_internal_file_get_import_table(
+     libexe_internal_file_t *internal_file,
+     libexe_import_table_t **import_table,
+     libcerror_error_t **error )
+{
+	libexe_rva_reader_t *rva_reader  = NULL;
+	static char *function            = "libexe_internal_file_get_import_table";
+	off64_t delay_import_file_offset = 0;
+	off64_t import_file_offset       = 0;
+	uint32_t delay_import_size       = 0;
+	uint32_t import_size             = 0;
+	int delay_result                 = 0;
+	int result                       = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->import_table_is_read == 0 )
+	{
+		result = libexe_internal_file_get_data_directory_range(
+		          internal_file,
+		          LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+		          &import_file_offset,
+		          &import_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve import table data directory range.",
+			 function );
+
+			goto on_error;
+		}
+		/* The delay-load import table is optional and is ignored
+		 * if its data directory cannot be resolved
+		 */
+		delay_result = libexe_internal_file_get_data_directory_range(
+		                internal_file,
+		                LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR,
+		                &delay_import_file_offset,
+		                &delay_import_size,
+		                error );
+
+		if( delay_result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to retrieve delay-load import table data directory range.\n",
+				 function );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			delay_result = 0;
+		}
+		if( ( result != 0 )
+		 || ( delay_result != 0 ) )
+		{
+			if( libexe_import_table_initialize(
+			     &( internal_file->import_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create import table.",
+				 function );
+
+				goto on_error;
+			}
+			/* The import and delay-load import tables share the RVA reader
+			 * so that the data of a section is read only once
+			 */
+			if( libexe_rva_reader_initialize(
+			     &rva_reader,
+			     internal_file->file_io_handle,
+			     internal_file->rva_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create RVA reader.",
+				 function );
+
+				goto on_error;
+			}
+			if( result != 0 )
+			{
+				if( libexe_import_table_read(
+				     internal_file->import_table,
+				     rva_reader,
+				     internal_file->io_handle->coff_optional_header->signature,
+				     internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_IMPORT_TABLE ].virtual_address,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read import table.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( delay_result != 0 )
+			{
+				if( libexe_import_table_read_delay_imports(
+				     internal_file->import_table,
+				     rva_reader,
+				     internal_file->io_handle->coff_optional_header->signature,
+				     internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR ].virtual_address,
+				     error ) != 1 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to read delay-load import table.\n",
+						 function );
+
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+			}
+			internal_file->io_handle->number_of_reads += rva_reader->number_of_reads;
+
+			if( libexe_rva_reader_free(
+			     &rva_reader,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free RVA reader.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_file->import_table_is_read = 1;
+	}
+	if( internal_file->import_table == NULL )
+	{
+		return( 0 );
+	}
+	*import_table = internal_file->import_table;
+
+	return( 1 );
+
+on_error:
+	if( rva_reader != NULL )
+	{
+		libexe_rva_reader_free(
+		 &rva_reader,
+		 NULL );
+	}
+	if( internal_file->import_table != NULL )
+	{
+		libexe_import_table_free(
+		 &( internal_file->import_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the debug data
+ * The debug data is read on first use and cached by the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_internal_file_get_debug_data(
+     libexe_internal_file_t *internal_file,
+     libexe_debug_data_t **debug_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_file_get_debug_data";
+	off64_t file_offset   = 0;
+	uint32_t size         = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( debug_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid debug data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->debug_data == NULL )
+	{
+		result = libexe_internal_file_get_data_directory_range(
+		          internal_file,
+		          LIBEXE_DATA_DIRECTORY_DEBUG_DATA,
+		          &file_offset,
+		          &size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve debug data data directory range.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libexe_debug_data_initialize(
+		     &( internal_file->debug_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create debug data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_debug_data_read(
+		     internal_file->debug_data,
+		     internal_file->file_io_handle,
+		     file_offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read debug data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->number_of_reads += 1;
+	}
+	*debug_data = internal_file->debug_data;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->debug_data != NULL )
+	{
+		libexe_debug_data_free(
+		 &( internal_file->debug_data ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+
+/* Grabs the read/write lock for reading with the export or import table read
+ * The table is read on first use while holding the lock for writing, after
+ * which lookups in the table only need the lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_file_grab_for_read_with_table(
+     libexe_internal_file_t *internal_file,
+     int data_directory_index,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table = NULL;
+	libexe_import_table_t *import_table = NULL;
+	uint8_t *table_is_read              = NULL;
+	static char *function               = "libexe_internal_file_grab_for_read_with_table";
+	int result                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_directory_index == LIBEXE_DATA_DIRECTORY_EXPORT_TABLE )
+	{
+		table_is_read = &( internal_file->export_table_is_read );
+	}
+	else if( data_directory_index == LIBEXE_DATA_DIRECTORY_IMPORT_TABLE )
+	{
+		table_is_read = &( internal_file->import_table_is_read );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data directory index: %d.",
+		 function,
+		 data_directory_index );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	/* The table is checked again after the lock for writing was grabbed
+	 * since another thread can have read it in the mean time
+	 */
+	while( *table_is_read == 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		if( *table_is_read == 0 )
+		{
+			if( data_directory_index == LIBEXE_DATA_DIRECTORY_EXPORT_TABLE )
+			{
+				result = libexe_internal_file_get_export_table(
+				          internal_file,
+				          &export_table,
+				          error );
+			}
+			else
+			{
+				result = libexe_internal_file_get_import_table(
+				          internal_file,
+				          &import_table,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data directory: %d table.",
+				 function,
+				 data_directory_index );
+
+				libcthreads_read_write_lock_release_for_write(
+				 internal_file->read_write_lock,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the number of sections
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_sections(
+     libexe_file_t *file,
+     int *number_of_sections,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_sections";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sections_array,
+	     number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific section
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_section(
+     libexe_file_t *file,
+     int section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		goto on_error;
+	}
+	if( libexe_section_initialize(
+	     section,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     section_descriptor,
+	     internal_file->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific section
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_section_by_index(
+     libexe_file_t *file,
+     int section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section_by_index";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		goto on_error;
+	}
+	if( libexe_section_initialize(
+	     section,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     section_descriptor,
+	     internal_file->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific section by an ASCII formatted name
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_file_get_section_by_name(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_file_get_section_by_name";
+	int result            = 0;
+
+	result = libexe_file_get_section_by_name_and_index(
+	          file,
+	          string,
+	          string_length,
+	          0,
+	          section,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of sections with a specific ASCII formatted name
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_sections_by_name(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     int *number_of_sections,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_sections_by_name";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libexe_section_name_index_get_number_of_sections_by_name(
+	     internal_file->section_name_index,
+	     string,
+	     string_length,
+	     number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections from section name index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific section with a specific ASCII formatted name
+ * The name section index refers to the sections with the name in section table order
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_file_get_section_by_name_and_index(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     int name_section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file           = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_file_get_section_by_name_and_index";
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_section_name_index_get_section_index_by_name(
+	          internal_file->section_name_index,
+	          string,
+	          string_length,
+	          name_section_index,
+	          &section_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section index from section name index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		goto on_error;
+	}
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing section descriptor: %d.",
+		 function,
+		 section_index );
+
+		goto on_error;
+	}
+	if( libexe_section_initialize(
+	     section,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     section_descriptor,
+	     internal_file->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create section.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific borrowed section
+ * The section is owned by the file and remains valid until the file is closed.
+ * Retrieving a borrowed section does not allocate memory and the section does not
+ * need to be freed, calling libexe_section_free only clears the reference
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_borrow_section_by_index(
+     libexe_file_t *file,
+     int section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_borrow_section_by_index";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( section_index < 0 )
+	 || ( section_index >= internal_file->number_of_borrowed_sections ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		goto on_error;
+	}
+	*section = (libexe_section_t *) &( internal_file->borrowed_sections[ section_index ] );
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific borrowed section by an ASCII formatted name
+ * The section is owned by the file and remains valid until the file is closed.
+ * Retrieving a borrowed section does not allocate memory and the section does not
+ * need to be freed, calling libexe_section_free only clears the reference
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_file_borrow_section_by_name(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     libexe_section_t **section,
+     libcerror_error_t **error )
+{
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_borrow_section_by_name";
+	int result                            = 0;
+	int section_index                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( internal_file->section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_section_name_index_get_section_index_by_name(
+	          internal_file->section_name_index,
+	          string,
+	          string_length,
+	          0,
+	          &section_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section index from section name index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( 0 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= internal_file->number_of_borrowed_sections ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*section = (libexe_section_t *) &( internal_file->borrowed_sections[ section_index ] );
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of exports
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_exports(
+     libexe_file_t *file,
+     int *number_of_exports,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_exports";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_exports == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of exports.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		*number_of_exports = 0;
+
+		result = 1;
+	}
+	else
+	{
+		result = libexe_export_table_get_number_of_entries(
+		          export_table,
+		          number_of_exports,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of export table entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific export
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_export_by_index(
+     libexe_file_t *file,
+     int export_index,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_export_by_index";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_export_table_get_entry_by_index(
+	          export_table,
+	          export_index,
+	          ordinal,
+	          relative_virtual_address,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export: %d.",
+		 function,
+		 export_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the size of the name of a specific export
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the export has no name or -1 on error
+ */
+int libexe_file_get_export_name_size(
+     libexe_file_t *file,
+     int export_index,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_export_name_size";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_export_table_get_entry_name_size(
+	          export_table,
+	          export_index,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export: %d name size.",
+		 function,
+		 export_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the name of a specific export
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the export has no name or -1 on error
+ */
+int libexe_file_get_export_name(
+     libexe_file_t *file,
+     int export_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_export_name";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_export_table_get_entry_name(
+	          export_table,
+	          export_index,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export: %d name.",
+		 function,
+		 export_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the ordinal and relative virtual address (RVA) of the export with a specific name
+ * Returns 1 if successful, 0 if no such export or -1 on error
+ */
+int libexe_file_get_export_by_name(
+     libexe_file_t *file,
+     const char *name,
+     size_t name_length,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_export_by_name";
+	uint32_t safe_ordinal                 = 0;
+	int export_index                      = 0;
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( ordinal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ordinal.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libexe_export_table_get_entry_index_by_name(
+		          export_table,
+		          name,
+		          name_length,
+		          &export_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve export index by name.",
+			 function );
+
+			goto on_error;
 		}
-		data_directory_descriptor = &( internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_IMPORT_TABLE ] );
-
-		if( data_directory_descriptor->size > 0 )
+		else if( result != 0 )
 		{
-			if( libexe_file_get_offset_by_relative_virtual_address(
-			     internal_file,
-			     data_directory_descriptor->virtual_address,
-			     &file_offset,
+			if( libexe_export_table_get_entry_by_index(
+			     export_table,
+			     export_index,
+			     &safe_ordinal,
+			     relative_virtual_address,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+				 "%s: unable to retrieve export: %d.",
 				 function,
-				 data_directory_descriptor->virtual_address );
+				 export_index );
 
 				goto on_error;
 			}
-			if( libexe_import_table_initialize(
-			     &import_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create import table.",
-				 function );
+			*ordinal = safe_ordinal;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-				goto on_error;
-			}
-			if( libexe_import_table_read(
-			     import_table,
-			     file_io_handle,
-			     file_offset,
-			     data_directory_descriptor->size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read import table.",
-				 function );
+		return( -1 );
+	}
+#endif
+	return( result );
 
-				goto on_error;
-			}
-			if( libexe_import_table_free(
-			     &import_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free import table.",
-				 function );
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
 
-				goto on_error;
-			}
-		}
-		data_directory_descriptor = &( internal_file->io_handle->coff_optional_header->data_directories[ LIBEXE_DATA_DIRECTORY_DEBUG_DATA ] );
+/* Retrieves the relative virtual address (RVA) of the export with a specific ordinal
+ * Returns 1 if successful, 0 if no such export or -1 on error
+ */
+int libexe_file_get_export_by_ordinal(
+     libexe_file_t *file,
+     uint32_t ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error )
+{
+	libexe_export_table_t *export_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_export_by_ordinal";
+	uint32_t safe_ordinal                 = 0;
+	int export_index                      = 0;
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( relative_virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual address.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_EXPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_export_table(
+	          internal_file,
+	          &export_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libexe_export_table_get_entry_index_by_ordinal(
+		          export_table,
+		          ordinal,
+		          &export_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve export index by ordinal.",
+			 function );
 
-		if( data_directory_descriptor->size > 0 )
+			goto on_error;
+		}
+		else if( result != 0 )
 		{
-			if( libexe_file_get_offset_by_relative_virtual_address(
-			     internal_file,
-			     data_directory_descriptor->virtual_address,
-			     &file_offset,
+			if( libexe_export_table_get_entry_by_index(
+			     export_table,
+			     export_index,
+			     &safe_ordinal,
+			     relative_virtual_address,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve offset for relative virtual address: 0x%08" PRIx32 ".",
+				 "%s: unable to retrieve export: %d.",
 				 function,
-				 data_directory_descriptor->virtual_address );
+				 export_index );
 
 				goto on_error;
 			}
-			if( libexe_debug_data_initialize(
-			     &debug_data,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create debug data.",
-				 function );
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-				goto on_error;
-			}
-			if( libexe_debug_data_read(
-			     debug_data,
-			     file_io_handle,
-			     file_offset,
-			     data_directory_descriptor->size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read debug data.",
-				 function );
+		return( -1 );
+	}
+#endif
+	return( result );
 
-				goto on_error;
-			}
-			if( libexe_debug_data_free(
-			     &debug_data,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free debug data.",
-				 function );
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of import modules
+ * The modules of the import table are followed by those of the delay-load import table
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_number_of_import_modules(
+     libexe_file_t *file,
+     int *number_of_modules,
+     libcerror_error_t **error )
+{
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_import_modules";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_modules == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of modules.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		*number_of_modules = 0;
+
+		result = 1;
+	}
+	else
+	{
+		result = libexe_import_table_get_number_of_modules(
+		          import_table,
+		          number_of_modules,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of import modules.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a specific import module
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_file_get_import_module_by_index(
+     libexe_file_t *file,
+     int module_index,
+     int *first_import_index,
+     int *number_of_imports,
+     libcerror_error_t **error )
+{
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	const char *name                      = NULL;
+	static char *function                 = "libexe_file_get_import_module_by_index";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		return( -1 );
 	}
-	return( 1 );
+	internal_file = (libexe_internal_file_t *) file;
 
-on_error:
-	if( debug_data != NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
-		libexe_debug_data_free(
-		 &debug_data,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	if( import_table != NULL )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
-		libexe_import_table_free(
-		 &import_table,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
+		 function );
+
+		goto on_error;
 	}
-	if( export_table != NULL )
+	else if( result == 0 )
 	{
-		libexe_export_table_free(
-		 &export_table,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_module_by_index(
+	          import_table,
+	          module_index,
+	          &name,
+	          first_import_index,
+	          number_of_imports,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import module: %d.",
+		 function,
+		 module_index );
+
+		goto on_error;
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves the file ASCII codepage
+/* Retrieves the size of the name of a specific import module
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_ascii_codepage(
+int libexe_file_get_import_module_name_size(
      libexe_file_t *file,
-     int *ascii_codepage,
+     int module_index,
+     size_t *string_size,
      libcerror_error_t **error )
 {
+	libexe_import_table_t *import_table   = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_get_ascii_codepage";
+	static char *function                 = "libexe_file_get_import_module_name_size";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1143,43 +6606,108 @@ int libexe_file_get_ascii_codepage(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_module_name_size(
+	          import_table,
+	          module_index,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import module: %d name size.",
+		 function,
+		 module_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+#endif
+	return( result );
 
-	return( 1 );
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Sets the file ASCII codepage
+/* Retrieves the name of a specific import module
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_set_ascii_codepage(
+int libexe_file_get_import_module_name(
      libexe_file_t *file,
-     int ascii_codepage,
+     int module_index,
+     char *string,
+     size_t string_size,
      libcerror_error_t **error )
 {
+	libexe_import_table_t *import_table   = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_set_ascii_codepage";
+	static char *function                 = "libexe_file_get_import_module_name";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1194,63 +6722,108 @@ int libexe_file_set_ascii_codepage(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBEXE_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEXE_CODEPAGE_WINDOWS_1258 ) )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_module_name(
+	          import_table,
+	          module_index,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import module: %d name.",
+		 function,
+		 module_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
+#endif
+	return( result );
 
-	return( 1 );
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves offset of a relative virtual address
- * Returns 1 if successful, 0 if no such section or -1 on error
+/* Retrieves the number of imports
+ * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_offset_by_relative_virtual_address(
-     libexe_internal_file_t *internal_file,
-     uint32_t virtual_address,
-     off64_t *offset,
+int libexe_file_get_number_of_imports(
+     libexe_file_t *file,
+     int *number_of_imports,
      libcerror_error_t **error )
 {
-	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_offset_by_relative_virtual_address";
-	size64_t section_size                           = 0;
-	int number_of_sections                          = 0;
-	int section_index                               = 0;
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_number_of_imports";
+	int result                            = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1261,90 +6834,121 @@ int libexe_file_get_offset_by_relative_virtual_address(
 
 		return( -1 );
 	}
-	if( offset == NULL )
+	internal_file = (libexe_internal_file_t *) file;
+
+	if( number_of_imports == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid number of imports.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sections_array,
-	     &number_of_sections,
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sections.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	for( section_index = 0;
-	     section_index < number_of_sections;
-	     section_index++ )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_file->sections_array,
-		     section_index,
-		     (intptr_t **) &section_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve section descriptor: %d.",
-			 function,
-			 section_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
+		 function );
 
-			return( -1 );
-		}
-		if( libexe_section_descriptor_get_data_range(
-		     section_descriptor,
-		     offset,
-		     &section_size,
-		     error ) != 1 )
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		*number_of_imports = 0;
+
+		result = 1;
+	}
+	else
+	{
+		result = libexe_import_table_get_number_of_entries(
+		          import_table,
+		          number_of_imports,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve section descriptor: %d data range.",
-			 function,
-			 section_index );
+			 "%s: unable to retrieve number of import table entries.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( virtual_address >= section_descriptor->virtual_address )
-		 && ( ( virtual_address - section_descriptor->virtual_address ) < section_size ) )
-		{
-			*offset += virtual_address - section_descriptor->virtual_address;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-			return( 1 );
-		}
+		return( -1 );
 	}
-	*offset = 0;
+#endif
+	return( result );
 
-	return( 0 );
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the number of sections
+/* Retrieves a specific import
+ * If the function is imported by ordinal the flags contain LIBEXE_IMPORT_FLAG_BY_ORDINAL
+ * and the ordinal contains the ordinal, otherwise it contains the hint
+ * The flags contain LIBEXE_IMPORT_FLAG_DELAY_LOAD if the function is delay-loaded
  * Returns 1 if successful or -1 on error
  */
-int libexe_file_get_number_of_sections(
+int libexe_file_get_import_by_index(
      libexe_file_t *file,
-     int *number_of_sections,
+     int import_index,
+     int *module_index,
+     uint16_t *ordinal,
+     uint8_t *flags,
      libcerror_error_t **error )
 {
+	libexe_import_table_t *import_table   = NULL;
 	libexe_internal_file_t *internal_file = NULL;
-	static char *function                 = "libexe_file_get_number_of_sections";
+	const char *name                      = NULL;
+	static char *function                 = "libexe_file_get_import_by_index";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1359,35 +6963,112 @@ int libexe_file_get_number_of_sections(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sections_array,
-	     number_of_sections,
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sections.",
+		 "%s: unable to retrieve import table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid import index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          import_index,
+	          module_index,
+	          &name,
+	          ordinal,
+	          flags,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import: %d.",
+		 function,
+		 import_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves a specific section
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the name of a specific import
+ * The name of a function imported by ordinal is only available for well-known ordinals
+ * of ws2_32.dll, wsock32.dll and oleaut32.dll
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the import has no name or -1 on error
  */
-int libexe_file_get_section(
+int libexe_file_get_import_name_size(
      libexe_file_t *file,
-     int section_index,
-     libexe_section_t **section,
+     int import_index,
+     size_t *string_size,
      libcerror_error_t **error )
 {
-	libexe_internal_file_t *internal_file           = NULL;
-	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_section";
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_import_name_size";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1402,75 +7083,110 @@ int libexe_file_get_section(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( section == NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid section.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( *section != NULL )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid section value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->sections_array,
-	     section_index,
-	     (intptr_t **) &section_descriptor,
-	     error ) != 1 )
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid import index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_entry_name_size(
+	          import_table,
+	          import_index,
+	          string_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve section descriptor: %d.",
+		 "%s: unable to retrieve import: %d name size.",
 		 function,
-		 section_index );
+		 import_index );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libexe_section_initialize(
-	     section,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     section_descriptor,
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create section.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves a specific section
- * Returns 1 if successful or -1 on error
+/* Retrieves the name of a specific import
+ * The name of a function imported by ordinal is only available for well-known ordinals
+ * of ws2_32.dll, wsock32.dll and oleaut32.dll
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the import has no name or -1 on error
  */
-int libexe_file_get_section_by_index(
+int libexe_file_get_import_name(
      libexe_file_t *file,
-     int section_index,
-     libexe_section_t **section,
+     int import_index,
+     char *string,
+     size_t string_size,
      libcerror_error_t **error )
 {
-	libexe_internal_file_t *internal_file           = NULL;
-	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_section_by_index";
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_import_name";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1485,78 +7201,109 @@ int libexe_file_get_section_by_index(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( section == NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid section.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( *section != NULL )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid section value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->sections_array,
-	     section_index,
-	     (intptr_t **) &section_descriptor,
-	     error ) != 1 )
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid import index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_import_table_get_entry_name(
+	          import_table,
+	          import_index,
+	          string,
+	          string_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve section descriptor: %d.",
+		 "%s: unable to retrieve import: %d name.",
 		 function,
-		 section_index );
+		 import_index );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libexe_section_initialize(
-	     section,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     section_descriptor,
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create section.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves a specific section by an ASCII formatted name
- * Returns 1 if successful, 0 if no such section or -1 on error
+/* Retrieves the import hash (imphash)
+ * The import hash is a MD5 hash and the size should be at least 16
+ * Delay-loaded imports are not part of the import hash
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libexe_file_get_section_by_name(
+int libexe_file_get_import_hash(
      libexe_file_t *file,
-     const char *string,
-     size_t string_length,
-     libexe_section_t **section,
+     uint8_t *import_hash,
+     size_t size,
      libcerror_error_t **error )
 {
-	libexe_internal_file_t *internal_file           = NULL;
-	libexe_section_descriptor_t *section_descriptor = NULL;
-	static char *function                           = "libexe_file_get_section_by_name";
-	int number_of_sections                          = 0;
-	int section_index                               = 0;
+	libexe_import_table_t *import_table   = NULL;
+	libexe_internal_file_t *internal_file = NULL;
+	static char *function                 = "libexe_file_get_import_hash";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1571,123 +7318,102 @@ int libexe_file_get_section_by_name(
 	}
 	internal_file = (libexe_internal_file_t *) file;
 
-	if( string == NULL )
+	if( import_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string.",
-		 function );
-
-		return( -1 );
-	}
-	if( string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid string length value exceeds maximum.",
+		 "%s: invalid import hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( section == NULL )
+	if( size < (size_t) LIBEXE_MD5_HASH_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid section.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid import hash size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( *section != NULL )
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libexe_internal_file_grab_for_read_with_table(
+	     internal_file,
+	     LIBEXE_DATA_DIRECTORY_IMPORT_TABLE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid section value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sections_array,
-	     &number_of_sections,
-	     error ) != 1 )
+#endif
+	result = libexe_internal_file_get_import_table(
+	          internal_file,
+	          &import_table,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sections.",
+		 "%s: unable to retrieve import table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( section_index = 0;
-	     section_index < number_of_sections;
-	     section_index++ )
+	else if( result != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_file->sections_array,
-		     section_index,
-		     (intptr_t **) &section_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve section descriptor: %d.",
-			 function,
-			 section_index );
+		result = libexe_import_hash_calculate(
+		          import_table,
+		          import_hash,
+		          size,
+		          error );
 
-			return( -1 );
-		}
-		if( section_descriptor == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing section descriptor: %d.",
-			 function,
-			 section_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate import hash.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( string_length + 1 ) == section_descriptor->name_size )
-		{
-			if( narrow_string_compare(
-			     section_descriptor->name,
-			     string,
-			     string_length ) == 0 )
-			{
-				if( libexe_section_initialize(
-				     section,
-				     internal_file->io_handle,
-				     internal_file->file_io_handle,
-				     section_descriptor,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create section.",
-					 function );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-					return( -1 );
-				}
-				return( 1 );
-			}
-		}
+		return( -1 );
 	}
-	return( 0 );
-}
+#endif
+	return( result );
 
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
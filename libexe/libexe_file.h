@@ -25,11 +25,20 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_block_cache.h"
+#include "libexe_debug_data.h"
+#include "libexe_export_table.h"
 #include "libexe_extern.h"
+#include "libexe_import_table.h"
 #include "libexe_io_handle.h"
 #include "libexe_libbfio.h"
 #include "libexe_libcdata.h"
 #include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_memory_map.h"
+#include "libexe_rva_index.h"
+#include "libexe_section.h"
+#include "libexe_section_name_index.h"
 #include "libexe_types.h"
 
 #if defined( __cplusplus )
@@ -56,9 +65,63 @@ struct libexe_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory map
+	 */
+	libexe_memory_map_t *memory_map;
+
+	/* The access flags
+	 */
+	int access_flags;
+
 	/* The sections array
 	 */
 	libcdata_array_t *sections_array;
+
+	/* The relative virtual address (RVA) index
+	 */
+	libexe_rva_index_t *rva_index;
+
+	/* The section name index
+	 */
+	libexe_section_name_index_t *section_name_index;
+
+	/* The borrowed sections
+	 */
+	libexe_internal_section_t *borrowed_sections;
+
+	/* The number of borrowed sections
+	 */
+	int number_of_borrowed_sections;
+
+	/* The export table
+	 */
+	libexe_export_table_t *export_table;
+
+	/* Value to indicate the export table was read
+	 */
+	uint8_t export_table_is_read;
+
+	/* The import table
+	 */
+	libexe_import_table_t *import_table;
+
+	/* Value to indicate the import table was read
+	 */
+	uint8_t import_table_is_read;
+
+	/* The debug data
+	 */
+	libexe_debug_data_t *debug_data;
+
+	/* The section data block cache
+	 */
+	libexe_block_cache_t *block_cache;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBEXE_EXTERN \
@@ -94,6 +157,21 @@ int libexe_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBEXE_EXTERN \
+int libexe_file_open_mmap(
+     libexe_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_open_memory(
+     libexe_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_open_file_io_handle(
      libexe_file_t *file,
@@ -101,16 +179,59 @@ int libexe_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_reopen_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_open_stream_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     int (*callback_function)(
+            int section_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_close(
      libexe_file_t *file,
      libcerror_error_t **error );
 
+int libexe_internal_file_close(
+     libexe_internal_file_t *internal_file,
+     uint8_t retain_buffers,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_reset(
+     libexe_file_t *file,
+     libcerror_error_t **error );
+
 int libexe_file_open_read(
      libexe_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libexe_internal_file_read_stream_sections(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int section_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_file_get_ascii_codepage(
      libexe_file_t *file,
@@ -123,12 +244,112 @@ int libexe_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_open_reads(
+     libexe_file_t *file,
+     int *number_of_reads,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_cache_size(
+     libexe_file_t *file,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_set_cache_size(
+     libexe_file_t *file,
+     size64_t cache_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_cache_statistics(
+     libexe_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_arena_size(
+     libexe_file_t *file,
+     size_t *arena_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_set_arena_size(
+     libexe_file_t *file,
+     size_t arena_size,
+     libcerror_error_t **error );
+
 int libexe_file_get_offset_by_relative_virtual_address(
      libexe_internal_file_t *internal_file,
      uint32_t virtual_address,
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_get_offset_by_rva(
+     libexe_file_t *file,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_translate_rvas(
+     libexe_file_t *file,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_read_ranges(
+     libexe_file_t *file,
+     const libexe_range_t *ranges,
+     size_t number_of_ranges,
+     libcerror_error_t **error );
+
+int libexe_internal_file_set_borrowed_sections(
+     libexe_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libexe_internal_file_get_data_directory_range(
+     libexe_internal_file_t *internal_file,
+     int data_directory_index,
+     off64_t *file_offset,
+     uint32_t *size,
+     libcerror_error_t **error );
+
+int libexe_internal_file_advise_data_ranges(
+     libexe_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libexe_internal_file_get_export_table(
+     libexe_internal_file_t *internal_file,
+     libexe_export_table_t **export_table,
+     libcerror_error_t **error );
+
+int libexe_internal_file_get_import_table(
+     libexe_internal_file_t *internal_file,
+     libexe_import_table_t **import_table,
+     libcerror_error_t **error );
+
+int libexe_internal_file_get_debug_data(
+     libexe_internal_file_t *internal_file,
+     libexe_debug_data_t **debug_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+
+int libexe_internal_file_grab_for_read_with_table(
+     libexe_internal_file_t *internal_file,
+     int data_directory_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT ) */
+
 LIBEXE_EXTERN \
 int libexe_file_get_number_of_sections(
      libexe_file_t *file,
@@ -157,6 +378,149 @@ int libexe_file_get_section_by_name(
      libexe_section_t **section,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_sections_by_name(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     int *number_of_sections,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_section_by_name_and_index(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     int name_section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_borrow_section_by_index(
+     libexe_file_t *file,
+     int section_index,
+     libexe_section_t **section,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_borrow_section_by_name(
+     libexe_file_t *file,
+     const char *string,
+     size_t string_length,
+     libexe_section_t **section,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_exports(
+     libexe_file_t *file,
+     int *number_of_exports,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_export_by_index(
+     libexe_file_t *file,
+     int export_index,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_export_name_size(
+     libexe_file_t *file,
+     int export_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_export_name(
+     libexe_file_t *file,
+     int export_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_export_by_name(
+     libexe_file_t *file,
+     const char *name,
+     size_t name_length,
+     uint32_t *ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_export_by_ordinal(
+     libexe_file_t *file,
+     uint32_t ordinal,
+     uint32_t *relative_virtual_address,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_import_modules(
+     libexe_file_t *file,
+     int *number_of_modules,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_module_by_index(
+     libexe_file_t *file,
+     int module_index,
+     int *first_import_index,
+     int *number_of_imports,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_module_name_size(
+     libexe_file_t *file,
+     int module_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_module_name(
+     libexe_file_t *file,
+     int module_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_number_of_imports(
+     libexe_file_t *file,
+     int *number_of_imports,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_by_index(
+     libexe_file_t *file,
+     int import_index,
+     int *module_index,
+     uint16_t *ordinal,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_name_size(
+     libexe_file_t *file,
+     int import_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_name(
+     libexe_file_t *file,
+     int import_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_file_get_import_hash(
+     libexe_file_t *file,
+     uint8_t *import_hash,
+     size_t size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
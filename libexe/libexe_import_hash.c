@@ -0,0 +1,477 @@
+/*
+ * Import hash functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+
+#define LIBEXE_HAVE_SSE2_LOWER_CASE	1
+
+#endif
+
+#include "libexe_definitions.h"
+#include "libexe_import_hash.h"
+#include "libexe_import_table.h"
+#include "libexe_libcerror.h"
+#include "libexe_md5.h"
+
+/* Updates the MD5 context with the lower case of an ASCII string
+ * The string is converted in chunks on the stack, 16 bytes at a time with SSE2 when available
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_hash_update_lower_case(
+     libexe_md5_context_t *md5_context,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 256 ];
+
+	static char *function = "libexe_import_hash_update_lower_case";
+	size_t buffer_index   = 0;
+	size_t buffer_size    = 0;
+	size_t string_offset  = 0;
+	uint8_t character     = 0;
+
+#if defined( LIBEXE_HAVE_SSE2_LOWER_CASE )
+	__m128i vector_after_z    = _mm_set1_epi8( (char) ( 'Z' + 1 ) );
+	__m128i vector_before_a   = _mm_set1_epi8( (char) ( 'A' - 1 ) );
+	__m128i vector_case_bit   = _mm_set1_epi8( (char) 0x20 );
+	__m128i vector_characters = _mm_setzero_si128();
+	__m128i vector_upper_case = _mm_setzero_si128();
+#endif
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_offset < string_length )
+	{
+		buffer_size = string_length - string_offset;
+
+		if( buffer_size > sizeof( buffer ) )
+		{
+			buffer_size = sizeof( buffer );
+		}
+		buffer_index = 0;
+
+#if defined( LIBEXE_HAVE_SSE2_LOWER_CASE )
+		/* Bytes of 0x80 and above compare as negative and are left unchanged
+		 */
+		while( ( buffer_index + 16 ) <= buffer_size )
+		{
+			vector_characters = _mm_loadu_si128( (const __m128i *) &( string[ string_offset + buffer_index ] ) );
+
+			vector_upper_case = _mm_and_si128(
+			                     _mm_cmpgt_epi8( vector_characters, vector_before_a ),
+			                     _mm_cmplt_epi8( vector_characters, vector_after_z ) );
+
+			vector_characters = _mm_or_si128(
+			                     vector_characters,
+			                     _mm_and_si128( vector_upper_case, vector_case_bit ) );
+
+			_mm_storeu_si128( (__m128i *) &( buffer[ buffer_index ] ), vector_characters );
+
+			buffer_index += 16;
+		}
+#endif
+		while( buffer_index < buffer_size )
+		{
+			character = string[ string_offset + buffer_index ];
+
+			if( ( character >= (uint8_t) 'A' )
+			 && ( character <= (uint8_t) 'Z' ) )
+			{
+				character |= 0x20;
+			}
+			buffer[ buffer_index++ ] = character;
+		}
+		if( libexe_md5_update(
+		     md5_context,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+		string_offset += buffer_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the length of the module name as used in the import hash
+ * A .dll, .ocx or .sys extension is not part of the module name
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_hash_get_module_name_length(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     size_t *hash_module_name_length,
+     libcerror_error_t **error )
+{
+	uint8_t extension[ 3 ];
+
+	static char *function  = "libexe_import_hash_get_module_name_length";
+	size_t extension_index = 0;
+
+	if( module_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module name.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_module_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash module name length.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_module_name_length = module_name_length;
+
+	if( ( module_name_length < 4 )
+	 || ( module_name[ module_name_length - 4 ] != (uint8_t) '.' ) )
+	{
+		return( 1 );
+	}
+	for( extension_index = 0;
+	     extension_index < 3;
+	     extension_index++ )
+	{
+		extension[ extension_index ] = module_name[ module_name_length - 3 + extension_index ] | 0x20;
+	}
+	if( ( ( extension[ 0 ] == (uint8_t) 'd' )
+	  &&  ( extension[ 1 ] == (uint8_t) 'l' )
+	  &&  ( extension[ 2 ] == (uint8_t) 'l' ) )
+	 || ( ( extension[ 0 ] == (uint8_t) 'o' )
+	  &&  ( extension[ 1 ] == (uint8_t) 'c' )
+	  &&  ( extension[ 2 ] == (uint8_t) 'x' ) )
+	 || ( ( extension[ 0 ] == (uint8_t) 's' )
+	  &&  ( extension[ 1 ] == (uint8_t) 'y' )
+	  &&  ( extension[ 2 ] == (uint8_t) 's' ) ) )
+	{
+		*hash_module_name_length = module_name_length - 4;
+	}
+	return( 1 );
+}
+
+/* Calculates the import hash (imphash) of an import table
+ * The import hash is the MD5 of the comma separated list of lower case
+ * "module.function" strings, where the module name has no .dll, .ocx or .sys
+ * extension and functions imported by ordinal without a name from the ordinal
+ * names are named as "ord" followed by the decimal ordinal
+ * The strings are hashed directly from the string pool of the import table
+ * Delay-loaded imports are not part of the import hash
+ * Returns 1 if successful, 0 if the import table has no imports or -1 on error
+ */
+int libexe_import_hash_calculate(
+     libexe_import_table_t *import_table,
+     uint8_t *import_hash,
+     size_t import_hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t ordinal_name[ 8 ];
+
+	libexe_import_entry_t *entry      = NULL;
+	libexe_md5_context_t *md5_context = NULL;
+	const uint8_t *module_name        = NULL;
+	const uint8_t *name               = NULL;
+	static char *function             = "libexe_import_hash_calculate";
+	size_t hash_module_name_length    = 0;
+	size_t module_name_length         = 0;
+	size_t name_length                = 0;
+	uint16_t ordinal                  = 0;
+	uint8_t ordinal_name_index        = 0;
+	uint8_t separator                 = 0;
+	int entry_index                   = 0;
+	int module_index                  = -1;
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_hash_size < (size_t) LIBEXE_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid import hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Delay-loaded imports are not part of the import hash
+	 */
+	for( entry_index = 0;
+	     entry_index < import_table->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( import_table->entries[ entry_index ].flags & LIBEXE_IMPORT_FLAG_DELAY_LOAD ) == 0 )
+		{
+			break;
+		}
+	}
+	if( entry_index >= import_table->number_of_entries )
+	{
+		return( 0 );
+	}
+	if( libexe_md5_initialize(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < import_table->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( import_table->entries[ entry_index ] );
+
+		if( ( entry->flags & LIBEXE_IMPORT_FLAG_DELAY_LOAD ) != 0 )
+		{
+			continue;
+		}
+		if( entry->module_index != module_index )
+		{
+			module_index       = entry->module_index;
+			module_name        = (const uint8_t *) import_table->modules[ module_index ].name;
+			module_name_length = narrow_string_length(
+			                      (const char *) module_name );
+
+			if( libexe_import_hash_get_module_name_length(
+			     module_name,
+			     module_name_length,
+			     &hash_module_name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hash module name length.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		name = (const uint8_t *) entry->name;
+
+		if( name != NULL )
+		{
+			name_length = narrow_string_length(
+			               entry->name );
+		}
+		else if( ( entry->flags & LIBEXE_IMPORT_FLAG_BY_ORDINAL ) != 0 )
+		{
+			/* Format the name as "ord" followed by the decimal ordinal
+			 */
+			ordinal_name[ 0 ] = (uint8_t) 'o';
+			ordinal_name[ 1 ] = (uint8_t) 'r';
+			ordinal_name[ 2 ] = (uint8_t) 'd';
+
+			name_length = 3;
+			ordinal     = entry->ordinal;
+
+			do
+			{
+				name_length++;
+
+				ordinal /= 10;
+			}
+			while( ordinal > 0 );
+
+			ordinal            = entry->ordinal;
+			ordinal_name_index = (uint8_t) name_length;
+
+			do
+			{
+				ordinal_name[ --ordinal_name_index ] = (uint8_t) ( '0' + ( ordinal % 10 ) );
+
+				ordinal /= 10;
+			}
+			while( ordinal > 0 );
+
+			name = ordinal_name;
+		}
+		if( ( name == NULL )
+		 || ( name_length == 0 ) )
+		{
+			continue;
+		}
+		if( separator != 0 )
+		{
+			if( libexe_md5_update(
+			     md5_context,
+			     &separator,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update MD5 context.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		separator = (uint8_t) ',';
+
+		if( libexe_import_hash_update_lower_case(
+		     md5_context,
+		     module_name,
+		     hash_module_name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 context with module name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_md5_update(
+		     md5_context,
+		     (const uint8_t *) ".",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_import_hash_update_lower_case(
+		     md5_context,
+		     name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 context with name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libexe_md5_finalize(
+	     md5_context,
+	     import_hash,
+	     import_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_md5_free(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( md5_context != NULL )
+	{
+		libexe_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,59 @@
+/*
+ * Import hash functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_IMPORT_HASH_H )
+#define _LIBEXE_IMPORT_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_import_table.h"
+#include "libexe_libcerror.h"
+#include "libexe_md5.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libexe_import_hash_update_lower_case(
+     libexe_md5_context_t *md5_context,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int libexe_import_hash_get_module_name_length(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     size_t *hash_module_name_length,
+     libcerror_error_t **error );
+
+int libexe_import_hash_calculate(
+     libexe_import_table_t *import_table,
+     uint8_t *import_hash,
+     size_t import_hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_IMPORT_HASH_H ) */
+
@@ -20,14 +20,20 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libexe_definitions.h"
 #include "libexe_import_table.h"
 #include "libexe_libcerror.h"
 #include "libexe_libcnotify.h"
-#include "libexe_libfcache.h"
-#include "libexe_libfdata.h"
+#include "libexe_ordinal_names.h"
+#include "libexe_rva_reader.h"
+#include "libexe_string_pool.h"
+
+#include "exe_import_table.h"
 
 /* Creates an import table
  * Make sure the value import_table is referencing, is set to NULL
@@ -94,6 +100,19 @@ int libexe_import_table_initialize(
 
 		return( -1 );
 	}
+	if( libexe_string_pool_initialize(
+	     &( ( *import_table )->string_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -115,6 +134,7 @@ int libexe_import_table_free(
      libcerror_error_t **error )
 {
 	static char *function = "libexe_import_table_free";
+	int result            = 1;
 
 	if( import_table == NULL )
 	{
@@ -129,27 +149,178 @@ int libexe_import_table_free(
 	}
 	if( *import_table != NULL )
 	{
+		if( ( *import_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *import_table )->entries );
+		}
+		if( ( *import_table )->modules != NULL )
+		{
+			memory_free(
+			 ( *import_table )->modules );
+		}
+		if( libexe_string_pool_free(
+		     &( ( *import_table )->string_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string pool.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *import_table );
 
 		*import_table = NULL;
 	}
+	return( result );
+}
+
+/* Appends a module to the import table
+ * The name is interned in the string pool of the import table
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_append_module(
+     libexe_import_table_t *import_table,
+     const uint8_t *name,
+     size_t name_length,
+     int *module_index,
+     libcerror_error_t **error )
+{
+	libexe_import_module_t *modules = NULL;
+	const char *pooled_name         = NULL;
+	static char *function           = "libexe_import_table_append_module";
+	uint32_t name_hash              = 0;
+	int number_of_allocated_modules = 0;
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module index.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->number_of_modules >= LIBEXE_MAXIMUM_NUMBER_OF_IMPORT_MODULES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid import table - number of modules value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->number_of_modules >= import_table->number_of_allocated_modules )
+	{
+		if( import_table->number_of_allocated_modules == 0 )
+		{
+			number_of_allocated_modules = 16;
+		}
+		else
+		{
+			number_of_allocated_modules = import_table->number_of_allocated_modules * 2;
+		}
+		modules = (libexe_import_module_t *) memory_reallocate(
+		                                      import_table->modules,
+		                                      sizeof( libexe_import_module_t ) * number_of_allocated_modules );
+
+		if( modules == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize modules.",
+			 function );
+
+			return( -1 );
+		}
+		import_table->modules                     = modules;
+		import_table->number_of_allocated_modules = number_of_allocated_modules;
+	}
+	if( libexe_string_pool_intern(
+	     import_table->string_pool,
+	     name,
+	     name_length,
+	     &pooled_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to intern module name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_ordinal_names_get_module_name_hash(
+	     name,
+	     name_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module name hash.",
+		 function );
+
+		return( -1 );
+	}
+	*module_index = import_table->number_of_modules;
+
+	import_table->modules[ *module_index ].name               = pooled_name;
+	import_table->modules[ *module_index ].name_hash          = name_hash;
+	import_table->modules[ *module_index ].first_import_index = import_table->number_of_entries;
+	import_table->modules[ *module_index ].number_of_imports  = 0;
+
+	import_table->number_of_modules += 1;
+
 	return( 1 );
 }
 
-/* Reads the import table
+/* Appends an entry to the import table
+ * The name is interned in the string pool of the import table, if set
+ * The name of a function imported by ordinal is retrieved from the ordinal names, if not set
  * Returns 1 if successful or -1 on error
  */
-int libexe_import_table_read(
+int libexe_import_table_append_entry(
      libexe_import_table_t *import_table,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
-     uint32_t size,
+     int module_index,
+     const uint8_t *name,
+     size_t name_length,
+     uint16_t ordinal,
+     uint32_t import_address_rva,
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	uint8_t *data         = NULL;
-	static char *function = "libexe_import_table_read";
-	size_t read_count     = 0;
+	libexe_import_entry_t *entries  = NULL;
+	const char *pooled_name         = NULL;
+	static char *function           = "libexe_import_table_append_entry";
+	int entry_index                 = 0;
+	int number_of_allocated_entries = 0;
 
 	if( import_table == NULL )
 	{
@@ -162,87 +333,1296 @@ int libexe_import_table_read(
 
 		return( -1 );
 	}
-	if( ( size == 0 )
-	 || ( size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( ( module_index < 0 )
+	 || ( module_index >= import_table->number_of_modules ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid size value out of bounds.",
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->number_of_entries >= LIBEXE_MAXIMUM_NUMBER_OF_IMPORTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid import table - number of entries value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	data = (uint8_t *) memory_allocate(
-	                    sizeof( uint8_t ) * size );
+	if( import_table->number_of_entries >= import_table->number_of_allocated_entries )
+	{
+		if( import_table->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else
+		{
+			number_of_allocated_entries = import_table->number_of_allocated_entries * 2;
+		}
+		entries = (libexe_import_entry_t *) memory_reallocate(
+		                                     import_table->entries,
+		                                     sizeof( libexe_import_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		import_table->entries                     = entries;
+		import_table->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( name != NULL )
+	{
+		if( libexe_string_pool_intern(
+		     import_table->string_pool,
+		     name,
+		     name_length,
+		     &pooled_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to intern entry name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( flags & LIBEXE_IMPORT_FLAG_BY_ORDINAL ) != 0 )
+	{
+		/* The ordinal names are static and are therefore not interned
+		 */
+		if( libexe_ordinal_names_get_name(
+		     (const uint8_t *) import_table->modules[ module_index ].name,
+		     narrow_string_length(
+		      import_table->modules[ module_index ].name ),
+		     import_table->modules[ module_index ].name_hash,
+		     ordinal,
+		     &pooled_name,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ordinal name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	entry_index = import_table->number_of_entries;
+
+	import_table->entries[ entry_index ].name               = pooled_name;
+	import_table->entries[ entry_index ].import_address_rva = import_address_rva;
+	import_table->entries[ entry_index ].module_index       = module_index;
+	import_table->entries[ entry_index ].ordinal            = ordinal;
+	import_table->entries[ entry_index ].flags              = flags;
+
+	import_table->number_of_entries += 1;
+
+	import_table->modules[ module_index ].number_of_imports += 1;
+
+	return( 1 );
+}
+
+/* Reads the thunks of an import module
+ * The thunks are read from the import name table or, if not set, from the import address table
+ * Reading stops at the terminating empty thunk or at the first thunk that cannot be resolved
+ * The flags are added to the flags of every entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_read_thunks(
+     libexe_import_table_t *import_table,
+     libexe_rva_reader_t *rva_reader,
+     int module_index,
+     uint32_t import_name_table_rva,
+     uint32_t import_address_table_rva,
+     uint16_t optional_header_signature,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	const uint8_t *hint_name_data = NULL;
+	const uint8_t *name           = NULL;
+	const uint8_t *thunk_data     = NULL;
+	static char *function         = "libexe_import_table_read_thunks";
+	size_t hint_name_data_size    = 0;
+	size_t name_length            = 0;
+	size_t thunk_data_offset      = 0;
+	size_t thunk_data_size        = 0;
+	size_t thunk_size             = 0;
+	uint64_t ordinal_flag         = 0;
+	uint64_t thunk_value          = 0;
+	uint32_t hint_name_rva        = 0;
+	uint32_t thunk_rva            = 0;
+	uint16_t hint                 = 0;
+	int result                    = 0;
 
-	if( data == NULL )
+	if( import_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create import table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		thunk_size   = 8;
+		ordinal_flag = 0x8000000000000000ULL;
+	}
+	else
+	{
+		thunk_size   = 4;
+		ordinal_flag = 0x80000000UL;
+	}
+	if( import_name_table_rva != 0 )
+	{
+		thunk_rva = import_name_table_rva;
+	}
+	else
+	{
+		thunk_rva = import_address_table_rva;
+	}
+	result = libexe_rva_reader_get_data(
+	          rva_reader,
+	          thunk_rva,
+	          &thunk_data,
+	          &thunk_data_size,
+	          error );
+
+	if( result == -1 )
 	{
-		libcnotify_printf(
-		 "%s: reading import table at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thunk data at RVA: 0x%08" PRIx32 ".",
 		 function,
-		 file_offset,
-		 file_offset );
+		 thunk_rva );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	while( ( thunk_data_offset + thunk_size ) <= thunk_data_size )
+	{
+		if( thunk_size == 8 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( thunk_data[ thunk_data_offset ] ),
+			 thunk_value );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( thunk_data[ thunk_data_offset ] ),
+			 thunk_value );
+		}
+		if( ( thunk_value == 0 )
+		 || ( import_table->number_of_entries >= LIBEXE_MAXIMUM_NUMBER_OF_IMPORTS ) )
+		{
+			break;
+		}
+		if( ( thunk_value & ordinal_flag ) != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: ordinal\t\t\t\t\t: %" PRIu64 "\n",
+				 function,
+				 thunk_value & 0x0000ffffUL );
+			}
+#endif
+			if( libexe_import_table_append_entry(
+			     import_table,
+			     module_index,
+			     NULL,
+			     0,
+			     (uint16_t) ( thunk_value & 0x0000ffffUL ),
+			     (uint32_t) ( import_address_table_rva + thunk_data_offset ),
+			     LIBEXE_IMPORT_FLAG_BY_ORDINAL | flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append import entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* The hint/name RVA is a 31-bit value
+			 */
+			if( ( thunk_value & 0xffffffff80000000ULL ) != 0 )
+			{
+				break;
+			}
+			hint_name_rva = (uint32_t) thunk_value;
+
+			result = libexe_rva_reader_get_data(
+			          rva_reader,
+			          hint_name_rva,
+			          &hint_name_data,
+			          &hint_name_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hint/name data at RVA: 0x%08" PRIx32 ".",
+				 function,
+				 hint_name_rva );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( hint_name_data_size < 2 ) )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 hint_name_data,
+			 hint );
+
+			result = libexe_rva_reader_get_string(
+			          rva_reader,
+			          hint_name_rva + 2,
+			          &name,
+			          &name_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name at RVA: 0x%08" PRIx32 ".",
+				 function,
+				 hint_name_rva + 2 );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: hint\t\t\t\t\t\t: %" PRIu16 "\n",
+				 function,
+				 hint );
+
+				libcnotify_printf(
+				 "%s: name\t\t\t\t\t\t: %.*s\n",
+				 function,
+				 (int) name_length,
+				 (const char *) name );
+			}
+#endif
+			if( libexe_import_table_append_entry(
+			     import_table,
+			     module_index,
+			     name,
+			     name_length,
+			     hint,
+			     (uint32_t) ( import_address_table_rva + thunk_data_offset ),
+			     flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append import entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		thunk_data_offset += thunk_size;
 	}
+	return( 1 );
+}
+
+/* Reads the import table
+ * The import descriptors are read until the terminating empty descriptor
+ * or the first descriptor of which the module name cannot be resolved
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_read(
+     libexe_import_table_t *import_table,
+     libexe_rva_reader_t *rva_reader,
+     uint16_t optional_header_signature,
+     uint32_t virtual_address,
+     libcerror_error_t **error )
+{
+	const uint8_t *data               = NULL;
+	const uint8_t *name               = NULL;
+	static char *function             = "libexe_import_table_read";
+	size_t data_offset                = 0;
+	size_t data_size                  = 0;
+	size_t name_length                = 0;
+	uint32_t import_address_table_rva = 0;
+	uint32_t import_name_table_rva    = 0;
+	uint32_t name_rva                 = 0;
+	int module_index                  = 0;
+	int result                        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit              = 0;
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              size,
-	              (off64_t) file_offset,
-	              error );
 
-	if( read_count != (ssize_t) size )
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->number_of_modules != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid import table - modules value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_reader_get_data(
+	          rva_reader,
+	          virtual_address,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read import table at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve import table data at RVA: 0x%08" PRIx32 ".",
 		 function,
-		 file_offset,
-		 file_offset );
+		 virtual_address );
 
-		goto on_error;
+		return( -1 );
 	}
+	while( ( data_offset + sizeof( exe_import_descriptor_t ) ) <= data_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_import_descriptor_t *) &( data[ data_offset ] ) )->import_name_table_rva,
+		 import_name_table_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_import_descriptor_t *) &( data[ data_offset ] ) )->name_rva,
+		 name_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_import_descriptor_t *) &( data[ data_offset ] ) )->import_address_table_rva,
+		 import_address_table_rva );
+
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: import name table RVA\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 import_name_table_rva );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_import_descriptor_t *) &( data[ data_offset ] ) )->creation_time,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: creation time\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (exe_import_descriptor_t *) &( data[ data_offset ] ) )->forwarder_chain,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: forwarder chain\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+
+			libcnotify_printf(
+			 "%s: name RVA\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 name_rva );
+
+			libcnotify_printf(
+			 "%s: import address table RVA\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 import_address_table_rva );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		data_offset += sizeof( exe_import_descriptor_t );
+
+		if( ( name_rva == 0 )
+		 && ( import_address_table_rva == 0 ) )
+		{
+			break;
+		}
+		if( import_table->number_of_modules >= LIBEXE_MAXIMUM_NUMBER_OF_IMPORT_MODULES )
+		{
+			break;
+		}
+		result = libexe_rva_reader_get_string(
+		          rva_reader,
+		          name_rva,
+		          &name,
+		          &name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module name at RVA: 0x%08" PRIx32 ".",
+			 function,
+			 name_rva );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libexe_import_table_append_module(
+		     import_table,
+		     name,
+		     name_length,
+		     &module_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append import module.",
+			 function );
+
+			return( -1 );
+		}
+		if( libexe_import_table_read_thunks(
+		     import_table,
+		     rva_reader,
+		     module_index,
+		     import_name_table_rva,
+		     import_address_table_rva,
+		     optional_header_signature,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read thunks of import module: %d.",
+			 function,
+			 module_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the delay-load import table
+ * The delay-load import modules and entries are appended to the import table
+ * and the entries are flagged with LIBEXE_IMPORT_FLAG_DELAY_LOAD
+ * Descriptors that contain virtual addresses instead of RVAs, as created by older
+ * linkers, or of which the RVAs cannot be resolved are ignored. If the delay-load
+ * import table cannot be read the modules and entries appended so far are removed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_read_delay_imports(
+     libexe_import_table_t *import_table,
+     libexe_rva_reader_t *rva_reader,
+     uint16_t optional_header_signature,
+     uint32_t virtual_address,
+     libcerror_error_t **error )
+{
+	exe_delay_import_descriptor_t *descriptor = NULL;
+	const uint8_t *data                       = NULL;
+	const uint8_t *name                       = NULL;
+	const uint8_t *thunk_data                 = NULL;
+	static char *function                     = "libexe_import_table_read_delay_imports";
+	size_t data_offset                        = 0;
+	size_t data_size                          = 0;
+	size_t name_length                        = 0;
+	size_t thunk_data_size                    = 0;
+	uint32_t attributes                       = 0;
+	uint32_t import_address_table_rva         = 0;
+	uint32_t import_name_table_rva            = 0;
+	uint32_t name_rva                         = 0;
+	int module_index                          = 0;
+	int number_of_entries                     = 0;
+	int number_of_modules                     = 0;
+	int result                                = 0;
+
+	if( import_table == NULL )
 	{
-		libcnotify_printf(
-		 "%s: import table:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
 		 function );
-		libcnotify_print_data(
-		 data,
-		 (size_t) size,
-		 0 );
+
+		return( -1 );
+	}
+	number_of_entries = import_table->number_of_entries;
+	number_of_modules = import_table->number_of_modules;
+
+	result = libexe_rva_reader_get_data(
+	          rva_reader,
+	          virtual_address,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve delay-load import table data at RVA: 0x%08" PRIx32 ".",
+		 function,
+		 virtual_address );
+
+		goto on_error;
 	}
+	while( ( data_offset + sizeof( exe_delay_import_descriptor_t ) ) <= data_size )
+	{
+		descriptor = (exe_delay_import_descriptor_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 descriptor->attributes,
+		 attributes );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 descriptor->name_rva,
+		 name_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 descriptor->import_address_table_rva,
+		 import_address_table_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 descriptor->import_name_table_rva,
+		 import_name_table_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: attributes\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 attributes );
+
+			libcnotify_printf(
+			 "%s: name RVA\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 name_rva );
+
+			libcnotify_printf(
+			 "%s: import address table RVA\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 import_address_table_rva );
+
+			libcnotify_printf(
+			 "%s: import name table RVA\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 import_name_table_rva );
+
+			libcnotify_printf(
+			 "\n" );
+		}
 #endif
-	/* TODO extract values */
+		data_offset += sizeof( exe_delay_import_descriptor_t );
 
-	memory_free(
-	 data );
+		if( name_rva == 0 )
+		{
+			break;
+		}
+		if( import_table->number_of_modules >= LIBEXE_MAXIMUM_NUMBER_OF_IMPORT_MODULES )
+		{
+			break;
+		}
+		if( ( attributes & 0x00000001UL ) == 0 )
+		{
+			continue;
+		}
+		/* Descriptors of which the import name table cannot be resolved are ignored
+		 */
+		result = libexe_rva_reader_get_data(
+		          rva_reader,
+		          import_name_table_rva,
+		          &thunk_data,
+		          &thunk_data_size,
+		          error );
 
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve import name table data at RVA: 0x%08" PRIx32 ".",
+			 function,
+			 import_name_table_rva );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		result = libexe_rva_reader_get_string(
+		          rva_reader,
+		          name_rva,
+		          &name,
+		          &name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module name at RVA: 0x%08" PRIx32 ".",
+			 function,
+			 name_rva );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libexe_import_table_append_module(
+		     import_table,
+		     name,
+		     name_length,
+		     &module_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append delay-load import module.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_import_table_read_thunks(
+		     import_table,
+		     rva_reader,
+		     module_index,
+		     import_name_table_rva,
+		     import_address_table_rva,
+		     optional_header_signature,
+		     LIBEXE_IMPORT_FLAG_DELAY_LOAD,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read thunks of delay-load import module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( data != NULL )
-	{
-		memory_free(
-		 data );
-	}
+	import_table->number_of_entries = number_of_entries;
+	import_table->number_of_modules = number_of_modules;
+
 	return( -1 );
 }
 
+/* Retrieves the number of modules
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_number_of_modules(
+     libexe_import_table_t *import_table,
+     int *number_of_modules,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_number_of_modules";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_modules == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of modules.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_modules = import_table->number_of_modules;
+
+	return( 1 );
+}
+
+/* Retrieves a specific module
+ * The name is owned by the import table and remains valid until the import table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_module_by_index(
+     libexe_import_table_t *import_table,
+     int module_index,
+     const char **name,
+     int *first_import_index,
+     int *number_of_imports,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_module_by_index";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( module_index < 0 )
+	 || ( module_index >= import_table->number_of_modules ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_import_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first import index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_imports == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of imports.",
+		 function );
+
+		return( -1 );
+	}
+	*name               = import_table->modules[ module_index ].name;
+	*first_import_index = import_table->modules[ module_index ].first_import_index;
+	*number_of_imports  = import_table->modules[ module_index ].number_of_imports;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the name of a specific module
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_module_name_size(
+     libexe_import_table_t *import_table,
+     int module_index,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_module_name_size";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( module_index < 0 )
+	 || ( module_index >= import_table->number_of_modules ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = narrow_string_length(
+	                import_table->modules[ module_index ].name ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a specific module
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_module_name(
+     libexe_import_table_t *import_table,
+     int module_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_module_name";
+	size_t name_size      = 0;
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( module_index < 0 )
+	 || ( module_index >= import_table->number_of_modules ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = narrow_string_length(
+	             import_table->modules[ module_index ].name ) + 1;
+
+	if( string_size < name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string,
+	     import_table->modules[ module_index ].name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_number_of_entries(
+     libexe_import_table_t *import_table,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_number_of_entries";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = import_table->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * The name is NULL if the function is imported by ordinal and not in the ordinal names
+ * The name is owned by the import table and remains valid until the import table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_import_table_get_entry_by_index(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     int *module_index,
+     const char **name,
+     uint16_t *ordinal,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_entry_by_index";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= import_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module index.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ordinal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ordinal.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*module_index = import_table->entries[ entry_index ].module_index;
+	*name         = import_table->entries[ entry_index ].name;
+	*ordinal      = import_table->entries[ entry_index ].ordinal;
+	*flags        = import_table->entries[ entry_index ].flags;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the name of a specific entry
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if the entry has no name or -1 on error
+ */
+int libexe_import_table_get_entry_name_size(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_entry_name_size";
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= import_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->entries[ entry_index ].name == NULL )
+	{
+		return( 0 );
+	}
+	*string_size = narrow_string_length(
+	                import_table->entries[ entry_index ].name ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a specific entry
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the entry has no name or -1 on error
+ */
+int libexe_import_table_get_entry_name(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_import_table_get_entry_name";
+	size_t name_size      = 0;
+
+	if( import_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid import table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= import_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( import_table->entries[ entry_index ].name == NULL )
+	{
+		return( 0 );
+	}
+	name_size = narrow_string_length(
+	             import_table->entries[ entry_index ].name ) + 1;
+
+	if( string_size < name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     string,
+	     import_table->entries[ entry_index ].name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -27,18 +27,96 @@
 
 #include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
+#include "libexe_rva_index.h"
+#include "libexe_rva_reader.h"
+#include "libexe_string_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libexe_import_module libexe_import_module_t;
+
+struct libexe_import_module
+{
+	/* The name
+	 * The name is stored in the string pool of the import table
+	 */
+	const char *name;
+
+	/* The name hash
+	 * The hash is used to look up the names of functions imported by ordinal
+	 */
+	uint32_t name_hash;
+
+	/* The index of the first import of the module
+	 */
+	int first_import_index;
+
+	/* The number of imports of the module
+	 */
+	int number_of_imports;
+};
+
+typedef struct libexe_import_entry libexe_import_entry_t;
+
+struct libexe_import_entry
+{
+	/* The name
+	 * The name is stored in the string pool of the import table
+	 * If the function is imported by ordinal the name is retrieved
+	 * from the ordinal names, if available, and NULL otherwise
+	 */
+	const char *name;
+
+	/* The import address table entry relative virtual address (RVA)
+	 */
+	uint32_t import_address_rva;
+
+	/* The index of the module
+	 */
+	int module_index;
+
+	/* The ordinal if the function is imported by ordinal, otherwise the hint
+	 */
+	uint16_t ordinal;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
 typedef struct libexe_import_table libexe_import_table_t;
 
 struct libexe_import_table
 {
-	/* Dummy
+	/* The string pool the module and function names are interned in
+	 */
+	libexe_string_pool_t *string_pool;
+
+	/* The modules
+	 */
+	libexe_import_module_t *modules;
+
+	/* The number of modules
+	 */
+	int number_of_modules;
+
+	/* The number of allocated modules
+	 */
+	int number_of_allocated_modules;
+
+	/* The entries
+	 */
+	libexe_import_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
 	 */
-	int dummy;
+	int number_of_allocated_entries;
 };
 
 int libexe_import_table_initialize(
@@ -49,11 +127,98 @@ int libexe_import_table_free(
      libexe_import_table_t **import_table,
      libcerror_error_t **error );
 
+int libexe_import_table_append_module(
+     libexe_import_table_t *import_table,
+     const uint8_t *name,
+     size_t name_length,
+     int *module_index,
+     libcerror_error_t **error );
+
+int libexe_import_table_append_entry(
+     libexe_import_table_t *import_table,
+     int module_index,
+     const uint8_t *name,
+     size_t name_length,
+     uint16_t ordinal,
+     uint32_t import_address_rva,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libexe_import_table_read_thunks(
+     libexe_import_table_t *import_table,
+     libexe_rva_reader_t *rva_reader,
+     int module_index,
+     uint32_t import_name_table_rva,
+     uint32_t import_address_table_rva,
+     uint16_t optional_header_signature,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 int libexe_import_table_read(
      libexe_import_table_t *import_table,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
-     uint32_t size,
+     libexe_rva_reader_t *rva_reader,
+     uint16_t optional_header_signature,
+     uint32_t virtual_address,
+     libcerror_error_t **error );
+
+int libexe_import_table_read_delay_imports(
+     libexe_import_table_t *import_table,
+     libexe_rva_reader_t *rva_reader,
+     uint16_t optional_header_signature,
+     uint32_t virtual_address,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_number_of_modules(
+     libexe_import_table_t *import_table,
+     int *number_of_modules,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_module_by_index(
+     libexe_import_table_t *import_table,
+     int module_index,
+     const char **name,
+     int *first_import_index,
+     int *number_of_imports,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_module_name_size(
+     libexe_import_table_t *import_table,
+     int module_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_module_name(
+     libexe_import_table_t *import_table,
+     int module_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_number_of_entries(
+     libexe_import_table_t *import_table,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_entry_by_index(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     int *module_index,
+     const char **name,
+     uint16_t *ordinal,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_entry_name_size(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libexe_import_table_get_entry_name(
+     libexe_import_table_t *import_table,
+     int entry_index,
+     char *string,
+     size_t string_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -26,6 +26,11 @@
 #include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libexe_arena.h"
 #include "libexe_codepage.h"
 #include "libexe_coff_header.h"
 #include "libexe_coff_optional_header.h"
@@ -42,10 +47,11 @@
 #include "libexe_mz_header.h"
 #include "libexe_ne_header.h"
 #include "libexe_section_descriptor.h"
-#include "libexe_unused.h"
 
 #include "exe_file_header.h"
+#include "exe_le_header.h"
 #include "exe_mz_header.h"
+#include "exe_ne_header.h"
 #include "exe_pe_header.h"
 #include "exe_section_table.h"
 
@@ -200,6 +206,22 @@ int libexe_io_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *io_handle )->arena != NULL )
+		{
+			if( libexe_arena_free(
+			     &( ( *io_handle )->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
@@ -276,8 +298,301 @@ int libexe_io_handle_clear(
 			return( -1 );
 		}
 	}
+	if( libexe_io_handle_free_header_data(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free header data.",
+		 function );
+
+		return( -1 );
+	}
 	io_handle->executable_type = LIBEXE_EXECUTABLE_TYPE_MZ;
 	io_handle->ascii_codepage  = LIBEXE_CODEPAGE_WINDOWS_1252;
+	io_handle->file_data       = NULL;
+	io_handle->file_data_size  = 0;
+	io_handle->is_stream       = 0;
+	io_handle->number_of_reads = 0;
+
+	return( 1 );
+}
+
+/* Reads the header data
+ * The header data is a prefix of the file that is read in blocks and only grown
+ * when a header extends beyond it, so that the headers are parsed from memory
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_read_header_data(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t header_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *header_data  = NULL;
+	static char *function = "libexe_io_handle_read_header_data";
+	size64_t file_size    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_data_size <= io_handle->header_data_size )
+	{
+		return( 1 );
+	}
+	if( header_data_size > (size_t) LIBEXE_MAXIMUM_HEADER_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_data != NULL )
+	{
+		if( header_data_size > io_handle->file_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: file too small to contain header data of size: %" PRIzd ".",
+			 function,
+			 header_data_size );
+
+			return( -1 );
+		}
+		/* When the file data is in memory the headers are parsed in place
+		 */
+		io_handle->header_data      = (uint8_t *) io_handle->file_data;
+		io_handle->header_data_size = io_handle->file_data_size;
+
+		return( 1 );
+	}
+	/* The size of a stream is not known in advance
+	 */
+	if( io_handle->is_stream == 0 )
+	{
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size64_t) header_data_size > file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: file too small to contain header data of size: %" PRIzd ".",
+			 function,
+			 header_data_size );
+
+			return( -1 );
+		}
+	}
+	/* Round up to the block size to read ahead of the requested size
+	 */
+	read_size = header_data_size / LIBEXE_HEADER_DATA_BLOCK_SIZE;
+
+	if( ( header_data_size % LIBEXE_HEADER_DATA_BLOCK_SIZE ) != 0 )
+	{
+		read_size += 1;
+	}
+	read_size *= LIBEXE_HEADER_DATA_BLOCK_SIZE;
+
+	if( ( io_handle->is_stream == 0 )
+	 && ( (size64_t) read_size > file_size ) )
+	{
+		read_size = (size_t) file_size;
+	}
+	if( io_handle->arena != NULL )
+	{
+		/* Memory allocated from an arena cannot be resized, the header data
+		 * read so far is copied and the previous copy is released when the
+		 * arena is reset
+		 */
+		if( libexe_arena_allocate(
+		     io_handle->arena,
+		     sizeof( uint8_t ) * read_size,
+		     (void **) &header_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize header data.",
+			 function );
+
+			return( -1 );
+		}
+		if( io_handle->header_data_size > 0 )
+		{
+			if( memory_copy(
+			     header_data,
+			     io_handle->header_data,
+			     io_handle->header_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy header data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		header_data = (uint8_t *) memory_reallocate(
+		                           io_handle->header_data,
+		                           sizeof( uint8_t ) * read_size );
+
+		if( header_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	io_handle->header_data = header_data;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading header data at offset: %" PRIzd " (0x%08" PRIzx ") of size: %" PRIzd "\n",
+		 function,
+		 io_handle->header_data_size,
+		 io_handle->header_data_size,
+		 read_size - io_handle->header_data_size );
+	}
+#endif
+	/* Only the part of the header data that was not read before is read
+	 */
+	if( io_handle->is_stream != 0 )
+	{
+		/* The stream is positioned at the end of the header data read so far,
+		 * the read ahead is allowed to stop at the end of the stream
+		 */
+		read_count = libexe_io_handle_read_stream_data(
+		              io_handle,
+		              file_io_handle,
+		              &( io_handle->header_data[ io_handle->header_data_size ] ),
+		              read_size - io_handle->header_data_size,
+		              error );
+
+		if( read_count < (ssize_t) ( header_data_size - io_handle->header_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: stream too small to contain header data of size: %" PRIzd ".",
+			 function,
+			 header_data_size );
+
+			return( -1 );
+		}
+		io_handle->header_data_size += (size_t) read_count;
+
+		return( 1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              &( io_handle->header_data[ io_handle->header_data_size ] ),
+	              read_size - io_handle->header_data_size,
+	              (off64_t) io_handle->header_data_size,
+	              error );
+
+	io_handle->number_of_reads += 1;
+
+	if( read_count != (ssize_t) ( read_size - io_handle->header_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data at offset: %" PRIzd " (0x%08" PRIzx ").",
+		 function,
+		 io_handle->header_data_size,
+		 io_handle->header_data_size );
+
+		return( -1 );
+	}
+	io_handle->header_data_size = read_size;
+
+	return( 1 );
+}
+
+/* Frees the header data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_free_header_data(
+     libexe_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_io_handle_free_header_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->header_data != NULL )
+	{
+		/* Memory allocated from an arena is released when the arena is reset
+		 * and header data that refers to the file data is not allocated
+		 */
+		if( ( io_handle->arena == NULL )
+		 && ( io_handle->header_data != io_handle->file_data ) )
+		{
+			memory_free(
+			 io_handle->header_data );
+		}
+		io_handle->header_data = NULL;
+	}
+	io_handle->header_data_size     = 0;
+	io_handle->section_table_offset = 0;
 
 	return( 1 );
 }
@@ -294,6 +609,32 @@ int libexe_io_handle_read_file_header(
 	libexe_mz_header_t *mz_header   = NULL;
 	static char *function           = "libexe_io_handle_read_file_header";
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     sizeof( exe_mz_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data.",
+		 function );
+
+		goto on_error;
+	}
 	if( libexe_mz_header_initialize(
 	     &mz_header,
 	     error ) != 1 )
@@ -307,10 +648,10 @@ int libexe_io_handle_read_file_header(
 
 		goto on_error;
 	}
-	if( libexe_mz_header_read_file_io_handle(
+	if( libexe_mz_header_read_data(
 	     mz_header,
-	     file_io_handle,
-	     0,
+	     io_handle->header_data,
+	     io_handle->header_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -379,10 +720,8 @@ int libexe_io_handle_read_extended_header(
      uint16_t *number_of_sections,
      libcerror_error_t **error )
 {
-	uint8_t extended_header_data[ 2 ];
-
-	static char *function = "libexe_io_handle_read_extended_header";
-	ssize_t read_count    = 0;
+	uint8_t *extended_header_data = NULL;
+	static char *function         = "libexe_io_handle_read_extended_header";
 
 	if( io_handle == NULL )
 	{
@@ -395,6 +734,17 @@ int libexe_io_handle_read_extended_header(
 
 		return( -1 );
 	}
+	if( extended_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extended header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -405,14 +755,11 @@ int libexe_io_handle_read_extended_header(
 		 extended_header_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              extended_header_data,
-	              2,
-	              (off64_t) extended_header_offset,
-	              error );
-
-	if( read_count != 2 )
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     (size_t) extended_header_offset + 2,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -425,6 +772,8 @@ int libexe_io_handle_read_extended_header(
 
 		return( -1 );
 	}
+	extended_header_data = &( io_handle->header_data[ extended_header_offset ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -437,7 +786,6 @@ int libexe_io_handle_read_extended_header(
 		 0 );
 	}
 #endif
-/* TODO pass extended header, so it is read once */
 	if( ( extended_header_data[ 0 ] == (uint8_t) 'L' )
 	 && ( extended_header_data[ 1 ] == (uint8_t) 'E' ) )
 	{
@@ -518,15 +866,13 @@ int libexe_io_handle_read_extended_header(
 int libexe_io_handle_read_le_header(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint32_t le_header_offset LIBEXE_ATTRIBUTE_UNUSED,
+     uint32_t le_header_offset,
      uint16_t *number_of_sections,
      libcerror_error_t **error )
 {
 	libexe_le_header_t *le_header = NULL;
 	static char *function         = "libexe_io_handle_read_le_header";
 
-	LIBEXE_UNREFERENCED_PARAMETER( le_header_offset )
-
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -549,6 +895,32 @@ int libexe_io_handle_read_le_header(
 
 		return( -1 );
 	}
+	if( le_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - sizeof( exe_le_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid LE header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     (size_t) le_header_offset + sizeof( exe_le_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data.",
+		 function );
+
+		goto on_error;
+	}
 	if( libexe_le_header_initialize(
 	     &le_header,
 	     error ) != 1 )
@@ -562,10 +934,10 @@ int libexe_io_handle_read_le_header(
 
 		goto on_error;
 	}
-	if( libexe_le_header_read_file_io_handle(
+	if( libexe_le_header_read_data(
 	     le_header,
-	     file_io_handle,
-	     0,
+	     &( io_handle->header_data[ le_header_offset ] ),
+	     sizeof( exe_le_header_t ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -612,15 +984,13 @@ on_error:
 int libexe_io_handle_read_ne_header(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint32_t ne_header_offset LIBEXE_ATTRIBUTE_UNUSED,
+     uint32_t ne_header_offset,
      uint16_t *number_of_sections,
      libcerror_error_t **error )
 {
 	libexe_ne_header_t *ne_header = NULL;
 	static char *function         = "libexe_io_handle_read_ne_header";
 
-	LIBEXE_UNREFERENCED_PARAMETER( ne_header_offset )
-
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -643,8 +1013,34 @@ int libexe_io_handle_read_ne_header(
 
 		return( -1 );
 	}
-	if( libexe_ne_header_initialize(
-	     &ne_header,
+	if( ne_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - sizeof( exe_ne_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid NE header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     (size_t) ne_header_offset + sizeof( exe_ne_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libexe_ne_header_initialize(
+	     &ne_header,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -656,10 +1052,10 @@ int libexe_io_handle_read_ne_header(
 
 		goto on_error;
 	}
-	if( libexe_ne_header_read_file_io_handle(
+	if( libexe_ne_header_read_data(
 	     ne_header,
-	     file_io_handle,
-	     0,
+	     &( io_handle->header_data[ ne_header_offset ] ),
+	     sizeof( exe_ne_header_t ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -710,11 +1106,10 @@ int libexe_io_handle_read_pe_header(
      uint16_t *number_of_sections,
      libcerror_error_t **error )
 {
-	exe_pe_header_t pe_header;
-
-	static char *function = "libexe_io_handle_read_pe_header";
-	ssize_t read_count    = 0;
-	off64_t file_offset   = 0;
+	exe_pe_header_t *pe_header = NULL;
+	static char *function      = "libexe_io_handle_read_pe_header";
+	size_t header_data_offset  = 0;
+	size_t header_data_size    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -738,6 +1133,17 @@ int libexe_io_handle_read_pe_header(
 
 		return( -1 );
 	}
+	if( pe_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - sizeof( exe_pe_header_t ) - sizeof( exe_coff_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid PE header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -748,14 +1154,13 @@ int libexe_io_handle_read_pe_header(
 		 pe_header_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              (uint8_t *) &pe_header,
-	              sizeof( exe_pe_header_t ),
-	              (off64_t) pe_header_offset,
-	              error );
+	header_data_offset = (size_t) pe_header_offset;
 
-	if( read_count != (ssize_t) sizeof( exe_pe_header_t ) )
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     header_data_offset + sizeof( exe_pe_header_t ) + sizeof( exe_coff_header_t ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -766,8 +1171,10 @@ int libexe_io_handle_read_pe_header(
 		 pe_header_offset,
 		 pe_header_offset );
 
-		return( -1 );
+		goto on_error;
 	}
+	pe_header = (exe_pe_header_t *) &( io_handle->header_data[ header_data_offset ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -775,13 +1182,13 @@ int libexe_io_handle_read_pe_header(
 		 "%s: PE header:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &pe_header,
+		 (uint8_t *) pe_header,
 		 sizeof( exe_pe_header_t ),
 		 0 );
 	}
 #endif
 	if( memory_compare(
-	     pe_header.signature,
+	     pe_header->signature,
 	     exe_pe_signature,
 	     4 ) != 0 )
 	{
@@ -792,7 +1199,7 @@ int libexe_io_handle_read_pe_header(
 		 "%s: invalid signature.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -800,17 +1207,20 @@ int libexe_io_handle_read_pe_header(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t: %c%c\\x%" PRIx8 "\\x%" PRIx8 "\n",
 		 function,
-		 pe_header.signature[ 0 ],
-		 pe_header.signature[ 1 ],
-		 pe_header.signature[ 2 ],
-		 pe_header.signature[ 3 ] );
+		 pe_header->signature[ 0 ],
+		 pe_header->signature[ 1 ],
+		 pe_header->signature[ 2 ],
+		 pe_header->signature[ 3 ] );
 
 		libcnotify_printf(
 		 "\n" );
 	}
 #endif
+	header_data_offset += sizeof( exe_pe_header_t );
+
 	if( libexe_coff_header_initialize(
 	     &( io_handle->coff_header ),
+	     io_handle->arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -822,12 +1232,10 @@ int libexe_io_handle_read_pe_header(
 
 		goto on_error;
 	}
-	file_offset = pe_header_offset + sizeof( exe_pe_header_t );
-
-	if( libexe_coff_header_read_file_io_handle(
+	if( libexe_coff_header_read_data(
 	     io_handle->coff_header,
-	     file_io_handle,
-	     file_offset,
+	     &( io_handle->header_data[ header_data_offset ] ),
+	     sizeof( exe_coff_header_t ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -839,14 +1247,37 @@ int libexe_io_handle_read_pe_header(
 
 		goto on_error;
 	}
-	file_offset += sizeof( exe_coff_header_t );
+	header_data_offset += sizeof( exe_coff_header_t );
 
 	*number_of_sections = io_handle->coff_header->number_of_sections;
 
+	/* Make sure the optional header and the section table are read
+	 * with a single read if they extend beyond the header data
+	 */
+	header_data_size = header_data_offset
+	                 + io_handle->coff_header->optional_header_size
+	                 + ( sizeof( exe_section_table_entry_t ) * io_handle->coff_header->number_of_sections );
+
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     header_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read COFF optional header and section table data.",
+		 function );
+
+		goto on_error;
+	}
 	if( io_handle->coff_header->optional_header_size > 0 )
 	{
 		if( libexe_coff_optional_header_initialize(
 		     &( io_handle->coff_optional_header ),
+		     io_handle->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -858,11 +1289,10 @@ int libexe_io_handle_read_pe_header(
 
 			goto on_error;
 		}
-		if( libexe_coff_optional_header_read_file_io_handle(
+		if( libexe_coff_optional_header_read_data(
 		     io_handle->coff_optional_header,
-		     file_io_handle,
-		     file_offset,
-		     io_handle->coff_header->optional_header_size,
+		     &( io_handle->header_data[ header_data_offset ] ),
+		     (size_t) io_handle->coff_header->optional_header_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -874,8 +1304,10 @@ int libexe_io_handle_read_pe_header(
 
 			goto on_error;
 		}
+		header_data_offset += io_handle->coff_header->optional_header_size;
 	}
-	io_handle->executable_type = LIBEXE_EXECUTABLE_TYPE_PE_COFF;
+	io_handle->section_table_offset = header_data_offset;
+	io_handle->executable_type      = LIBEXE_EXECUTABLE_TYPE_PE_COFF;
 
 	return( 1 );
 
@@ -906,11 +1338,9 @@ int libexe_io_handle_read_section_table(
      libcerror_error_t **error )
 {
 	libexe_section_descriptor_t *section_descriptor = NULL;
-	uint8_t *section_table                          = NULL;
 	uint8_t *section_table_data                     = NULL;
 	static char *function                           = "libexe_io_handle_read_section_table";
 	size_t section_table_size                       = 0;
-	ssize_t read_count                              = 0;
 	uint32_t section_data_offset                    = 0;
 	uint32_t section_data_size                      = 0;
 	int entry_index                                 = 0;
@@ -947,27 +1377,13 @@ int libexe_io_handle_read_section_table(
 
 		return( -1 );
 	}
-	section_table = (uint8_t *) memory_allocate(
-	                             sizeof( uint8_t ) * section_table_size );
-
-	if( section_table == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create section table.",
-		 function );
-
-		goto on_error;
-	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              section_table,
-	              section_table_size,
-	              error );
-
-	if( read_count != (ssize_t) section_table_size )
+	/* The section table is normally already part of the header data
+	 */
+	if( libexe_io_handle_read_header_data(
+	     io_handle,
+	     file_io_handle,
+	     io_handle->section_table_offset + section_table_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -978,6 +1394,8 @@ int libexe_io_handle_read_section_table(
 
 		goto on_error;
 	}
+	section_table_data = &( io_handle->header_data[ io_handle->section_table_offset ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -985,17 +1403,17 @@ int libexe_io_handle_read_section_table(
 		 "%s: section table data:\n",
 		 function );
 		libcnotify_print_data(
-		 section_table,
+		 section_table_data,
 		 section_table_size,
 		 0 );
 	}
 #endif
-	section_table_data = section_table;
 
 	while( section_table_size >= sizeof( exe_section_table_entry_t ) )
 	{
 		if( libexe_section_descriptor_initialize(
 		     &section_descriptor,
+		     io_handle->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1034,6 +1452,10 @@ int libexe_io_handle_read_section_table(
 		 ( (exe_section_table_entry_t *) section_table_data )->virtual_address,
 		 section_descriptor->virtual_address );
 
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_section_table_entry_t *) section_table_data )->virtual_size,
+		 section_descriptor->virtual_size );
+
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (exe_section_table_entry_t *) section_table_data )->data_size,
 		 section_data_size );
@@ -1051,14 +1473,11 @@ int libexe_io_handle_read_section_table(
 			 section_index,
 			 section_descriptor->name );
 
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (exe_section_table_entry_t *) section_table_data )->virtual_size,
-			 value_32bit );
 			libcnotify_printf(
 			 "%s: entry: %02" PRIu16 " virtual size\t\t\t: %" PRIu32 "\n",
 			 function,
 			 section_index,
-			 value_32bit );
+			 section_descriptor->virtual_size );
 
 			libcnotify_printf(
 			 "%s: entry: %02" PRIu16 " virtual address\t\t\t: 0x%08" PRIx32 "\n",
@@ -1162,15 +1581,18 @@ int libexe_io_handle_read_section_table(
 
 			goto on_error;
 		}
+		section_descriptor->index = entry_index;
+
+		/* The readahead of the sections of a file is bounded by the maximum readahead size
+		 */
+		section_descriptor->maximum_readahead_size = LIBEXE_MAXIMUM_READAHEAD_SIZE / number_of_sections;
+
 		section_descriptor = NULL;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		section_index++;
 #endif
 	}
-	memory_free(
-	 section_table );
-
 	return( 1 );
 
 on_error:
@@ -1180,93 +1602,541 @@ on_error:
 		 &section_descriptor,
 		 NULL );
 	}
-	if( section_table != NULL )
+	return( -1 );
+}
+
+/* Compares two ranges by file offset
+ * Returns -1 if the first range sorts before the second, 1 if after or 0 if equal
+ */
+int libexe_io_handle_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	const libexe_range_t *first  = (const libexe_range_t *) first_range;
+	const libexe_range_t *second = (const libexe_range_t *) second_range;
+
+	if( first->offset < second->offset )
 	{
-		memory_free(
-		 section_table );
+		return( -1 );
 	}
-	return( -1 );
+	else if( first->offset > second->offset )
+	{
+		return( 1 );
+	}
+	if( first->size < second->size )
+	{
+		return( -1 );
+	}
+	else if( first->size > second->size )
+	{
+		return( 1 );
+	}
+	return( 0 );
 }
 
-/* Reads the segment data into the buffer
- * Callback function for the section stream
+/* Reads data from a forward only stream
+ * The data is read from the current offset of the stream, since a stream
+ * can return less data than requested the read is repeated until the data
+ * is filled or the end of the stream is reached
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libexe_io_handle_read_segment_data(
-         intptr_t *data_handle LIBEXE_ATTRIBUTE_UNUSED,
+ssize_t libexe_io_handle_read_stream_data(
+         libexe_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
-         int segment_index LIBEXE_ATTRIBUTE_UNUSED,
-         int segment_file_index LIBEXE_ATTRIBUTE_UNUSED,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags LIBEXE_ATTRIBUTE_UNUSED,
-         uint8_t read_flags LIBEXE_ATTRIBUTE_UNUSED,
+         uint8_t *data,
+         size_t data_size,
          libcerror_error_t **error )
 {
-	static char *function = "libexe_io_handle_read_segment_data";
+	static char *function = "libexe_io_handle_read_stream_data";
+	size_t data_offset    = 0;
 	ssize_t read_count    = 0;
 
-	LIBEXE_UNREFERENCED_PARAMETER( data_handle )
-	LIBEXE_UNREFERENCED_PARAMETER( segment_index )
-	LIBEXE_UNREFERENCED_PARAMETER( segment_file_index )
-	LIBEXE_UNREFERENCED_PARAMETER( segment_flags )
-	LIBEXE_UNREFERENCED_PARAMETER( read_flags )
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	read_count = libbfio_handle_read_buffer(
-		      file_io_handle,
-		      segment_data,
-		      segment_data_size,
-		      error );
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-	if( read_count != (ssize_t) segment_data_size )
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
+	while( data_offset < data_size )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		io_handle->number_of_reads += 1;
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from stream.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( (ssize_t) data_offset );
 }
 
-/* Seeks a certain segment offset
- * Callback function for the section stream
- * Returns the offset or -1 on error
+/* Reads data at a specific offset
+ * The data is copied from the file data when the file is memory mapped or opened from memory
+ * Returns 1 if successful or -1 on error
  */
-off64_t libexe_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBEXE_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
-         int segment_index LIBEXE_ATTRIBUTE_UNUSED,
-         int segment_file_index LIBEXE_ATTRIBUTE_UNUSED,
-         off64_t segment_offset,
-         libcerror_error_t **error )
+int libexe_io_handle_read_data_at_offset(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
 {
-	static char *function = "libexe_io_handle_seek_segment_offset";
+	static char *function = "libexe_io_handle_read_data_at_offset";
+	ssize_t read_count    = 0;
 
-	LIBEXE_UNREFERENCED_PARAMETER( data_handle )
-	LIBEXE_UNREFERENCED_PARAMETER( segment_index )
-	LIBEXE_UNREFERENCED_PARAMETER( segment_file_index )
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	segment_offset = libbfio_handle_seek_offset(
-	                  file_io_handle,
-	                  segment_offset,
-	                  SEEK_SET,
-	                  error );
+		return( -1 );
+	}
+	if( io_handle->file_data != NULL )
+	{
+		if( ( offset < 0 )
+		 || ( (size64_t) offset > (size64_t) io_handle->file_data_size )
+		 || ( data_size > ( io_handle->file_data_size - (size_t) offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data range value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     data,
+		     &( io_handle->file_data[ offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
 
-	if( segment_offset == -1 )
+			return( -1 );
+		}
+		return( 1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to seek segment offset.",
-		 function );
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
 		return( -1 );
 	}
-	return( segment_offset );
+	return( 1 );
 }
 
+/* Reads multiple ranges of data
+ * The ranges are sorted by offset and ranges that overlap or are at most
+ * LIBEXE_MAXIMUM_READ_RANGES_GAP bytes apart are merged into a single read
+ * of at most LIBEXE_MAXIMUM_READ_RANGES_MERGE_SIZE bytes
+ * When the file is memory mapped or opened from memory the data of every range
+ * is copied directly from the file data and no reads are needed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_io_handle_read_ranges(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const libexe_range_t *ranges,
+     size_t number_of_ranges,
+     int *number_of_reads,
+     libcerror_error_t **error )
+{
+	libexe_range_t *sorted_ranges = NULL;
+	uint8_t *merged_data          = NULL;
+	static char *function         = "libexe_io_handle_read_ranges";
+	size_t first_range_index      = 0;
+	size_t last_range_index       = 0;
+	size_t merged_data_size       = 0;
+	size_t range_index            = 0;
+	size64_t merged_size          = 0;
+	off64_t merged_end_offset     = 0;
+	off64_t merged_offset         = 0;
+	off64_t range_end_offset      = 0;
+	int safe_number_of_reads      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_ranges == 0 )
+	 || ( number_of_ranges > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libexe_range_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( ( ranges[ range_index ].offset < 0 )
+		 || ( ranges[ range_index ].size > (size_t) SSIZE_MAX )
+		 || ( (size64_t) ranges[ range_index ].size > (size64_t) ( INT64_MAX - ranges[ range_index ].offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %" PRIzd " value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( ( ranges[ range_index ].data == NULL )
+		 && ( ranges[ range_index ].size > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid range: %" PRIzd " - missing data.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->file_data != NULL )
+	{
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( ranges[ range_index ].size == 0 )
+			{
+				continue;
+			}
+			if( libexe_io_handle_read_data_at_offset(
+			     io_handle,
+			     file_io_handle,
+			     ranges[ range_index ].offset,
+			     ranges[ range_index ].data,
+			     ranges[ range_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy range: %" PRIzd " data.",
+				 function,
+				 range_index );
+
+				return( -1 );
+			}
+		}
+		*number_of_reads = 0;
+
+		return( 1 );
+	}
+	sorted_ranges = (libexe_range_t *) memory_allocate(
+	                                    sizeof( libexe_range_t ) * number_of_ranges );
+
+	if( sorted_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     sorted_ranges,
+	     ranges,
+	     sizeof( libexe_range_t ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy ranges.",
+		 function );
+
+		goto on_error;
+	}
+	qsort(
+	 sorted_ranges,
+	 number_of_ranges,
+	 sizeof( libexe_range_t ),
+	 &libexe_io_handle_range_compare );
+
+	first_range_index = 0;
+
+	while( first_range_index < number_of_ranges )
+	{
+		if( sorted_ranges[ first_range_index ].size == 0 )
+		{
+			first_range_index++;
+
+			continue;
+		}
+		merged_offset     = sorted_ranges[ first_range_index ].offset;
+		merged_end_offset = merged_offset + (off64_t) sorted_ranges[ first_range_index ].size;
+		last_range_index  = first_range_index;
+
+		/* Merge the following ranges that overlap or are nearby
+		 */
+		while( ( last_range_index + 1 ) < number_of_ranges )
+		{
+			if( sorted_ranges[ last_range_index + 1 ].offset > ( merged_end_offset + LIBEXE_MAXIMUM_READ_RANGES_GAP ) )
+			{
+				break;
+			}
+			range_end_offset = sorted_ranges[ last_range_index + 1 ].offset + (off64_t) sorted_ranges[ last_range_index + 1 ].size;
+
+			if( range_end_offset < merged_end_offset )
+			{
+				range_end_offset = merged_end_offset;
+			}
+			if( (size64_t) ( range_end_offset - merged_offset ) > (size64_t) LIBEXE_MAXIMUM_READ_RANGES_MERGE_SIZE )
+			{
+				break;
+			}
+			merged_end_offset = range_end_offset;
+
+			last_range_index++;
+		}
+		merged_size = (size64_t) ( merged_end_offset - merged_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading ranges: %" PRIzd " - %" PRIzd " at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+			 function,
+			 first_range_index,
+			 last_range_index,
+			 merged_offset,
+			 merged_offset,
+			 merged_size );
+		}
+#endif
+		/* A single range is read directly into its data
+		 */
+		if( first_range_index == last_range_index )
+		{
+			if( libexe_io_handle_read_data_at_offset(
+			     io_handle,
+			     file_io_handle,
+			     merged_offset,
+			     sorted_ranges[ first_range_index ].data,
+			     sorted_ranges[ first_range_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range data.",
+				 function );
+
+				goto on_error;
+			}
+			safe_number_of_reads++;
+
+			first_range_index++;
+
+			continue;
+		}
+		if( (size_t) merged_size > merged_data_size )
+		{
+			if( merged_data != NULL )
+			{
+				memory_free(
+				 merged_data );
+
+				merged_data_size = 0;
+			}
+			merged_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * (size_t) merged_size );
+
+			if( merged_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create merged data.",
+				 function );
+
+				goto on_error;
+			}
+			merged_data_size = (size_t) merged_size;
+		}
+		if( libexe_io_handle_read_data_at_offset(
+		     io_handle,
+		     file_io_handle,
+		     merged_offset,
+		     merged_data,
+		     (size_t) merged_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read merged range data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_number_of_reads++;
+
+		for( range_index = first_range_index;
+		     range_index <= last_range_index;
+		     range_index++ )
+		{
+			if( sorted_ranges[ range_index ].size == 0 )
+			{
+				continue;
+			}
+			if( memory_copy(
+			     sorted_ranges[ range_index ].data,
+			     &( merged_data[ sorted_ranges[ range_index ].offset - merged_offset ] ),
+			     sorted_ranges[ range_index ].size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy range: %" PRIzd " data.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		first_range_index = last_range_index + 1;
+	}
+	if( merged_data != NULL )
+	{
+		memory_free(
+		 merged_data );
+	}
+	memory_free(
+	 sorted_ranges );
+
+	*number_of_reads = safe_number_of_reads;
+
+	return( 1 );
+
+on_error:
+	if( merged_data != NULL )
+	{
+		memory_free(
+		 merged_data );
+	}
+	if( sorted_ranges != NULL )
+	{
+		memory_free(
+		 sorted_ranges );
+	}
+	return( -1 );
+}
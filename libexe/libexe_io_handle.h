@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_arena.h"
 #include "libexe_coff_header.h"
 #include "libexe_coff_optional_header.h"
 #include "libexe_data_directory_descriptor.h"
@@ -32,6 +33,7 @@
 #include "libexe_libbfio.h"
 #include "libexe_libcdata.h"
 #include "libexe_libcerror.h"
+#include "libexe_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -53,6 +55,39 @@ struct libexe_io_handle
 	 */
 	libexe_coff_optional_header_t *coff_optional_header;
 
+	/* The arena the per file metadata is allocated from, which is NULL
+	 * when the metadata is allocated from the heap
+	 */
+	libexe_arena_t *arena;
+
+	/* The header data
+	 */
+	uint8_t *header_data;
+
+	/* The header data size
+	 */
+	size_t header_data_size;
+
+	/* The section table offset
+	 */
+	size_t section_table_offset;
+
+	/* The file data, when the file is memory mapped or opened from memory
+	 */
+	const uint8_t *file_data;
+
+	/* The file data size
+	 */
+	size_t file_data_size;
+
+	/* Value to indicate the file is read as a forward only stream
+	 */
+	uint8_t is_stream;
+
+	/* The number of reads issued to open the file
+	 */
+	int number_of_reads;
+
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
@@ -74,6 +109,16 @@ int libexe_io_handle_clear(
      libexe_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libexe_io_handle_read_header_data(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t header_data_size,
+     libcerror_error_t **error );
+
+int libexe_io_handle_free_header_data(
+     libexe_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libexe_io_handle_read_file_header(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -115,24 +160,32 @@ int libexe_io_handle_read_section_table(
      libcdata_array_t *sections_array,
      libcerror_error_t **error );
 
-ssize_t libexe_io_handle_read_segment_data(
-         intptr_t *data_handle,
-         libbfio_handle_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags,
-         uint8_t read_flags,
-         libcerror_error_t **error );
-
-off64_t libexe_io_handle_seek_segment_offset(
-         intptr_t *data_handle,
-         libbfio_handle_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         off64_t segment_offset,
-         libcerror_error_t **error );
+int libexe_io_handle_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+ssize_t libexe_io_handle_read_stream_data(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_io_handle_read_data_at_offset(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libexe_io_handle_read_ranges(
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const libexe_range_t *ranges,
+     size_t number_of_ranges,
+     int *number_of_reads,
+     libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
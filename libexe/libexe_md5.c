@@ -0,0 +1,457 @@
+/*
+ * MD5 functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+#include "libexe_md5.h"
+
+/* The MD5 sine derived constants
+ */
+static const uint32_t libexe_md5_constants[ 64 ] = {
+	0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL,
+	0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
+	0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL,
+	0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
+	0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL,
+	0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
+	0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL,
+	0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
+	0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL,
+	0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
+	0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL,
+	0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
+	0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL,
+	0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
+	0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL,
+	0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL
+};
+
+/* The MD5 per-round rotation amounts
+ */
+static const uint8_t libexe_md5_rotations[ 64 ] = {
+	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+	5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+#define libexe_md5_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+/* Creates a MD5 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_md5_initialize(
+     libexe_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_md5_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            libexe_md5_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libexe_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->hash_values[ 0 ] = 0x67452301UL;
+	( *context )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *context )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *context )->hash_values[ 3 ] = 0x10325476UL;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_md5_free(
+     libexe_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_md5_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Hashes a single 64-byte block
+ */
+void libexe_md5_transform(
+     libexe_md5_context_t *context,
+     const uint8_t *block )
+{
+	uint32_t values[ 16 ];
+
+	uint32_t hash_value_a = 0;
+	uint32_t hash_value_b = 0;
+	uint32_t hash_value_c = 0;
+	uint32_t hash_value_d = 0;
+	uint32_t round_value  = 0;
+	uint8_t value_index   = 0;
+	uint8_t round_index   = 0;
+
+	for( value_index = 0;
+	     value_index < 16;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( block[ value_index * 4 ] ),
+		 values[ value_index ] );
+	}
+	hash_value_a = context->hash_values[ 0 ];
+	hash_value_b = context->hash_values[ 1 ];
+	hash_value_c = context->hash_values[ 2 ];
+	hash_value_d = context->hash_values[ 3 ];
+
+	for( round_index = 0;
+	     round_index < 64;
+	     round_index++ )
+	{
+		if( round_index < 16 )
+		{
+			round_value = ( hash_value_b & hash_value_c ) | ( ~hash_value_b & hash_value_d );
+			value_index = round_index;
+		}
+		else if( round_index < 32 )
+		{
+			round_value = ( hash_value_d & hash_value_b ) | ( ~hash_value_d & hash_value_c );
+			value_index = ( ( 5 * round_index ) + 1 ) & 0x0f;
+		}
+		else if( round_index < 48 )
+		{
+			round_value = hash_value_b ^ hash_value_c ^ hash_value_d;
+			value_index = ( ( 3 * round_index ) + 5 ) & 0x0f;
+		}
+		else
+		{
+			round_value = hash_value_c ^ ( hash_value_b | ~hash_value_d );
+			value_index = ( 7 * round_index ) & 0x0f;
+		}
+		round_value += hash_value_a + libexe_md5_constants[ round_index ] + values[ value_index ];
+
+		hash_value_a = hash_value_d;
+		hash_value_d = hash_value_c;
+		hash_value_c = hash_value_b;
+		hash_value_b = hash_value_b + libexe_md5_rotate_left( round_value, libexe_md5_rotations[ round_index ] );
+	}
+	context->hash_values[ 0 ] += hash_value_a;
+	context->hash_values[ 1 ] += hash_value_b;
+	context->hash_values[ 2 ] += hash_value_c;
+	context->hash_values[ 3 ] += hash_value_d;
+}
+
+/* Updates the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_md5_update(
+     libexe_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_md5_update";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->number_of_bytes += size;
+
+	if( context->block_size > 0 )
+	{
+		copy_size = LIBEXE_MD5_BLOCK_SIZE - context->block_size;
+
+		if( copy_size > size )
+		{
+			copy_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size += copy_size;
+		buffer_offset        = copy_size;
+
+		if( context->block_size < LIBEXE_MD5_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		libexe_md5_transform(
+		 context,
+		 context->block );
+
+		context->block_size = 0;
+	}
+	while( ( size - buffer_offset ) >= LIBEXE_MD5_BLOCK_SIZE )
+	{
+		libexe_md5_transform(
+		 context,
+		 &( buffer[ buffer_offset ] ) );
+
+		buffer_offset += LIBEXE_MD5_BLOCK_SIZE;
+	}
+	if( buffer_offset < size )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size = size - buffer_offset;
+	}
+	return( 1 );
+}
+
+/* Finalizes the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_md5_finalize(
+     libexe_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libexe_md5_finalize";
+	uint64_t number_of_bits  = 0;
+	uint8_t hash_value_index = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBEXE_MD5_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = context->number_of_bytes * 8;
+
+	/* Pad with a single 1 bit followed by 0 bits up to 56 bytes of the last block
+	 */
+	context->block[ context->block_size++ ] = 0x80;
+
+	if( context->block_size > ( LIBEXE_MD5_BLOCK_SIZE - 8 ) )
+	{
+		if( memory_set(
+		     &( context->block[ context->block_size ] ),
+		     0,
+		     LIBEXE_MD5_BLOCK_SIZE - context->block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block.",
+			 function );
+
+			return( -1 );
+		}
+		libexe_md5_transform(
+		 context,
+		 context->block );
+
+		context->block_size = 0;
+	}
+	if( memory_set(
+	     &( context->block[ context->block_size ] ),
+	     0,
+	     LIBEXE_MD5_BLOCK_SIZE - 8 - context->block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( context->block[ LIBEXE_MD5_BLOCK_SIZE - 8 ] ),
+	 number_of_bits );
+
+	libexe_md5_transform(
+	 context,
+	 context->block );
+
+	for( hash_value_index = 0;
+	     hash_value_index < 4;
+	     hash_value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ hash_value_index * 4 ] ),
+		 context->hash_values[ hash_value_index ] );
+	}
+	context->block_size = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * MD5 functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_MD5_H )
+#define _LIBEXE_MD5_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBEXE_MD5_HASH_SIZE		16
+#define LIBEXE_MD5_BLOCK_SIZE		64
+
+typedef struct libexe_md5_context libexe_md5_context_t;
+
+struct libexe_md5_context
+{
+	/* The hash values
+	 */
+	uint32_t hash_values[ 4 ];
+
+	/* The number of bytes hashed
+	 */
+	uint64_t number_of_bytes;
+
+	/* The block data that has not been hashed yet
+	 */
+	uint8_t block[ LIBEXE_MD5_BLOCK_SIZE ];
+
+	/* The size of the block data
+	 */
+	size_t block_size;
+};
+
+int libexe_md5_initialize(
+     libexe_md5_context_t **context,
+     libcerror_error_t **error );
+
+int libexe_md5_free(
+     libexe_md5_context_t **context,
+     libcerror_error_t **error );
+
+void libexe_md5_transform(
+     libexe_md5_context_t *context,
+     const uint8_t *block );
+
+int libexe_md5_update(
+     libexe_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libexe_md5_finalize(
+     libexe_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_MD5_H ) */
+
@@ -0,0 +1,648 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libexe_libcerror.h"
+#include "libexe_memory_map.h"
+
+#if !defined( WINAPI ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_OPEN ) && defined( HAVE_FSTAT ) && defined( HAVE_CLOSE )
+#define LIBEXE_HAVE_POSIX_MEMORY_MAP	1
+#endif
+
+#if defined( LIBEXE_HAVE_POSIX_MEMORY_MAP ) && defined( HAVE_POSIX_MADVISE ) && defined( HAVE_SYSCONF )
+#define LIBEXE_HAVE_POSIX_MEMORY_ADVISE	1
+#endif
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_memory_map_initialize(
+     libexe_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               libexe_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libexe_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	( *memory_map )->file_handle    = INVALID_HANDLE_VALUE;
+	( *memory_map )->mapping_handle = NULL;
+#endif
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_memory_map_free(
+     libexe_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( ( *memory_map )->data != NULL )
+		{
+			if( libexe_memory_map_close(
+			     *memory_map,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close memory map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+/* Opens a memory map of a file
+ * The file is mapped read-only in its entirety
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_memory_map_open(
+     libexe_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_memory_map_open";
+
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer;
+
+	DWORD error_code      = 0;
+
+#elif defined( LIBEXE_HAVE_POSIX_MEMORY_MAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	int file_descriptor   = -1;
+#endif
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	memory_map->file_handle = CreateFileA(
+	                           (LPCSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL,
+	                           NULL );
+
+	if( memory_map->file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( GetFileSizeEx(
+	     memory_map->file_handle,
+	     &large_integer ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( large_integer.QuadPart <= 0 )
+	 || ( (uint64_t) large_integer.QuadPart > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	memory_map->mapping_handle = CreateFileMappingA(
+	                              memory_map->file_handle,
+	                              NULL,
+	                              PAGE_READONLY,
+	                              0,
+	                              0,
+	                              NULL );
+
+	if( memory_map->mapping_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	memory_map->data = (uint8_t *) MapViewOfFile(
+	                                memory_map->mapping_handle,
+	                                FILE_MAP_READ,
+	                                0,
+	                                0,
+	                                0 );
+
+	if( memory_map->data == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to map view of file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_map->data_size = (size_t) large_integer.QuadPart;
+
+	return( 1 );
+
+on_error:
+	if( memory_map->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 memory_map->mapping_handle );
+
+		memory_map->mapping_handle = NULL;
+	}
+	if( memory_map->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 memory_map->file_handle );
+
+		memory_map->file_handle = INVALID_HANDLE_VALUE;
+	}
+	return( -1 );
+
+#elif defined( LIBEXE_HAVE_POSIX_MEMORY_MAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( !S_ISREG( file_statistics.st_mode ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type - only regular files can be mapped.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to close file.",
+		 function );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+
+on_error:
+	if( ( data != NULL )
+	 && ( data != MAP_FAILED ) )
+	{
+		munmap(
+		 data,
+		 (size_t) file_statistics.st_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapping is not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Closes a memory map
+ * Returns 0 if successful or -1 on error
+ */
+int libexe_memory_map_close(
+     libexe_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_memory_map_close";
+	int result            = 0;
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#endif
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory map - missing data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( UnmapViewOfFile(
+	     memory_map->data ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 error_code,
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		result = -1;
+	}
+	if( memory_map->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 memory_map->mapping_handle );
+
+		memory_map->mapping_handle = NULL;
+	}
+	if( memory_map->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 memory_map->file_handle );
+
+		memory_map->file_handle = INVALID_HANDLE_VALUE;
+	}
+#elif defined( LIBEXE_HAVE_POSIX_MEMORY_MAP )
+	if( munmap(
+	     memory_map->data,
+	     memory_map->data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to unmap file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	return( result );
+}
+
+
+/* Advises the operating system that a range of the mapped data will be read
+ * The advice is a hint, hence failure to apply it is not considered an error
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libexe_memory_map_advise_range(
+     libexe_memory_map_t *memory_map,
+     size_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_memory_map_advise_range";
+
+#if defined( LIBEXE_HAVE_POSIX_MEMORY_ADVISE )
+	size_t page_offset    = 0;
+	long page_size        = 0;
+#endif
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory map - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset >= memory_map->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( memory_map->data_size - offset ) )
+	{
+		size = memory_map->data_size - offset;
+	}
+#if defined( LIBEXE_HAVE_POSIX_MEMORY_ADVISE )
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		return( 0 );
+	}
+	/* The mapped data starts on a page boundary, the advised range must as well
+	 */
+	page_offset = offset % (size_t) page_size;
+
+	posix_madvise(
+	 &( memory_map->data[ offset - page_offset ] ),
+	 size + page_offset,
+	 POSIX_MADV_WILLNEED );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
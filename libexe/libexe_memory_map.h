@@ -0,0 +1,85 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_MEMORY_MAP_H )
+#define _LIBEXE_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_memory_map libexe_memory_map_t;
+
+struct libexe_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+
+#if defined( WINAPI )
+	/* The file handle
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+#endif
+};
+
+int libexe_memory_map_initialize(
+     libexe_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libexe_memory_map_free(
+     libexe_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libexe_memory_map_open(
+     libexe_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libexe_memory_map_close(
+     libexe_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+int libexe_memory_map_advise_range(
+     libexe_memory_map_t *memory_map,
+     size_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_MEMORY_MAP_H ) */
+
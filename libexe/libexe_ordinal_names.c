@@ -0,0 +1,1420 @@
+/*
+ * Ordinal name functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+#include "libexe_ordinal_names.h"
+
+/* The names of functions of ws2_32.dll, wsock32.dll and oleaut32.dll that are
+ * commonly imported by ordinal only, as used by the import hash (imphash)
+ * convention
+ *
+ * The names are stored in a minimal perfect hash table keyed by the module
+ * name hash and ordinal. The bucket of a key is determined by its key hash
+ * with seed 0, the index of the key in the table by its key hash with the seed
+ * of the bucket. Keys of other modules or ordinals can map onto any index and
+ * are rejected by comparing the module name hash, ordinal and module name of
+ * the entry.
+ *
+ * The tables are generated by scripts/generate_ordinal_names.py, which contains
+ * the names and must be run from the top of the source tree to change them.
+ */
+/* Begin of the tables generated by scripts/generate_ordinal_names.py
+ */
+#define LIBEXE_ORDINAL_NAMES_NUMBER_OF_BUCKETS	158
+#define LIBEXE_ORDINAL_NAMES_NUMBER_OF_NAMES	632
+
+/* The seed per bucket
+ */
+static const uint16_t libexe_ordinal_names_seeds[ 158 ] = {
+	1, 113, 2, 12, 35, 2, 14, 12, 1, 1, 11, 5,
+	169, 1, 1, 156, 1, 1, 391, 1, 130, 2, 13, 8,
+	32, 62, 38, 1, 38, 123, 78, 10, 31, 90, 1, 71,
+	380, 1, 8, 5, 153, 34, 520, 481, 1, 403, 59, 2,
+	13, 35, 10, 18, 515, 8, 114, 43, 282, 32, 556, 60,
+	13, 49, 178, 10, 3, 316, 46, 198, 3, 16, 1, 276,
+	11, 248, 14, 623, 22, 675, 1, 237, 1057, 5, 2, 1,
+	37, 322, 13, 243, 319, 1, 109, 66, 126, 39, 4, 14,
+	71, 152, 5, 107, 80, 147, 1, 2, 99, 269, 658, 39,
+	11, 1, 5, 642, 233, 79, 39, 22, 4, 203, 52, 329,
+	93, 1, 3904, 65, 14, 145, 39, 122, 13, 6, 481, 26,
+	140, 235, 46, 440, 265, 3, 29, 2, 641, 308, 1515, 1399,
+	1311, 269, 1, 36, 1, 16, 2, 374, 228, 628, 38, 700,
+	331, 290
+};
+
+/* The name entries
+ */
+static const libexe_ordinal_name_t libexe_ordinal_names_entries[ 632 ] = {
+	{ 0x733d6d1eUL, 50, 0, 907 },
+	{ 0x733d6d1eUL, 230, 0, 3315 },
+	{ 0x733d6d1eUL, 312, 0, 4474 },
+	{ 0xf730d303UL, 110, 13, 7536 },
+	{ 0x733d6d1eUL, 316, 0, 4516 },
+	{ 0x309f7c1dUL, 30, 24, 6117 },
+	{ 0xf730d303UL, 103, 13, 7381 },
+	{ 0x733d6d1eUL, 376, 0, 5181 },
+	{ 0x733d6d1eUL, 224, 0, 3235 },
+	{ 0x733d6d1eUL, 296, 0, 4289 },
+	{ 0x733d6d1eUL, 274, 0, 3914 },
+	{ 0x309f7c1dUL, 51, 24, 6534 },
+	{ 0x309f7c1dUL, 83, 24, 7030 },
+	{ 0x733d6d1eUL, 426, 0, 5561 },
+	{ 0x733d6d1eUL, 340, 0, 4836 },
+	{ 0x733d6d1eUL, 225, 0, 3250 },
+	{ 0x733d6d1eUL, 48, 0, 882 },
+	{ 0x733d6d1eUL, 175, 0, 2594 },
+	{ 0x309f7c1dUL, 25, 24, 6032 },
+	{ 0x733d6d1eUL, 13, 0, 203 },
+	{ 0x733d6d1eUL, 166, 0, 2504 },
+	{ 0x733d6d1eUL, 185, 0, 2713 },
+	{ 0x733d6d1eUL, 414, 0, 5326 },
+	{ 0xf730d303UL, 7, 13, 5885 },
+	{ 0x733d6d1eUL, 368, 0, 5069 },
+	{ 0x309f7c1dUL, 82, 24, 7019 },
+	{ 0x733d6d1eUL, 64, 0, 1089 },
+	{ 0xf730d303UL, 72, 13, 6875 },
+	{ 0xf730d303UL, 1, 13, 5829 },
+	{ 0x733d6d1eUL, 62, 0, 1063 },
+	{ 0xf730d303UL, 39, 13, 6291 },
+	{ 0x309f7c1dUL, 101, 24, 7344 },
+	{ 0x733d6d1eUL, 22, 0, 375 },
+	{ 0x733d6d1eUL, 377, 0, 5193 },
+	{ 0x733d6d1eUL, 442, 0, 5781 },
+	{ 0x733d6d1eUL, 283, 0, 4040 },
+	{ 0x733d6d1eUL, 193, 0, 2825 },
+	{ 0x309f7c1dUL, 20, 24, 5985 },
+	{ 0xf730d303UL, 86, 13, 7081 },
+	{ 0x309f7c1dUL, 44, 24, 6386 },
+	{ 0x309f7c1dUL, 26, 24, 6045 },
+	{ 0x733d6d1eUL, 330, 0, 4697 },
+	{ 0xf730d303UL, 8, 13, 5896 },
+	{ 0xf730d303UL, 108, 13, 7495 },
+	{ 0x733d6d1eUL, 81, 0, 1319 },
+	{ 0xf730d303UL, 500, 13, 7661 },
+	{ 0x733d6d1eUL, 78, 0, 1282 },
+	{ 0xf730d303UL, 90, 13, 7164 },
+	{ 0x733d6d1eUL, 39, 0, 693 },
+	{ 0x733d6d1eUL, 200, 0, 2923 },
+	{ 0x733d6d1eUL, 164, 0, 2464 },
+	{ 0x733d6d1eUL, 6, 0, 106 },
+	{ 0x733d6d1eUL, 145, 0, 2223 },
+	{ 0x309f7c1dUL, 24, 24, 6019 },
+	{ 0x733d6d1eUL, 105, 0, 1646 },
+	{ 0x733d6d1eUL, 7, 0, 120 },
+	{ 0xf730d303UL, 106, 13, 7451 },
+	{ 0x733d6d1eUL, 275, 0, 3927 },
+	{ 0x733d6d1eUL, 233, 0, 3360 },
+	{ 0x733d6d1eUL, 181, 0, 2655 },
+	{ 0xf730d303UL, 105, 13, 7428 },
+	{ 0x309f7c1dUL, 112, 24, 7574 },
+	{ 0x733d6d1eUL, 339, 0, 4823 },
+	{ 0x733d6d1eUL, 219, 0, 3165 },
+	{ 0xf730d303UL, 48, 13, 6483 },
+	{ 0x733d6d1eUL, 211, 0, 3063 },
+	{ 0x733d6d1eUL, 99, 0, 1571 },
+	{ 0x733d6d1eUL, 198, 0, 2893 },
+	{ 0x733d6d1eUL, 402, 0, 5250 },
+	{ 0x733d6d1eUL, 299, 0, 4343 },
+	{ 0x733d6d1eUL, 128, 0, 1990 },
+	{ 0x733d6d1eUL, 122, 0, 1897 },
+	{ 0xf730d303UL, 38, 13, 6264 },
+	{ 0x733d6d1eUL, 66, 0, 1116 },
+	{ 0x309f7c1dUL, 70, 24, 6843 },
+	{ 0x733d6d1eUL, 226, 0, 3262 },
+	{ 0x733d6d1eUL, 420, 0, 5451 },
+	{ 0xf730d303UL, 70, 13, 6843 },
+	{ 0x309f7c1dUL, 22, 24, 6003 },
+	{ 0xf730d303UL, 95, 13, 7262 },
+	{ 0x733d6d1eUL, 254, 0, 3643 },
+	{ 0x733d6d1eUL, 293, 0, 4225 },
+	{ 0x733d6d1eUL, 26, 0, 453 },
+	{ 0x309f7c1dUL, 43, 24, 6363 },
+	{ 0x733d6d1eUL, 108, 0, 1690 },
+	{ 0x733d6d1eUL, 135, 0, 2083 },
+	{ 0x733d6d1eUL, 192, 0, 2812 },
+	{ 0x733d6d1eUL, 111, 0, 1733 },
+	{ 0xf730d303UL, 10, 13, 5908 },
+	{ 0x733d6d1eUL, 322, 0, 4564 },
+	{ 0x309f7c1dUL, 49, 24, 6516 },
+	{ 0x733d6d1eUL, 214, 0, 3101 },
+	{ 0x733d6d1eUL, 125, 0, 1941 },
+	{ 0x733d6d1eUL, 367, 0, 5056 },
+	{ 0x733d6d1eUL, 72, 0, 1195 },
+	{ 0xf730d303UL, 151, 13, 7648 },
+	{ 0x309f7c1dUL, 57, 24, 6622 },
+	{ 0xf730d303UL, 31, 13, 6137 },
+	{ 0x309f7c1dUL, 61, 24, 6691 },
+	{ 0xf730d303UL, 40, 13, 6312 },
+	{ 0x733d6d1eUL, 28, 0, 487 },
+	{ 0xf730d303UL, 67, 13, 6813 },
+	{ 0x733d6d1eUL, 83, 0, 1343 },
+	{ 0x733d6d1eUL, 32, 0, 548 },
+	{ 0xf730d303UL, 58, 13, 6634 },
+	{ 0x733d6d1eUL, 271, 0, 3875 },
+	{ 0x733d6d1eUL, 244, 0, 3515 },
+	{ 0x309f7c1dUL, 69, 24, 6834 },
+	{ 0xf730d303UL, 18, 13, 5973 },
+	{ 0x733d6d1eUL, 360, 0, 4965 },
+	{ 0x309f7c1dUL, 11, 24, 5920 },
+	{ 0x733d6d1eUL, 335, 0, 4773 },
+	{ 0x733d6d1eUL, 273, 0, 3901 },
+	{ 0x733d6d1eUL, 199, 0, 2908 },
+	{ 0x309f7c1dUL, 42, 24, 6348 },
+	{ 0xf730d303UL, 88, 13, 7127 },
+	{ 0x733d6d1eUL, 247, 0, 3552 },
+	{ 0xf730d303UL, 32, 13, 6157 },
+	{ 0x733d6d1eUL, 301, 0, 4372 },
+	{ 0x733d6d1eUL, 46, 0, 844 },
+	{ 0x733d6d1eUL, 303, 0, 4389 },
+	{ 0x733d6d1eUL, 433, 0, 5654 },
+	{ 0x733d6d1eUL, 163, 0, 2448 },
+	{ 0xf730d303UL, 49, 13, 6516 },
+	{ 0x733d6d1eUL, 94, 0, 1493 },
+	{ 0xf730d303UL, 46, 13, 6426 },
+	{ 0x733d6d1eUL, 216, 0, 3127 },
+	{ 0x733d6d1eUL, 208, 0, 3025 },
+	{ 0x309f7c1dUL, 55, 24, 6594 },
+	{ 0x733d6d1eUL, 201, 0, 2936 },
+	{ 0xf730d303UL, 6, 13, 5873 },
+	{ 0x733d6d1eUL, 248, 0, 3564 },
+	{ 0x733d6d1eUL, 213, 0, 3089 },
+	{ 0x733d6d1eUL, 103, 0, 1619 },
+	{ 0x733d6d1eUL, 361, 0, 4977 },
+	{ 0x733d6d1eUL, 265, 0, 3790 },
+	{ 0x733d6d1eUL, 146, 0, 2241 },
+	{ 0x733d6d1eUL, 73, 0, 1207 },
+	{ 0xf730d303UL, 15, 13, 5953 },
+	{ 0x309f7c1dUL, 53, 24, 6562 },
+	{ 0x733d6d1eUL, 252, 0, 3615 },
+	{ 0x733d6d1eUL, 212, 0, 3076 },
+	{ 0x733d6d1eUL, 269, 0, 3847 },
+	{ 0x309f7c1dUL, 75, 24, 6927 },
+	{ 0xf730d303UL, 104, 13, 7403 },
+	{ 0x733d6d1eUL, 188, 0, 2765 },
+	{ 0x733d6d1eUL, 363, 0, 5002 },
+	{ 0x733d6d1eUL, 246, 0, 3540 },
+	{ 0x733d6d1eUL, 68, 0, 1146 },
+	{ 0x733d6d1eUL, 67, 0, 1130 },
+	{ 0xf730d303UL, 42, 13, 6348 },
+	{ 0x733d6d1eUL, 217, 0, 3140 },
+	{ 0x733d6d1eUL, 243, 0, 3501 },
+	{ 0x733d6d1eUL, 148, 0, 2274 },
+	{ 0x733d6d1eUL, 297, 0, 4309 },
+	{ 0xf730d303UL, 65, 13, 6769 },
+	{ 0x733d6d1eUL, 282, 0, 4026 },
+	{ 0xf730d303UL, 96, 13, 7285 },
+	{ 0x733d6d1eUL, 190, 0, 2785 },
+	{ 0x733d6d1eUL, 21, 0, 361 },
+	{ 0xf730d303UL, 3, 13, 5841 },
+	{ 0x733d6d1eUL, 415, 0, 5341 },
+	{ 0x733d6d1eUL, 436, 0, 5696 },
+	{ 0x733d6d1eUL, 304, 0, 4398 },
+	{ 0x309f7c1dUL, 116, 24, 7637 },
+	{ 0x733d6d1eUL, 88, 0, 1408 },
+	{ 0x733d6d1eUL, 432, 0, 5641 },
+	{ 0x733d6d1eUL, 102, 0, 1607 },
+	{ 0x733d6d1eUL, 294, 0, 4251 },
+	{ 0x309f7c1dUL, 107, 24, 7473 },
+	{ 0x733d6d1eUL, 218, 0, 3152 },
+	{ 0x733d6d1eUL, 326, 0, 4643 },
+	{ 0xf730d303UL, 26, 13, 6045 },
+	{ 0x733d6d1eUL, 143, 0, 2200 },
+	{ 0x733d6d1eUL, 317, 0, 4527 },
+	{ 0x733d6d1eUL, 263, 0, 3763 },
+	{ 0xf730d303UL, 45, 13, 6402 },
+	{ 0x733d6d1eUL, 98, 0, 1558 },
+	{ 0x733d6d1eUL, 336, 0, 4785 },
+	{ 0x309f7c1dUL, 111, 24, 7558 },
+	{ 0xf730d303UL, 52, 13, 6548 },
+	{ 0xf730d303UL, 54, 13, 6577 },
+	{ 0x733d6d1eUL, 30, 0, 518 },
+	{ 0x733d6d1eUL, 161, 0, 2421 },
+	{ 0x309f7c1dUL, 39, 24, 6291 },
+	{ 0x309f7c1dUL, 47, 24, 6450 },
+	{ 0x733d6d1eUL, 346, 0, 4915 },
+	{ 0xf730d303UL, 68, 13, 6825 },
+	{ 0xf730d303UL, 61, 13, 6691 },
+	{ 0xf730d303UL, 29, 13, 6107 },
+	{ 0x309f7c1dUL, 48, 24, 6483 },
+	{ 0xf730d303UL, 35, 13, 6197 },
+	{ 0x733d6d1eUL, 435, 0, 5682 },
+	{ 0xf730d303UL, 99, 13, 7332 },
+	{ 0x309f7c1dUL, 106, 24, 7451 },
+	{ 0x733d6d1eUL, 61, 0, 1051 },
+	{ 0x733d6d1eUL, 308, 0, 4436 },
+	{ 0x733d6d1eUL, 439, 0, 5739 },
+	{ 0x733d6d1eUL, 14, 0, 228 },
+	{ 0x733d6d1eUL, 29, 0, 500 },
+	{ 0x733d6d1eUL, 256, 0, 3669 },
+	{ 0x733d6d1eUL, 287, 0, 4104 },
+	{ 0x733d6d1eUL, 348, 0, 4940 },
+	{ 0xf730d303UL, 84, 13, 7041 },
+	{ 0x309f7c1dUL, 68, 24, 6825 },
+	{ 0x733d6d1eUL, 173, 0, 2580 },
+	{ 0x733d6d1eUL, 55, 0, 970 },
+	{ 0xf730d303UL, 20, 13, 5985 },
+	{ 0x733d6d1eUL, 372, 0, 5127 },
+	{ 0x733d6d1eUL, 434, 0, 5667 },
+	{ 0x733d6d1eUL, 136, 0, 2098 },
+	{ 0x309f7c1dUL, 86, 24, 7081 },
+	{ 0x309f7c1dUL, 59, 24, 6658 },
+	{ 0xf730d303UL, 57, 13, 6622 },
+	{ 0xf730d303UL, 13, 13, 5940 },
+	{ 0x733d6d1eUL, 255, 0, 3656 },
+	{ 0x733d6d1eUL, 24, 0, 411 },
+	{ 0xf730d303UL, 66, 13, 6791 },
+	{ 0x733d6d1eUL, 430, 0, 5615 },
+	{ 0x733d6d1eUL, 262, 0, 3748 },
+	{ 0x733d6d1eUL, 177, 0, 2610 },
+	{ 0x309f7c1dUL, 14, 24, 5947 },
+	{ 0x733d6d1eUL, 338, 0, 4809 },
+	{ 0x733d6d1eUL, 250, 0, 3590 },
+	{ 0xf730d303UL, 56, 13, 6608 },
+	{ 0x733d6d1eUL, 43, 0, 774 },
+	{ 0x733d6d1eUL, 242, 0, 3487 },
+	{ 0x733d6d1eUL, 60, 0, 1039 },
+	{ 0x733d6d1eUL, 417, 0, 5388 },
+	{ 0x733d6d1eUL, 331, 0, 4714 },
+	{ 0x733d6d1eUL, 115, 0, 1791 },
+	{ 0x733d6d1eUL, 300, 0, 4352 },
+	{ 0x309f7c1dUL, 2, 24, 5836 },
+	{ 0x733d6d1eUL, 151, 0, 2333 },
+	{ 0x733d6d1eUL, 413, 0, 5311 },
+	{ 0x733d6d1eUL, 278, 0, 3969 },
+	{ 0x733d6d1eUL, 337, 0, 4797 },
+	{ 0x309f7c1dUL, 21, 24, 5992 },
+	{ 0x733d6d1eUL, 379, 0, 5219 },
+	{ 0xf730d303UL, 79, 13, 6977 },
+	{ 0x733d6d1eUL, 349, 0, 4952 },
+	{ 0x733d6d1eUL, 288, 0, 4121 },
+	{ 0x733d6d1eUL, 54, 0, 957 },
+	{ 0x733d6d1eUL, 126, 0, 1956 },
+	{ 0x733d6d1eUL, 329, 0, 4686 },
+	{ 0x309f7c1dUL, 5, 24, 5861 },
+	{ 0x733d6d1eUL, 319, 0, 4545 },
+	{ 0xf730d303UL, 101, 13, 7344 },
+	{ 0x733d6d1eUL, 80, 0, 1307 },
+	{ 0x309f7c1dUL, 74, 24, 6905 },
+	{ 0x733d6d1eUL, 236, 0, 3404 },
+	{ 0x733d6d1eUL, 44, 0, 798 },
+	{ 0x733d6d1eUL, 116, 0, 1807 },
+	{ 0x733d6d1eUL, 418, 0, 5411 },
+	{ 0x733d6d1eUL, 20, 0, 342 },
+	{ 0x733d6d1eUL, 245, 0, 3528 },
+	{ 0x733d6d1eUL, 139, 0, 2142 },
+	{ 0x733d6d1eUL, 267, 0, 3820 },
+	{ 0x733d6d1eUL, 369, 0, 5083 },
+	{ 0x309f7c1dUL, 35, 24, 6197 },
+	{ 0xf730d303UL, 2, 13, 5836 },
+	{ 0x733d6d1eUL, 305, 0, 4409 },
+	{ 0x733d6d1eUL, 424, 0, 5529 },
+	{ 0x733d6d1eUL, 93, 0, 1479 },
+	{ 0xf730d303UL, 59, 13, 6658 },
+	{ 0x733d6d1eUL, 77, 0, 1262 },
+	{ 0x733d6d1eUL, 104, 0, 1633 },
+	{ 0x309f7c1dUL, 85, 24, 7061 },
+	{ 0x733d6d1eUL, 130, 0, 2018 },
+	{ 0x733d6d1eUL, 2, 0, 36 },
+	{ 0x733d6d1eUL, 343, 0, 4876 },
+	{ 0x733d6d1eUL, 142, 0, 2193 },
+	{ 0x733d6d1eUL, 272, 0, 3888 },
+	{ 0x733d6d1eUL, 137, 0, 2112 },
+	{ 0x309f7c1dUL, 12, 24, 5930 },
+	{ 0x309f7c1dUL, 99, 24, 7332 },
+	{ 0x309f7c1dUL, 56, 24, 6608 },
+	{ 0x733d6d1eUL, 70, 0, 1171 },
+	{ 0xf730d303UL, 5, 13, 5861 },
+	{ 0x733d6d1eUL, 41, 0, 729 },
+	{ 0x733d6d1eUL, 49, 0, 895 },
+	{ 0x733d6d1eUL, 306, 0, 4418 },
+	{ 0x733d6d1eUL, 176, 0, 2603 },
+	{ 0xf730d303UL, 4, 13, 5853 },
+	{ 0x733d6d1eUL, 210, 0, 3050 },
+	{ 0xf730d303UL, 109, 13, 7517 },
+	{ 0xf730d303UL, 64, 13, 6749 },
+	{ 0x733d6d1eUL, 205, 0, 2987 },
+	{ 0xf730d303UL, 69, 13, 6834 },
+	{ 0x733d6d1eUL, 144, 0, 2207 },
+	{ 0x733d6d1eUL, 422, 0, 5491 },
+	{ 0x733d6d1eUL, 123, 0, 1911 },
+	{ 0x309f7c1dUL, 29, 24, 6107 },
+	{ 0x733d6d1eUL, 17, 0, 286 },
+	{ 0x733d6d1eUL, 113, 0, 1761 },
+	{ 0x733d6d1eUL, 221, 0, 3191 },
+	{ 0x733d6d1eUL, 85, 0, 1370 },
+	{ 0x733d6d1eUL, 5, 0, 86 },
+	{ 0x309f7c1dUL, 77, 24, 6949 },
+	{ 0x733d6d1eUL, 227, 0, 3275 },
+	{ 0x309f7c1dUL, 98, 24, 7320 },
+	{ 0xf730d303UL, 17, 13, 5964 },
+	{ 0xf730d303UL, 77, 13, 6949 },
+	{ 0x733d6d1eUL, 341, 0, 4850 },
+	{ 0x733d6d1eUL, 90, 0, 1437 },
+	{ 0x733d6d1eUL, 270, 0, 3861 },
+	{ 0x733d6d1eUL, 362, 0, 4990 },
+	{ 0xf730d303UL, 27, 13, 6064 },
+	{ 0x733d6d1eUL, 235, 0, 3389 },
+	{ 0xf730d303UL, 50, 13, 6525 },
+	{ 0x733d6d1eUL, 194, 0, 2838 },
+	{ 0x309f7c1dUL, 89, 24, 7147 },
+	{ 0x309f7c1dUL, 79, 24, 6977 },
+	{ 0x733d6d1eUL, 290, 0, 4163 },
+	{ 0x309f7c1dUL, 52, 24, 6548 },
+	{ 0xf730d303UL, 41, 13, 6330 },
+	{ 0x309f7c1dUL, 73, 24, 6893 },
+	{ 0x309f7c1dUL, 17, 24, 5964 },
+	{ 0x733d6d1eUL, 134, 0, 2070 },
+	{ 0x733d6d1eUL, 285, 0, 4071 },
+	{ 0x309f7c1dUL, 81, 24, 7004 },
+	{ 0xf730d303UL, 82, 13, 7019 },
+	{ 0x733d6d1eUL, 223, 0, 3220 },
+	{ 0xf730d303UL, 102, 13, 7359 },
+	{ 0x733d6d1eUL, 96, 0, 1524 },
+	{ 0x733d6d1eUL, 277, 0, 3955 },
+	{ 0x733d6d1eUL, 240, 0, 3460 },
+	{ 0x733d6d1eUL, 370, 0, 5098 },
+	{ 0x309f7c1dUL, 16, 24, 5959 },
+	{ 0x733d6d1eUL, 207, 0, 3012 },
+	{ 0x733d6d1eUL, 332, 0, 4731 },
+	{ 0x733d6d1eUL, 204, 0, 2977 },
+	{ 0x733d6d1eUL, 19, 0, 323 },
+	{ 0x309f7c1dUL, 60, 24, 6682 },
+	{ 0x733d6d1eUL, 182, 0, 2665 },
+	{ 0xf730d303UL, 60, 13, 6682 },
+	{ 0x733d6d1eUL, 401, 0, 5233 },
+	{ 0x733d6d1eUL, 12, 0, 185 },
+	{ 0x733d6d1eUL, 441, 0, 5767 },
+	{ 0x309f7c1dUL, 41, 24, 6330 },
+	{ 0x309f7c1dUL, 58, 24, 6634 },
+	{ 0x309f7c1dUL, 92, 24, 7203 },
+	{ 0x733d6d1eUL, 159, 0, 2400 },
+	{ 0x309f7c1dUL, 3, 24, 5841 },
+	{ 0x309f7c1dUL, 96, 24, 7285 },
+	{ 0x733d6d1eUL, 117, 0, 1823 },
+	{ 0x309f7c1dUL, 32, 24, 6157 },
+	{ 0x733d6d1eUL, 35, 0, 606 },
+	{ 0xf730d303UL, 76, 13, 6941 },
+	{ 0x309f7c1dUL, 23, 24, 6012 },
+	{ 0x733d6d1eUL, 374, 0, 5154 },
+	{ 0xf730d303UL, 83, 13, 7030 },
+	{ 0x309f7c1dUL, 72, 24, 6875 },
+	{ 0x309f7c1dUL, 80, 24, 6989 },
+	{ 0xf730d303UL, 11, 13, 5920 },
+	{ 0x733d6d1eUL, 203, 0, 2965 },
+	{ 0x733d6d1eUL, 34, 0, 587 },
+	{ 0x733d6d1eUL, 239, 0, 3446 },
+	{ 0x733d6d1eUL, 120, 0, 1869 },
+	{ 0x733d6d1eUL, 92, 0, 1465 },
+	{ 0x733d6d1eUL, 431, 0, 5628 },
+	{ 0x733d6d1eUL, 156, 0, 2380 },
+	{ 0x309f7c1dUL, 64, 24, 6749 },
+	{ 0x733d6d1eUL, 36, 0, 622 },
+	{ 0x733d6d1eUL, 172, 0, 2573 },
+	{ 0x733d6d1eUL, 154, 0, 2366 },
+	{ 0x733d6d1eUL, 251, 0, 3602 },
+	{ 0xf730d303UL, 33, 13, 6171 },
+	{ 0x733d6d1eUL, 25, 0, 433 },
+	{ 0x733d6d1eUL, 86, 0, 1384 },
+	{ 0x309f7c1dUL, 1, 24, 5829 },
+	{ 0x733d6d1eUL, 131, 0, 2031 },
+	{ 0x733d6d1eUL, 153, 0, 2358 },
+	{ 0x733d6d1eUL, 318, 0, 4538 },
+	{ 0x733d6d1eUL, 168, 0, 2530 },
+	{ 0x733d6d1eUL, 63, 0, 1075 },
+	{ 0x733d6d1eUL, 119, 0, 1855 },
+	{ 0x733d6d1eUL, 310, 0, 4454 },
+	{ 0x733d6d1eUL, 298, 0, 4331 },
+	{ 0x733d6d1eUL, 307, 0, 4427 },
+	{ 0xf730d303UL, 98, 13, 7320 },
+	{ 0x309f7c1dUL, 46, 24, 6426 },
+	{ 0xf730d303UL, 75, 13, 6927 },
+	{ 0x733d6d1eUL, 197, 0, 2879 },
+	{ 0x309f7c1dUL, 95, 24, 7262 },
+	{ 0x733d6d1eUL, 292, 0, 4201 },
+	{ 0x733d6d1eUL, 167, 0, 2523 },
+	{ 0x733d6d1eUL, 109, 0, 1705 },
+	{ 0x733d6d1eUL, 279, 0, 3984 },
+	{ 0x733d6d1eUL, 183, 0, 2675 },
+	{ 0x309f7c1dUL, 7, 24, 5885 },
+	{ 0x733d6d1eUL, 222, 0, 3205 },
+	{ 0x733d6d1eUL, 429, 0, 5601 },
+	{ 0x733d6d1eUL, 158, 0, 2393 },
+	{ 0x733d6d1eUL, 257, 0, 3682 },
+	{ 0xf730d303UL, 16, 13, 5959 },
+	{ 0x309f7c1dUL, 65, 24, 6769 },
+	{ 0x309f7c1dUL, 62, 24, 6703 },
+	{ 0x733d6d1eUL, 169, 0, 2537 },
+	{ 0x733d6d1eUL, 56, 0, 984 },
+	{ 0x733d6d1eUL, 11, 0, 170 },
+	{ 0x733d6d1eUL, 87, 0, 1398 },
+	{ 0x733d6d1eUL, 291, 0, 4180 },
+	{ 0x733d6d1eUL, 33, 0, 566 },
+	{ 0xf730d303UL, 9, 13, 5902 },
+	{ 0xf730d303UL, 37, 13, 6237 },
+	{ 0x733d6d1eUL, 437, 0, 5711 },
+	{ 0x733d6d1eUL, 344, 0, 4889 },
+	{ 0x309f7c1dUL, 18, 24, 5973 },
+	{ 0x309f7c1dUL, 66, 24, 6791 },
+	{ 0x733d6d1eUL, 342, 0, 4864 },
+	{ 0xf730d303UL, 12, 13, 5930 },
+	{ 0x733d6d1eUL, 364, 0, 5015 },
+	{ 0x733d6d1eUL, 16, 0, 269 },
+	{ 0xf730d303UL, 116, 13, 7637 },
+	{ 0x733d6d1eUL, 366, 0, 5044 },
+	{ 0x309f7c1dUL, 76, 24, 6941 },
+	{ 0x309f7c1dUL, 34, 24, 6182 },
+	{ 0x733d6d1eUL, 8, 0, 133 },
+	{ 0xf730d303UL, 55, 13, 6594 },
+	{ 0x733d6d1eUL, 365, 0, 5029 },
+	{ 0x733d6d1eUL, 179, 0, 2630 },
+	{ 0x733d6d1eUL, 241, 0, 3474 },
+	{ 0x733d6d1eUL, 334, 0, 4761 },
+	{ 0x733d6d1eUL, 4, 0, 68 },
+	{ 0x733d6d1eUL, 101, 0, 1595 },
+	{ 0xf730d303UL, 22, 13, 6003 },
+	{ 0x733d6d1eUL, 38, 0, 666 },
+	{ 0x309f7c1dUL, 102, 24, 7359 },
+	{ 0x733d6d1eUL, 428, 0, 5588 },
+	{ 0x733d6d1eUL, 266, 0, 3805 },
+	{ 0x733d6d1eUL, 228, 0, 3288 },
+	{ 0x309f7c1dUL, 97, 24, 7307 },
+	{ 0x309f7c1dUL, 114, 24, 7612 },
+	{ 0x309f7c1dUL, 8, 24, 5896 },
+	{ 0x733d6d1eUL, 76, 0, 1248 },
+	{ 0xf730d303UL, 14, 13, 5947 },
+	{ 0x733d6d1eUL, 140, 0, 2162 },
+	{ 0xf730d303UL, 113, 13, 7590 },
+	{ 0x309f7c1dUL, 28, 24, 6078 },
+	{ 0x733d6d1eUL, 220, 0, 3178 },
+	{ 0x309f7c1dUL, 104, 24, 7403 },
+	{ 0xf730d303UL, 80, 13, 6989 },
+	{ 0x309f7c1dUL, 13, 24, 5940 },
+	{ 0x309f7c1dUL, 90, 24, 7164 },
+	{ 0x309f7c1dUL, 87, 24, 7106 },
+	{ 0x733d6d1eUL, 286, 0, 4090 },
+	{ 0x309f7c1dUL, 105, 24, 7428 },
+	{ 0xf730d303UL, 53, 13, 6562 },
+	{ 0x733d6d1eUL, 206, 0, 2999 },
+	{ 0xf730d303UL, 92, 13, 7203 },
+	{ 0x733d6d1eUL, 51, 0, 919 },
+	{ 0x733d6d1eUL, 155, 0, 2373 },
+	{ 0x309f7c1dUL, 15, 24, 5953 },
+	{ 0x733d6d1eUL, 375, 0, 5167 },
+	{ 0xf730d303UL, 28, 13, 6078 },
+	{ 0x733d6d1eUL, 112, 0, 1747 },
+	{ 0x733d6d1eUL, 157, 0, 2387 },
+	{ 0x309f7c1dUL, 10, 24, 5908 },
+	{ 0x733d6d1eUL, 127, 0, 1972 },
+	{ 0x733d6d1eUL, 42, 0, 756 },
+	{ 0x733d6d1eUL, 378, 0, 5206 },
+	{ 0x733d6d1eUL, 69, 0, 1159 },
+	{ 0x733d6d1eUL, 347, 0, 4927 },
+	{ 0xf730d303UL, 30, 13, 6117 },
+	{ 0x733d6d1eUL, 268, 0, 3833 },
+	{ 0x733d6d1eUL, 110, 0, 1719 },
+	{ 0xf730d303UL, 71, 13, 6867 },
+	{ 0x733d6d1eUL, 178, 0, 2620 },
+	{ 0x733d6d1eUL, 421, 0, 5473 },
+	{ 0x733d6d1eUL, 323, 0, 4587 },
+	{ 0x309f7c1dUL, 54, 24, 6577 },
+	{ 0x733d6d1eUL, 107, 0, 1674 },
+	{ 0x309f7c1dUL, 67, 24, 6813 },
+	{ 0x309f7c1dUL, 4, 24, 5853 },
+	{ 0x309f7c1dUL, 78, 24, 6967 },
+	{ 0x733d6d1eUL, 180, 0, 2640 },
+	{ 0xf730d303UL, 97, 13, 7307 },
+	{ 0x733d6d1eUL, 141, 0, 2186 },
+	{ 0x733d6d1eUL, 27, 0, 473 },
+	{ 0xf730d303UL, 21, 13, 5992 },
+	{ 0x309f7c1dUL, 19, 24, 5980 },
+	{ 0x309f7c1dUL, 93, 24, 7222 },
+	{ 0x733d6d1eUL, 132, 0, 2044 },
+	{ 0x309f7c1dUL, 63, 24, 6726 },
+	{ 0x309f7c1dUL, 500, 24, 7661 },
+	{ 0x309f7c1dUL, 103, 24, 7381 },
+	{ 0x733d6d1eUL, 232, 0, 3345 },
+	{ 0xf730d303UL, 36, 13, 6217 },
+	{ 0x733d6d1eUL, 333, 0, 4748 },
+	{ 0x733d6d1eUL, 165, 0, 2486 },
+	{ 0x733d6d1eUL, 311, 0, 4465 },
+	{ 0x733d6d1eUL, 149, 0, 2294 },
+	{ 0x733d6d1eUL, 79, 0, 1295 },
+	{ 0xf730d303UL, 115, 13, 7626 },
+	{ 0x733d6d1eUL, 138, 0, 2127 },
+	{ 0x309f7c1dUL, 151, 24, 7648 },
+	{ 0xf730d303UL, 112, 13, 7574 },
+	{ 0x733d6d1eUL, 412, 0, 5293 },
+	{ 0x733d6d1eUL, 124, 0, 1927 },
+	{ 0xf730d303UL, 63, 13, 6726 },
+	{ 0x309f7c1dUL, 37, 24, 6237 },
+	{ 0x733d6d1eUL, 97, 0, 1540 },
+	{ 0x733d6d1eUL, 37, 0, 647 },
+	{ 0x733d6d1eUL, 170, 0, 2544 },
+	{ 0xf730d303UL, 87, 13, 7106 },
+	{ 0xf730d303UL, 47, 13, 6450 },
+	{ 0x309f7c1dUL, 6, 24, 5873 },
+	{ 0xf730d303UL, 81, 13, 7004 },
+	{ 0x733d6d1eUL, 160, 0, 2407 },
+	{ 0x733d6d1eUL, 373, 0, 5140 },
+	{ 0x733d6d1eUL, 314, 0, 4496 },
+	{ 0x309f7c1dUL, 88, 24, 7127 },
+	{ 0x733d6d1eUL, 65, 0, 1102 },
+	{ 0x733d6d1eUL, 371, 0, 5112 },
+	{ 0x733d6d1eUL, 280, 0, 3999 },
+	{ 0x733d6d1eUL, 325, 0, 4613 },
+	{ 0x733d6d1eUL, 9, 0, 145 },
+	{ 0x733d6d1eUL, 438, 0, 5726 },
+	{ 0xf730d303UL, 111, 13, 7558 },
+	{ 0x309f7c1dUL, 71, 24, 6867 },
+	{ 0x733d6d1eUL, 260, 0, 3722 },
+	{ 0x733d6d1eUL, 295, 0, 4272 },
+	{ 0xf730d303UL, 44, 13, 6386 },
+	{ 0x733d6d1eUL, 53, 0, 943 },
+	{ 0x309f7c1dUL, 36, 24, 6217 },
+	{ 0x733d6d1eUL, 100, 0, 1583 },
+	{ 0x733d6d1eUL, 40, 0, 714 },
+	{ 0x733d6d1eUL, 47, 0, 863 },
+	{ 0xf730d303UL, 89, 13, 7147 },
+	{ 0x733d6d1eUL, 31, 0, 529 },
+	{ 0x733d6d1eUL, 284, 0, 4054 },
+	{ 0x733d6d1eUL, 253, 0, 3629 },
+	{ 0x309f7c1dUL, 33, 24, 6171 },
+	{ 0x733d6d1eUL, 229, 0, 3301 },
+	{ 0x733d6d1eUL, 196, 0, 2866 },
+	{ 0x309f7c1dUL, 84, 24, 7041 },
+	{ 0x733d6d1eUL, 71, 0, 1183 },
+	{ 0x733d6d1eUL, 259, 0, 3709 },
+	{ 0x309f7c1dUL, 109, 24, 7517 },
+	{ 0x733d6d1eUL, 89, 0, 1423 },
+	{ 0x733d6d1eUL, 150, 0, 2311 },
+	{ 0x733d6d1eUL, 52, 0, 931 },
+	{ 0x733d6d1eUL, 345, 0, 4902 },
+	{ 0x733d6d1eUL, 443, 0, 5804 },
+	{ 0xf730d303UL, 114, 13, 7612 },
+	{ 0x733d6d1eUL, 191, 0, 2799 },
+	{ 0xf730d303UL, 73, 13, 6893 },
+	{ 0xf730d303UL, 91, 13, 7183 },
+	{ 0x733d6d1eUL, 281, 0, 4012 },
+	{ 0x733d6d1eUL, 423, 0, 5510 },
+	{ 0x733d6d1eUL, 114, 0, 1775 },
+	{ 0xf730d303UL, 19, 13, 5980 },
+	{ 0x309f7c1dUL, 113, 24, 7590 },
+	{ 0x733d6d1eUL, 327, 0, 4673 },
+	{ 0xf730d303UL, 107, 13, 7473 },
+	{ 0x733d6d1eUL, 187, 0, 2755 },
+	{ 0x733d6d1eUL, 171, 0, 2559 },
+	{ 0x733d6d1eUL, 309, 0, 4445 },
+	{ 0x309f7c1dUL, 45, 24, 6402 },
+	{ 0x733d6d1eUL, 133, 0, 2057 },
+	{ 0x733d6d1eUL, 162, 0, 2433 },
+	{ 0x733d6d1eUL, 147, 0, 2254 },
+	{ 0xf730d303UL, 34, 13, 6182 },
+	{ 0x309f7c1dUL, 9, 24, 5902 },
+	{ 0x733d6d1eUL, 234, 0, 3374 },
+	{ 0x733d6d1eUL, 264, 0, 3776 },
+	{ 0xf730d303UL, 24, 13, 6019 },
+	{ 0xf730d303UL, 94, 13, 7244 },
+	{ 0x733d6d1eUL, 186, 0, 2737 },
+	{ 0x309f7c1dUL, 110, 24, 7536 },
+	{ 0x733d6d1eUL, 82, 0, 1331 },
+	{ 0x733d6d1eUL, 425, 0, 5548 },
+	{ 0x733d6d1eUL, 106, 0, 1660 },
+	{ 0x733d6d1eUL, 238, 0, 3432 },
+	{ 0x309f7c1dUL, 108, 24, 7495 },
+	{ 0x733d6d1eUL, 95, 0, 1508 },
+	{ 0x309f7c1dUL, 27, 24, 6064 },
+	{ 0xf730d303UL, 85, 13, 7061 },
+	{ 0x733d6d1eUL, 195, 0, 2851 },
+	{ 0x733d6d1eUL, 74, 0, 1221 },
+	{ 0x733d6d1eUL, 84, 0, 1357 },
+	{ 0x733d6d1eUL, 15, 0, 253 },
+	{ 0x733d6d1eUL, 45, 0, 821 },
+	{ 0x733d6d1eUL, 152, 0, 2351 },
+	{ 0x733d6d1eUL, 10, 0, 158 },
+	{ 0x309f7c1dUL, 40, 24, 6312 },
+	{ 0x733d6d1eUL, 174, 0, 2587 },
+	{ 0x733d6d1eUL, 289, 0, 4141 },
+	{ 0x733d6d1eUL, 91, 0, 1451 },
+	{ 0x733d6d1eUL, 129, 0, 2005 },
+	{ 0x309f7c1dUL, 115, 24, 7626 },
+	{ 0x733d6d1eUL, 215, 0, 3114 },
+	{ 0x733d6d1eUL, 184, 0, 2689 },
+	{ 0xf730d303UL, 74, 13, 6905 },
+	{ 0x733d6d1eUL, 23, 0, 391 },
+	{ 0x733d6d1eUL, 416, 0, 5357 },
+	{ 0x733d6d1eUL, 189, 0, 2775 },
+	{ 0x733d6d1eUL, 313, 0, 4485 },
+	{ 0x733d6d1eUL, 411, 0, 5271 },
+	{ 0x309f7c1dUL, 50, 24, 6525 },
+	{ 0xf730d303UL, 51, 13, 6534 },
+	{ 0x733d6d1eUL, 118, 0, 1840 },
+	{ 0x733d6d1eUL, 58, 0, 1014 },
+	{ 0x733d6d1eUL, 59, 0, 1027 },
+	{ 0x733d6d1eUL, 261, 0, 3735 },
+	{ 0x733d6d1eUL, 237, 0, 3419 },
+	{ 0x309f7c1dUL, 38, 24, 6264 },
+	{ 0x733d6d1eUL, 57, 0, 998 },
+	{ 0x733d6d1eUL, 202, 0, 2949 },
+	{ 0x733d6d1eUL, 209, 0, 3038 },
+	{ 0x733d6d1eUL, 315, 0, 4507 },
+	{ 0xf730d303UL, 62, 13, 6703 },
+	{ 0x733d6d1eUL, 258, 0, 3696 },
+	{ 0xf730d303UL, 78, 13, 6967 },
+	{ 0x733d6d1eUL, 121, 0, 1883 },
+	{ 0x733d6d1eUL, 440, 0, 5753 },
+	{ 0x309f7c1dUL, 94, 24, 7244 },
+	{ 0x733d6d1eUL, 276, 0, 3942 },
+	{ 0xf730d303UL, 23, 13, 6012 },
+	{ 0x733d6d1eUL, 18, 0, 302 },
+	{ 0x733d6d1eUL, 427, 0, 5575 },
+	{ 0xf730d303UL, 43, 13, 6363 },
+	{ 0x733d6d1eUL, 419, 0, 5426 },
+	{ 0xf730d303UL, 93, 13, 7222 },
+	{ 0x733d6d1eUL, 249, 0, 3576 },
+	{ 0xf730d303UL, 25, 13, 6032 },
+	{ 0x309f7c1dUL, 31, 24, 6137 },
+	{ 0x733d6d1eUL, 3, 0, 51 },
+	{ 0x733d6d1eUL, 231, 0, 3330 },
+	{ 0x733d6d1eUL, 75, 0, 1234 },
+	{ 0x309f7c1dUL, 91, 24, 7183 }
+};
+
+/* The module names and names as consecutive strings with end-of-string
+ * characters, the module names are stored in lower case
+ */
+static const char libexe_ordinal_names_strings[ 7666 ] =
+	"oleaut32.dll\0"
+	"ws2_32.dll\0"
+	"wsock32.dll\0"
+	"SysAllocString\0"
+	"SysReAllocString\0"
+	"SysAllocStringLen\0"
+	"SysReAllocStringLen\0"
+	"SysFreeString\0"
+	"SysStringLen\0"
+	"VariantInit\0"
+	"VariantClear\0"
+	"VariantCopy\0"
+	"VariantCopyInd\0"
+	"VariantChangeType\0"
+	"VariantTimeToDosDateTime\0"
+	"DosDateTimeToVariantTime\0"
+	"SafeArrayCreate\0"
+	"SafeArrayDestroy\0"
+	"SafeArrayGetDim\0"
+	"SafeArrayGetElemsize\0"
+	"SafeArrayGetUBound\0"
+	"SafeArrayGetLBound\0"
+	"SafeArrayLock\0"
+	"SafeArrayUnlock\0"
+	"SafeArrayAccessData\0"
+	"SafeArrayUnaccessData\0"
+	"SafeArrayGetElement\0"
+	"SafeArrayPutElement\0"
+	"SafeArrayCopy\0"
+	"DispGetParam\0"
+	"DispGetIDsOfNames\0"
+	"DispInvoke\0"
+	"CreateDispTypeInfo\0"
+	"CreateStdDispatch\0"
+	"RegisterActiveObject\0"
+	"RevokeActiveObject\0"
+	"GetActiveObject\0"
+	"SafeArrayAllocDescriptor\0"
+	"SafeArrayAllocData\0"
+	"SafeArrayDestroyDescriptor\0"
+	"SafeArrayDestroyData\0"
+	"SafeArrayRedim\0"
+	"SafeArrayAllocDescriptorEx\0"
+	"SafeArrayCreateEx\0"
+	"SafeArrayCreateVectorEx\0"
+	"SafeArraySetRecordInfo\0"
+	"SafeArrayGetRecordInfo\0"
+	"VarParseNumFromStr\0"
+	"VarNumFromParseNum\0"
+	"VarI2FromUI1\0"
+	"VarI2FromI4\0"
+	"VarI2FromR4\0"
+	"VarI2FromR8\0"
+	"VarI2FromCy\0"
+	"VarI2FromDate\0"
+	"VarI2FromStr\0"
+	"VarI2FromDisp\0"
+	"VarI2FromBool\0"
+	"SafeArraySetIID\0"
+	"VarI4FromUI1\0"
+	"VarI4FromI2\0"
+	"VarI4FromR4\0"
+	"VarI4FromR8\0"
+	"VarI4FromCy\0"
+	"VarI4FromDate\0"
+	"VarI4FromStr\0"
+	"VarI4FromDisp\0"
+	"VarI4FromBool\0"
+	"SafeArrayGetIID\0"
+	"VarR4FromUI1\0"
+	"VarR4FromI2\0"
+	"VarR4FromI4\0"
+	"VarR4FromR8\0"
+	"VarR4FromCy\0"
+	"VarR4FromDate\0"
+	"VarR4FromStr\0"
+	"VarR4FromDisp\0"
+	"VarR4FromBool\0"
+	"SafeArrayGetVartype\0"
+	"VarR8FromUI1\0"
+	"VarR8FromI2\0"
+	"VarR8FromI4\0"
+	"VarR8FromR4\0"
+	"VarR8FromCy\0"
+	"VarR8FromDate\0"
+	"VarR8FromStr\0"
+	"VarR8FromDisp\0"
+	"VarR8FromBool\0"
+	"VarFormat\0"
+	"VarDateFromUI1\0"
+	"VarDateFromI2\0"
+	"VarDateFromI4\0"
+	"VarDateFromR4\0"
+	"VarDateFromR8\0"
+	"VarDateFromCy\0"
+	"VarDateFromStr\0"
+	"VarDateFromDisp\0"
+	"VarDateFromBool\0"
+	"VarFormatDateTime\0"
+	"VarCyFromUI1\0"
+	"VarCyFromI2\0"
+	"VarCyFromI4\0"
+	"VarCyFromR4\0"
+	"VarCyFromR8\0"
+	"VarCyFromDate\0"
+	"VarCyFromStr\0"
+	"VarCyFromDisp\0"
+	"VarCyFromBool\0"
+	"VarFormatNumber\0"
+	"VarBstrFromUI1\0"
+	"VarBstrFromI2\0"
+	"VarBstrFromI4\0"
+	"VarBstrFromR4\0"
+	"VarBstrFromR8\0"
+	"VarBstrFromCy\0"
+	"VarBstrFromDate\0"
+	"VarBstrFromDisp\0"
+	"VarBstrFromBool\0"
+	"VarFormatPercent\0"
+	"VarBoolFromUI1\0"
+	"VarBoolFromI2\0"
+	"VarBoolFromI4\0"
+	"VarBoolFromR4\0"
+	"VarBoolFromR8\0"
+	"VarBoolFromDate\0"
+	"VarBoolFromCy\0"
+	"VarBoolFromStr\0"
+	"VarBoolFromDisp\0"
+	"VarFormatCurrency\0"
+	"VarWeekdayName\0"
+	"VarMonthName\0"
+	"VarUI1FromI2\0"
+	"VarUI1FromI4\0"
+	"VarUI1FromR4\0"
+	"VarUI1FromR8\0"
+	"VarUI1FromCy\0"
+	"VarUI1FromDate\0"
+	"VarUI1FromStr\0"
+	"VarUI1FromDisp\0"
+	"VarUI1FromBool\0"
+	"VarFormatFromTokens\0"
+	"VarTokenizeFormatString\0"
+	"VarAdd\0"
+	"VarAnd\0"
+	"VarDiv\0"
+	"DllCanUnloadNow\0"
+	"DllGetClassObject\0"
+	"DispCallFunc\0"
+	"VariantChangeTypeEx\0"
+	"SafeArrayPtrOfIndex\0"
+	"SysStringByteLen\0"
+	"SysAllocStringByteLen\0"
+	"DllRegisterServer\0"
+	"VarEqv\0"
+	"VarIdiv\0"
+	"VarImp\0"
+	"VarMod\0"
+	"VarMul\0"
+	"VarOr\0"
+	"VarPow\0"
+	"VarSub\0"
+	"CreateTypeLib\0"
+	"LoadTypeLib\0"
+	"LoadRegTypeLib\0"
+	"RegisterTypeLib\0"
+	"QueryPathOfRegTypeLib\0"
+	"LHashValOfNameSys\0"
+	"LHashValOfNameSysA\0"
+	"VarXor\0"
+	"VarAbs\0"
+	"VarFix\0"
+	"OaBuildVersion\0"
+	"ClearCustData\0"
+	"VarInt\0"
+	"VarNeg\0"
+	"VarNot\0"
+	"VarRound\0"
+	"VarCmp\0"
+	"VarDecAdd\0"
+	"VarDecDiv\0"
+	"VarDecMul\0"
+	"CreateTypeLib2\0"
+	"VarDecSub\0"
+	"VarDecAbs\0"
+	"LoadTypeLibEx\0"
+	"SystemTimeToVariantTime\0"
+	"VariantTimeToSystemTime\0"
+	"UnRegisterTypeLib\0"
+	"VarDecFix\0"
+	"VarDecInt\0"
+	"VarDecNeg\0"
+	"VarDecFromUI1\0"
+	"VarDecFromI2\0"
+	"VarDecFromI4\0"
+	"VarDecFromR4\0"
+	"VarDecFromR8\0"
+	"VarDecFromDate\0"
+	"VarDecFromCy\0"
+	"VarDecFromStr\0"
+	"VarDecFromDisp\0"
+	"VarDecFromBool\0"
+	"GetErrorInfo\0"
+	"SetErrorInfo\0"
+	"CreateErrorInfo\0"
+	"VarDecRound\0"
+	"VarDecCmp\0"
+	"VarI2FromI1\0"
+	"VarI2FromUI2\0"
+	"VarI2FromUI4\0"
+	"VarI2FromDec\0"
+	"VarI4FromI1\0"
+	"VarI4FromUI2\0"
+	"VarI4FromUI4\0"
+	"VarI4FromDec\0"
+	"VarR4FromI1\0"
+	"VarR4FromUI2\0"
+	"VarR4FromUI4\0"
+	"VarR4FromDec\0"
+	"VarR8FromI1\0"
+	"VarR8FromUI2\0"
+	"VarR8FromUI4\0"
+	"VarR8FromDec\0"
+	"VarDateFromI1\0"
+	"VarDateFromUI2\0"
+	"VarDateFromUI4\0"
+	"VarDateFromDec\0"
+	"VarCyFromI1\0"
+	"VarCyFromUI2\0"
+	"VarCyFromUI4\0"
+	"VarCyFromDec\0"
+	"VarBstrFromI1\0"
+	"VarBstrFromUI2\0"
+	"VarBstrFromUI4\0"
+	"VarBstrFromDec\0"
+	"VarBoolFromI1\0"
+	"VarBoolFromUI2\0"
+	"VarBoolFromUI4\0"
+	"VarBoolFromDec\0"
+	"VarUI1FromI1\0"
+	"VarUI1FromUI2\0"
+	"VarUI1FromUI4\0"
+	"VarUI1FromDec\0"
+	"VarDecFromI1\0"
+	"VarDecFromUI2\0"
+	"VarDecFromUI4\0"
+	"VarI1FromUI1\0"
+	"VarI1FromI2\0"
+	"VarI1FromI4\0"
+	"VarI1FromR4\0"
+	"VarI1FromR8\0"
+	"VarI1FromDate\0"
+	"VarI1FromCy\0"
+	"VarI1FromStr\0"
+	"VarI1FromDisp\0"
+	"VarI1FromBool\0"
+	"VarI1FromUI2\0"
+	"VarI1FromUI4\0"
+	"VarI1FromDec\0"
+	"VarUI2FromUI1\0"
+	"VarUI2FromI2\0"
+	"VarUI2FromI4\0"
+	"VarUI2FromR4\0"
+	"VarUI2FromR8\0"
+	"VarUI2FromDate\0"
+	"VarUI2FromCy\0"
+	"VarUI2FromStr\0"
+	"VarUI2FromDisp\0"
+	"VarUI2FromBool\0"
+	"VarUI2FromI1\0"
+	"VarUI2FromUI4\0"
+	"VarUI2FromDec\0"
+	"VarUI4FromUI1\0"
+	"VarUI4FromI2\0"
+	"VarUI4FromI4\0"
+	"VarUI4FromR4\0"
+	"VarUI4FromR8\0"
+	"VarUI4FromDate\0"
+	"VarUI4FromCy\0"
+	"VarUI4FromStr\0"
+	"VarUI4FromDisp\0"
+	"VarUI4FromBool\0"
+	"VarUI4FromI1\0"
+	"VarUI4FromUI2\0"
+	"VarUI4FromDec\0"
+	"BSTR_UserSize\0"
+	"BSTR_UserMarshal\0"
+	"BSTR_UserUnmarshal\0"
+	"BSTR_UserFree\0"
+	"VARIANT_UserSize\0"
+	"VARIANT_UserMarshal\0"
+	"VARIANT_UserUnmarshal\0"
+	"VARIANT_UserFree\0"
+	"LPSAFEARRAY_UserSize\0"
+	"LPSAFEARRAY_UserMarshal\0"
+	"LPSAFEARRAY_UserUnmarshal\0"
+	"LPSAFEARRAY_UserFree\0"
+	"LPSAFEARRAY_Size\0"
+	"LPSAFEARRAY_Marshal\0"
+	"LPSAFEARRAY_Unmarshal\0"
+	"VarDecCmpR8\0"
+	"VarCyAdd\0"
+	"DllUnregisterServer\0"
+	"OACreateTypeLib2\0"
+	"VarCyMul\0"
+	"VarCyMulI4\0"
+	"VarCySub\0"
+	"VarCyAbs\0"
+	"VarCyFix\0"
+	"VarCyInt\0"
+	"VarCyNeg\0"
+	"VarCyRound\0"
+	"VarCyCmp\0"
+	"VarCyCmpR8\0"
+	"VarBstrCat\0"
+	"VarBstrCmp\0"
+	"VarR8Pow\0"
+	"VarR4CmpR8\0"
+	"VarR8Round\0"
+	"VarCat\0"
+	"VarDateFromUdateEx\0"
+	"GetRecordInfoFromGuids\0"
+	"GetRecordInfoFromTypeInfo\0"
+	"SetVarConversionLocaleSetting\0"
+	"GetVarConversionLocaleSetting\0"
+	"SetOaNoCache\0"
+	"VarCyMulI8\0"
+	"VarDateFromUdate\0"
+	"VarUdateFromDate\0"
+	"GetAltMonthNames\0"
+	"VarI8FromUI1\0"
+	"VarI8FromI2\0"
+	"VarI8FromR4\0"
+	"VarI8FromR8\0"
+	"VarI8FromCy\0"
+	"VarI8FromDate\0"
+	"VarI8FromStr\0"
+	"VarI8FromDisp\0"
+	"VarI8FromBool\0"
+	"VarI8FromI1\0"
+	"VarI8FromUI2\0"
+	"VarI8FromUI4\0"
+	"VarI8FromDec\0"
+	"VarI2FromI8\0"
+	"VarI2FromUI8\0"
+	"VarI4FromI8\0"
+	"VarI4FromUI8\0"
+	"VarR4FromI8\0"
+	"VarR4FromUI8\0"
+	"VarR8FromI8\0"
+	"VarR8FromUI8\0"
+	"VarDateFromI8\0"
+	"VarDateFromUI8\0"
+	"VarCyFromI8\0"
+	"VarCyFromUI8\0"
+	"VarBstrFromI8\0"
+	"VarBstrFromUI8\0"
+	"VarBoolFromI8\0"
+	"VarBoolFromUI8\0"
+	"VarUI1FromI8\0"
+	"VarUI1FromUI8\0"
+	"VarDecFromI8\0"
+	"VarDecFromUI8\0"
+	"VarI1FromI8\0"
+	"VarI1FromUI8\0"
+	"VarUI2FromI8\0"
+	"VarUI2FromUI8\0"
+	"OleLoadPictureEx\0"
+	"OleLoadPictureFileEx\0"
+	"SafeArrayCreateVector\0"
+	"SafeArrayCopyData\0"
+	"VectorFromBstr\0"
+	"BstrFromVector\0"
+	"OleIconToCursor\0"
+	"OleCreatePropertyFrameIndirect\0"
+	"OleCreatePropertyFrame\0"
+	"OleLoadPicture\0"
+	"OleCreatePictureIndirect\0"
+	"OleCreateFontIndirect\0"
+	"OleTranslateColor\0"
+	"OleLoadPictureFile\0"
+	"OleSavePictureFile\0"
+	"OleLoadPicturePath\0"
+	"VarUI4FromI8\0"
+	"VarUI4FromUI8\0"
+	"VarI8FromUI8\0"
+	"VarUI8FromI8\0"
+	"VarUI8FromUI1\0"
+	"VarUI8FromI2\0"
+	"VarUI8FromR4\0"
+	"VarUI8FromR8\0"
+	"VarUI8FromCy\0"
+	"VarUI8FromDate\0"
+	"VarUI8FromStr\0"
+	"VarUI8FromDisp\0"
+	"VarUI8FromBool\0"
+	"VarUI8FromI1\0"
+	"VarUI8FromUI2\0"
+	"VarUI8FromUI4\0"
+	"VarUI8FromDec\0"
+	"RegisterTypeLibForUser\0"
+	"UnRegisterTypeLibForUser\0"
+	"accept\0"
+	"bind\0"
+	"closesocket\0"
+	"connect\0"
+	"getpeername\0"
+	"getsockname\0"
+	"getsockopt\0"
+	"htonl\0"
+	"htons\0"
+	"ioctlsocket\0"
+	"inet_addr\0"
+	"inet_ntoa\0"
+	"listen\0"
+	"ntohl\0"
+	"ntohs\0"
+	"recv\0"
+	"recvfrom\0"
+	"select\0"
+	"send\0"
+	"sendto\0"
+	"setsockopt\0"
+	"shutdown\0"
+	"socket\0"
+	"GetAddrInfoW\0"
+	"GetNameInfoW\0"
+	"WSApSetPostRoutine\0"
+	"FreeAddrInfoW\0"
+	"WPUCompleteOverlappedRequest\0"
+	"WSAAccept\0"
+	"WSAAddressToStringA\0"
+	"WSAAddressToStringW\0"
+	"WSACloseEvent\0"
+	"WSAConnect\0"
+	"WSACreateEvent\0"
+	"WSADuplicateSocketA\0"
+	"WSADuplicateSocketW\0"
+	"WSAEnumNameSpaceProvidersA\0"
+	"WSAEnumNameSpaceProvidersW\0"
+	"WSAEnumNetworkEvents\0"
+	"WSAEnumProtocolsA\0"
+	"WSAEnumProtocolsW\0"
+	"WSAEventSelect\0"
+	"WSAGetOverlappedResult\0"
+	"WSAGetQOSByName\0"
+	"WSAGetServiceClassInfoA\0"
+	"WSAGetServiceClassInfoW\0"
+	"WSAGetServiceClassNameByClassIdA\0"
+	"WSAGetServiceClassNameByClassIdW\0"
+	"WSAHtonl\0"
+	"WSAHtons\0"
+	"gethostbyaddr\0"
+	"gethostbyname\0"
+	"getprotobyname\0"
+	"getprotobynumber\0"
+	"getservbyname\0"
+	"getservbyport\0"
+	"gethostname\0"
+	"WSAInstallServiceClassA\0"
+	"WSAInstallServiceClassW\0"
+	"WSAIoctl\0"
+	"WSAJoinLeaf\0"
+	"WSALookupServiceBeginA\0"
+	"WSALookupServiceBeginW\0"
+	"WSALookupServiceEnd\0"
+	"WSALookupServiceNextA\0"
+	"WSALookupServiceNextW\0"
+	"WSANSPIoctl\0"
+	"WSANtohl\0"
+	"WSANtohs\0"
+	"WSAProviderConfigChange\0"
+	"WSARecv\0"
+	"WSARecvDisconnect\0"
+	"WSARecvFrom\0"
+	"WSARemoveServiceClass\0"
+	"WSAResetEvent\0"
+	"WSASend\0"
+	"WSASendDisconnect\0"
+	"WSASendTo\0"
+	"WSASetEvent\0"
+	"WSASetServiceA\0"
+	"WSASetServiceW\0"
+	"WSASocketA\0"
+	"WSASocketW\0"
+	"WSAStringToAddressA\0"
+	"WSAStringToAddressW\0"
+	"WSAWaitForMultipleEvents\0"
+	"WSCDeinstallProvider\0"
+	"WSCEnableNSProvider\0"
+	"WSCEnumProtocols\0"
+	"WSCGetProviderPath\0"
+	"WSCInstallNameSpace\0"
+	"WSCInstallProvider\0"
+	"WSCUnInstallNameSpace\0"
+	"WSCUpdateProvider\0"
+	"WSCWriteNameSpaceOrder\0"
+	"WSCWriteProviderOrder\0"
+	"freeaddrinfo\0"
+	"getaddrinfo\0"
+	"getnameinfo\0"
+	"WSAAsyncSelect\0"
+	"WSAAsyncGetHostByAddr\0"
+	"WSAAsyncGetHostByName\0"
+	"WSAAsyncGetProtoByNumber\0"
+	"WSAAsyncGetProtoByName\0"
+	"WSAAsyncGetServByPort\0"
+	"WSAAsyncGetServByName\0"
+	"WSACancelAsyncRequest\0"
+	"WSASetBlockingHook\0"
+	"WSAUnhookBlockingHook\0"
+	"WSAGetLastError\0"
+	"WSASetLastError\0"
+	"WSACancelBlockingCall\0"
+	"WSAIsBlocking\0"
+	"WSAStartup\0"
+	"WSACleanup\0"
+	"__WSAFDIsSet\0"
+	"WEP\0";
+
+/* End of the tables generated by scripts/generate_ordinal_names.py
+ */
+
+/* Calculates the hash of a module name
+ * The hash is a 32-bit FNV-1a of the lower case module name including the extension
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_ordinal_names_get_module_name_hash(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     uint32_t *module_name_hash,
+     libcerror_error_t **error )
+{
+	static char *function    = "libexe_ordinal_names_get_module_name_hash";
+	size_t module_name_index = 0;
+	uint32_t hash            = 0x811c9dc5UL;
+	uint8_t character        = 0;
+
+	if( module_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module name.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid module name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module name hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( module_name_index = 0;
+	     module_name_index < module_name_length;
+	     module_name_index++ )
+	{
+		character = module_name[ module_name_index ];
+
+		if( ( character >= (uint8_t) 'A' )
+		 && ( character <= (uint8_t) 'Z' ) )
+		{
+			character += (uint8_t) ( 'a' - 'A' );
+		}
+		hash ^= character;
+		hash *= 0x01000193UL;
+	}
+	*module_name_hash = hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a module name hash and ordinal key
+ * Returns the key hash
+ */
+uint32_t libexe_ordinal_names_get_key_hash(
+          uint32_t module_name_hash,
+          uint16_t ordinal,
+          uint32_t seed )
+{
+	uint32_t hash = 0;
+
+	hash  = module_name_hash;
+	hash += (uint32_t) ordinal * 0x9e3779b1UL;
+	hash += seed * 0x85ebca6bUL;
+
+	/* Mix the bits as the 32-bit MurmurHash3 finalizer
+	 */
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bUL;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35UL;
+	hash ^= hash >> 16;
+
+	return( hash );
+}
+
+/* Retrieves the name of a function imported by ordinal
+ * The module name hash must be the hash of the module name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_ordinal_names_get_name(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     uint32_t module_name_hash,
+     uint16_t ordinal,
+     const char **name,
+     libcerror_error_t **error )
+{
+	const libexe_ordinal_name_t *entry = NULL;
+	const char *entry_module_name      = NULL;
+	static char *function              = "libexe_ordinal_names_get_name";
+	size_t module_name_index           = 0;
+	uint32_t bucket_index              = 0;
+	uint32_t entry_index               = 0;
+	uint8_t character                  = 0;
+
+	if( module_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module name.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid module name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libexe_ordinal_names_get_key_hash(
+	                module_name_hash,
+	                ordinal,
+	                0 ) % LIBEXE_ORDINAL_NAMES_NUMBER_OF_BUCKETS;
+
+	entry_index = libexe_ordinal_names_get_key_hash(
+	               module_name_hash,
+	               ordinal,
+	               (uint32_t) libexe_ordinal_names_seeds[ bucket_index ] ) % LIBEXE_ORDINAL_NAMES_NUMBER_OF_NAMES;
+
+	entry = &( libexe_ordinal_names_entries[ entry_index ] );
+
+	if( ( entry->module_name_hash != module_name_hash )
+	 || ( entry->ordinal != ordinal ) )
+	{
+		return( 0 );
+	}
+	/* Different module names can have the same hash
+	 */
+	entry_module_name = &( libexe_ordinal_names_strings[ entry->module_name_offset ] );
+
+	for( module_name_index = 0;
+	     module_name_index < module_name_length;
+	     module_name_index++ )
+	{
+		character = module_name[ module_name_index ];
+
+		if( ( character >= (uint8_t) 'A' )
+		 && ( character <= (uint8_t) 'Z' ) )
+		{
+			character += (uint8_t) ( 'a' - 'A' );
+		}
+		if( ( entry_module_name[ module_name_index ] == 0 )
+		 || ( (uint8_t) entry_module_name[ module_name_index ] != character ) )
+		{
+			return( 0 );
+		}
+	}
+	if( entry_module_name[ module_name_index ] != 0 )
+	{
+		return( 0 );
+	}
+	*name = &( libexe_ordinal_names_strings[ entry->name_offset ] );
+
+	return( 1 );
+}
+
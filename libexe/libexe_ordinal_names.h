@@ -0,0 +1,79 @@
+/*
+ * Ordinal name functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_ORDINAL_NAMES_H )
+#define _LIBEXE_ORDINAL_NAMES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_ordinal_name libexe_ordinal_name_t;
+
+struct libexe_ordinal_name
+{
+	/* The module name hash
+	 */
+	uint32_t module_name_hash;
+
+	/* The ordinal
+	 */
+	uint16_t ordinal;
+
+	/* The offset of the lower case module name in the strings
+	 */
+	uint16_t module_name_offset;
+
+	/* The offset of the name in the strings
+	 */
+	uint16_t name_offset;
+};
+
+int libexe_ordinal_names_get_module_name_hash(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     uint32_t *module_name_hash,
+     libcerror_error_t **error );
+
+uint32_t libexe_ordinal_names_get_key_hash(
+          uint32_t module_name_hash,
+          uint16_t ordinal,
+          uint32_t seed );
+
+int libexe_ordinal_names_get_name(
+     const uint8_t *module_name,
+     size_t module_name_length,
+     uint32_t module_name_hash,
+     uint16_t ordinal,
+     const char **name,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_ORDINAL_NAMES_H ) */
+
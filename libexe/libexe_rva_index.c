@@ -0,0 +1,1001 @@
+/*
+ * Relative virtual address (RVA) index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+
+#define LIBEXE_HAVE_AVX2_RVA_SCAN	1
+
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+
+#define LIBEXE_HAVE_SSE2_RVA_SCAN	1
+
+#endif
+
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_rva_index.h"
+#include "libexe_section_descriptor.h"
+
+/* Creates a RVA index
+ * Make sure the value rva_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_initialize(
+     libexe_rva_index_t **rva_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_index_initialize";
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rva_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid RVA index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*rva_index = memory_allocate_structure(
+	              libexe_rva_index_t );
+
+	if( *rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RVA index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rva_index,
+	     0,
+	     sizeof( libexe_rva_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear RVA index.",
+		 function );
+
+		memory_free(
+		 *rva_index );
+
+		*rva_index = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *rva_index != NULL )
+	{
+		memory_free(
+		 *rva_index );
+
+		*rva_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a RVA index
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_free(
+     libexe_rva_index_t **rva_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_index_free";
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rva_index != NULL )
+	{
+		if( ( *rva_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *rva_index )->entries );
+		}
+		memory_free(
+		 *rva_index );
+
+		*rva_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a RVA index
+ * The allocated entries are retained so that the RVA index can be reused
+ * without reallocating when the sections are set again
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_clear(
+     libexe_rva_index_t *rva_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_index_clear";
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	rva_index->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Compares two RVA index entries by virtual address and section index
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+int libexe_rva_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libexe_rva_index_entry_t *first  = (const libexe_rva_index_entry_t *) first_entry;
+	const libexe_rva_index_entry_t *second = (const libexe_rva_index_entry_t *) second_entry;
+
+	if( first->virtual_address < second->virtual_address )
+	{
+		return( -1 );
+	}
+	else if( first->virtual_address > second->virtual_address )
+	{
+		return( 1 );
+	}
+	if( first->section_index < second->section_index )
+	{
+		return( -1 );
+	}
+	else if( first->section_index > second->section_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the sections of the RVA index
+ * The address range of a section is the larger of its virtual and data size.
+ * Sections without an address range are not indexed. When sections overlap
+ * the address range of a section ends where the next section starts and of
+ * sections with the same virtual address the first in the section table is used.
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_set_sections(
+     libexe_rva_index_t *rva_index,
+     libcdata_array_t *sections_array,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entries               = NULL;
+	libexe_rva_index_entry_t *entry                 = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_rva_index_set_sections";
+	size64_t data_size                              = 0;
+	off64_t data_offset                             = 0;
+	uint32_t maximum_size                           = 0;
+	uint32_t virtual_size                           = 0;
+	int entry_index                                 = 0;
+	int number_of_entries                           = 0;
+	int number_of_sections                          = 0;
+	int number_of_sorted_entries                    = 0;
+	int section_index                               = 0;
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( rva_index->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid RVA index - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sections == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_sections < 0 )
+	 || ( (size_t) number_of_sections > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libexe_rva_index_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sections value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries of a previous use of the RVA index are reused when there are enough
+	 */
+	if( number_of_sections > rva_index->number_of_allocated_entries )
+	{
+		entries = (libexe_rva_index_entry_t *) memory_reallocate(
+		                                        rva_index->entries,
+		                                        sizeof( libexe_rva_index_entry_t ) * number_of_sections );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		rva_index->entries                     = entries;
+		rva_index->number_of_allocated_entries = number_of_sections;
+	}
+	entries = rva_index->entries;
+
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sections_array,
+		     section_index,
+		     (intptr_t **) &section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( libexe_section_descriptor_get_data_range(
+		     section_descriptor,
+		     &data_offset,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section descriptor: %d data range.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		if( ( data_offset < 0 )
+		 || ( data_offset > (off64_t) UINT32_MAX )
+		 || ( data_size > (size64_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid section descriptor: %d data range value out of bounds.",
+			 function,
+			 section_index );
+
+			goto on_error;
+		}
+		virtual_size = section_descriptor->virtual_size;
+
+		if( virtual_size < (uint32_t) data_size )
+		{
+			virtual_size = (uint32_t) data_size;
+		}
+		if( virtual_size == 0 )
+		{
+			continue;
+		}
+		/* Make sure the address range does not exceed the 32-bit address space
+		 */
+		if( section_descriptor->virtual_address > 0 )
+		{
+			maximum_size = (uint32_t) ( ( (uint64_t) 1 << 32 ) - section_descriptor->virtual_address );
+
+			if( virtual_size > maximum_size )
+			{
+				virtual_size = maximum_size;
+			}
+		}
+		entry = &( entries[ number_of_entries++ ] );
+
+		entry->virtual_address = section_descriptor->virtual_address;
+		entry->virtual_size    = virtual_size;
+		entry->data_offset     = (uint32_t) data_offset;
+		entry->data_size       = (uint32_t) data_size;
+		entry->section_index   = section_index;
+	}
+	qsort(
+	 entries,
+	 (size_t) number_of_entries,
+	 sizeof( libexe_rva_index_entry_t ),
+	 &libexe_rva_index_entry_compare );
+
+	/* Remove sections that share a virtual address with an earlier section
+	 */
+	number_of_sorted_entries = number_of_entries;
+	number_of_entries        = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_sorted_entries;
+	     entry_index++ )
+	{
+		if( ( number_of_entries > 0 )
+		 && ( entries[ number_of_entries - 1 ].virtual_address == entries[ entry_index ].virtual_address ) )
+		{
+			continue;
+		}
+		if( number_of_entries != entry_index )
+		{
+			entries[ number_of_entries ] = entries[ entry_index ];
+		}
+		number_of_entries++;
+	}
+	/* Truncate sections that overlap with the next section
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( entries[ entry_index ] );
+
+		if( entry_index < ( number_of_entries - 1 ) )
+		{
+			maximum_size = entries[ entry_index + 1 ].virtual_address - entry->virtual_address;
+
+			if( entry->virtual_size > maximum_size )
+			{
+				entry->virtual_size = maximum_size;
+			}
+		}
+		if( entry->data_size > entry->virtual_size )
+		{
+			entry->data_size = entry->virtual_size;
+		}
+	}
+	rva_index->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Retrieves the entry that contains a specific relative virtual address (RVA)
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libexe_rva_index_get_entry_by_rva(
+     libexe_rva_index_t *rva_index,
+     uint32_t relative_virtual_address,
+     libexe_rva_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *safe_entry = NULL;
+	static char *function                = "libexe_rva_index_get_entry_by_rva";
+	int entry_index                      = 0;
+	int lower_index                      = 0;
+	int upper_index                      = 0;
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last entry with a virtual address less than or equal to the RVA
+	 */
+	lower_index = 0;
+	upper_index = rva_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( rva_index->entries[ entry_index ].virtual_address <= relative_virtual_address )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	safe_entry = &( rva_index->entries[ lower_index - 1 ] );
+
+	if( ( relative_virtual_address - safe_entry->virtual_address ) >= safe_entry->virtual_size )
+	{
+		return( 0 );
+	}
+	*entry = safe_entry;
+
+	return( 1 );
+}
+
+/* Retrieves the file offset of a specific relative virtual address (RVA)
+ * Returns 1 if successful, 0 if the RVA is not stored in the file or -1 on error
+ */
+int libexe_rva_index_get_offset_by_rva(
+     libexe_rva_index_t *rva_index,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entry = NULL;
+	static char *function           = "libexe_rva_index_get_offset_by_rva";
+	uint32_t relative_offset        = 0;
+	int result                      = 0;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_index_get_entry_by_rva(
+	          rva_index,
+	          relative_virtual_address,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry for RVA: 0x%08" PRIx32 ".",
+		 function,
+		 relative_virtual_address );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		relative_offset = relative_virtual_address - entry->virtual_address;
+
+		if( relative_offset < entry->data_size )
+		{
+			*offset = (off64_t) entry->data_offset + relative_offset;
+
+			return( 1 );
+		}
+	}
+	*offset = 0;
+
+	return( 0 );
+}
+
+/* Retrieves the file offsets of multiple relative virtual addresses (RVAs)
+ * For every RVA the status is set to 1 if the RVA is stored in the file or 0 if not,
+ * in which case the offset is set to 0. The status array is optional
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_get_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_index_get_offsets_by_rvas";
+	int result            = 0;
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual addresses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_relative_virtual_addresses > (size_t) ( SSIZE_MAX / sizeof( off64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of relative virtual addresses value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	/* Comparing every RVA with every entry is cheaper than a search
+	 * for the number of sections found in most executables
+	 */
+	if( rva_index->number_of_entries <= LIBEXE_RVA_INDEX_MAXIMUM_NUMBER_OF_SCAN_ENTRIES )
+	{
+		result = libexe_rva_index_scan_offsets_by_rvas(
+		          rva_index,
+		          relative_virtual_addresses,
+		          number_of_relative_virtual_addresses,
+		          offsets,
+		          status,
+		          error );
+	}
+	else
+	{
+		result = libexe_rva_index_search_offsets_by_rvas(
+		          rva_index,
+		          relative_virtual_addresses,
+		          number_of_relative_virtual_addresses,
+		          offsets,
+		          status,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offsets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file offsets of multiple relative virtual addresses (RVAs)
+ * by comparing every RVA with every entry
+ * The comparisons are branch-free and use SSE2 or AVX2 when available
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_scan_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entry   = NULL;
+	static char *function             = "libexe_rva_index_scan_offsets_by_rvas";
+	size_t rva_index_value            = 0;
+	uint32_t data_offset              = 0;
+	uint32_t found_mask               = 0;
+	uint32_t hit_mask                 = 0;
+	uint32_t relative_offset          = 0;
+	uint32_t relative_virtual_address = 0;
+	uint32_t selected_offset          = 0;
+	int entry_index                   = 0;
+
+#if defined( LIBEXE_HAVE_AVX2_RVA_SCAN ) || defined( LIBEXE_HAVE_SSE2_RVA_SCAN )
+	uint32_t vector_data_offsets[ 8 ];
+	uint32_t vector_found_masks[ 8 ];
+	uint32_t vector_relative_offsets[ 8 ];
+	size_t lane_index                 = 0;
+#endif
+#if defined( LIBEXE_HAVE_AVX2_RVA_SCAN )
+	__m256i vector_bias               = _mm256_set1_epi32( (int) 0x80000000UL );
+	__m256i vector_data_offset        = _mm256_setzero_si256();
+	__m256i vector_found_mask         = _mm256_setzero_si256();
+	__m256i vector_hit_mask           = _mm256_setzero_si256();
+	__m256i vector_relative_offset    = _mm256_setzero_si256();
+	__m256i vector_rvas               = _mm256_setzero_si256();
+	__m256i vector_selected_offset    = _mm256_setzero_si256();
+#elif defined( LIBEXE_HAVE_SSE2_RVA_SCAN )
+	__m128i vector_bias               = _mm_set1_epi32( (int) 0x80000000UL );
+	__m128i vector_data_offset        = _mm_setzero_si128();
+	__m128i vector_found_mask         = _mm_setzero_si128();
+	__m128i vector_hit_mask           = _mm_setzero_si128();
+	__m128i vector_relative_offset    = _mm_setzero_si128();
+	__m128i vector_rvas               = _mm_setzero_si128();
+	__m128i vector_selected_offset    = _mm_setzero_si128();
+#endif
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual addresses.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries do not overlap hence at most one entry matches an RVA.
+	 * The data offset and relative offset of the matching entry are selected
+	 * with masks and only added as 64-bit values to prevent 32-bit overflow.
+	 * The unsigned comparison relative offset < data size also rejects RVAs
+	 * before the start of the entry, since the subtraction wraps around.
+	 */
+#if defined( LIBEXE_HAVE_AVX2_RVA_SCAN )
+	while( ( rva_index_value + 8 ) <= number_of_relative_virtual_addresses )
+	{
+		vector_rvas            = _mm256_loadu_si256( (const __m256i *) &( relative_virtual_addresses[ rva_index_value ] ) );
+		vector_data_offset     = _mm256_setzero_si256();
+		vector_relative_offset = _mm256_setzero_si256();
+		vector_found_mask      = _mm256_setzero_si256();
+
+		for( entry_index = 0;
+		     entry_index < rva_index->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( rva_index->entries[ entry_index ] );
+
+			vector_selected_offset = _mm256_sub_epi32(
+			                          vector_rvas,
+			                          _mm256_set1_epi32( (int) entry->virtual_address ) );
+
+			vector_hit_mask = _mm256_cmpgt_epi32(
+			                   _mm256_set1_epi32( (int) ( entry->data_size ^ 0x80000000UL ) ),
+			                   _mm256_xor_si256( vector_selected_offset, vector_bias ) );
+
+			vector_data_offset = _mm256_or_si256(
+			                      vector_data_offset,
+			                      _mm256_and_si256( vector_hit_mask, _mm256_set1_epi32( (int) entry->data_offset ) ) );
+
+			vector_relative_offset = _mm256_or_si256(
+			                          vector_relative_offset,
+			                          _mm256_and_si256( vector_hit_mask, vector_selected_offset ) );
+
+			vector_found_mask = _mm256_or_si256(
+			                     vector_found_mask,
+			                     vector_hit_mask );
+		}
+		_mm256_storeu_si256( (__m256i *) vector_data_offsets, vector_data_offset );
+		_mm256_storeu_si256( (__m256i *) vector_relative_offsets, vector_relative_offset );
+		_mm256_storeu_si256( (__m256i *) vector_found_masks, vector_found_mask );
+
+		for( lane_index = 0;
+		     lane_index < 8;
+		     lane_index++ )
+		{
+			offsets[ rva_index_value + lane_index ] = (off64_t) vector_data_offsets[ lane_index ] + vector_relative_offsets[ lane_index ];
+
+			if( status != NULL )
+			{
+				status[ rva_index_value + lane_index ] = (uint8_t) ( vector_found_masks[ lane_index ] & 1 );
+			}
+		}
+		rva_index_value += 8;
+	}
+#elif defined( LIBEXE_HAVE_SSE2_RVA_SCAN )
+	while( ( rva_index_value + 4 ) <= number_of_relative_virtual_addresses )
+	{
+		vector_rvas            = _mm_loadu_si128( (const __m128i *) &( relative_virtual_addresses[ rva_index_value ] ) );
+		vector_data_offset     = _mm_setzero_si128();
+		vector_relative_offset = _mm_setzero_si128();
+		vector_found_mask      = _mm_setzero_si128();
+
+		for( entry_index = 0;
+		     entry_index < rva_index->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( rva_index->entries[ entry_index ] );
+
+			vector_selected_offset = _mm_sub_epi32(
+			                          vector_rvas,
+			                          _mm_set1_epi32( (int) entry->virtual_address ) );
+
+			vector_hit_mask = _mm_cmplt_epi32(
+			                   _mm_xor_si128( vector_selected_offset, vector_bias ),
+			                   _mm_set1_epi32( (int) ( entry->data_size ^ 0x80000000UL ) ) );
+
+			vector_data_offset = _mm_or_si128(
+			                      vector_data_offset,
+			                      _mm_and_si128( vector_hit_mask, _mm_set1_epi32( (int) entry->data_offset ) ) );
+
+			vector_relative_offset = _mm_or_si128(
+			                          vector_relative_offset,
+			                          _mm_and_si128( vector_hit_mask, vector_selected_offset ) );
+
+			vector_found_mask = _mm_or_si128(
+			                     vector_found_mask,
+			                     vector_hit_mask );
+		}
+		_mm_storeu_si128( (__m128i *) vector_data_offsets, vector_data_offset );
+		_mm_storeu_si128( (__m128i *) vector_relative_offsets, vector_relative_offset );
+		_mm_storeu_si128( (__m128i *) vector_found_masks, vector_found_mask );
+
+		for( lane_index = 0;
+		     lane_index < 4;
+		     lane_index++ )
+		{
+			offsets[ rva_index_value + lane_index ] = (off64_t) vector_data_offsets[ lane_index ] + vector_relative_offsets[ lane_index ];
+
+			if( status != NULL )
+			{
+				status[ rva_index_value + lane_index ] = (uint8_t) ( vector_found_masks[ lane_index ] & 1 );
+			}
+		}
+		rva_index_value += 4;
+	}
+#endif
+	while( rva_index_value < number_of_relative_virtual_addresses )
+	{
+		relative_virtual_address = relative_virtual_addresses[ rva_index_value ];
+		data_offset              = 0;
+		selected_offset          = 0;
+		found_mask               = 0;
+
+		for( entry_index = 0;
+		     entry_index < rva_index->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( rva_index->entries[ entry_index ] );
+
+			relative_offset = relative_virtual_address - entry->virtual_address;
+			hit_mask        = (uint32_t) 0 - (uint32_t) ( relative_offset < entry->data_size );
+
+			data_offset     |= hit_mask & entry->data_offset;
+			selected_offset |= hit_mask & relative_offset;
+			found_mask      |= hit_mask;
+		}
+		offsets[ rva_index_value ] = (off64_t) data_offset + selected_offset;
+
+		if( status != NULL )
+		{
+			status[ rva_index_value ] = (uint8_t) ( found_mask & 1 );
+		}
+		rva_index_value++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the file offsets of multiple relative virtual addresses (RVAs)
+ * by a branch-free binary search of the entries per RVA
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_index_search_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entry   = NULL;
+	static char *function             = "libexe_rva_index_search_offsets_by_rvas";
+	size_t rva_index_value            = 0;
+	uint32_t found_mask               = 0;
+	uint32_t relative_offset          = 0;
+	uint32_t relative_virtual_address = 0;
+	int entry_index                   = 0;
+	int half_number_of_entries        = 0;
+	int number_of_entries             = 0;
+
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_virtual_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative virtual addresses.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	for( rva_index_value = 0;
+	     rva_index_value < number_of_relative_virtual_addresses;
+	     rva_index_value++ )
+	{
+		relative_virtual_address = relative_virtual_addresses[ rva_index_value ];
+		found_mask               = 0;
+		relative_offset          = 0;
+
+		if( rva_index->number_of_entries > 0 )
+		{
+			/* Find the last entry with a virtual address less than or equal to the RVA
+			 * or the first entry if there is none. The number of iterations only
+			 * depends on the number of entries
+			 */
+			entry_index       = 0;
+			number_of_entries = rva_index->number_of_entries;
+
+			while( number_of_entries > 1 )
+			{
+				half_number_of_entries = number_of_entries / 2;
+
+				entry_index += ( rva_index->entries[ entry_index + half_number_of_entries ].virtual_address <= relative_virtual_address ) ? half_number_of_entries : 0;
+
+				number_of_entries -= half_number_of_entries;
+			}
+			entry = &( rva_index->entries[ entry_index ] );
+
+			/* The subtraction wraps around if the RVA is before the first entry
+			 * which results in a relative offset that exceeds the data size
+			 */
+			relative_offset = relative_virtual_address - entry->virtual_address;
+			found_mask      = (uint32_t) 0 - (uint32_t) ( relative_offset < entry->data_size );
+
+			offsets[ rva_index_value ] = (off64_t) ( found_mask & entry->data_offset ) + ( found_mask & relative_offset );
+		}
+		else
+		{
+			offsets[ rva_index_value ] = 0;
+		}
+		if( status != NULL )
+		{
+			status[ rva_index_value ] = (uint8_t) ( found_mask & 1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,147 @@
+/*
+ * Relative virtual address (RVA) index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_RVA_INDEX_H )
+#define _LIBEXE_RVA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of entries for which every RVA is compared with every entry
+ * instead of searching the entries per RVA
+ */
+#define LIBEXE_RVA_INDEX_MAXIMUM_NUMBER_OF_SCAN_ENTRIES		32
+
+typedef struct libexe_rva_index_entry libexe_rva_index_entry_t;
+
+struct libexe_rva_index_entry
+{
+	/* The virtual address
+	 */
+	uint32_t virtual_address;
+
+	/* The virtual size
+	 * This is the size of the address range covered by the section
+	 */
+	uint32_t virtual_size;
+
+	/* The data offset
+	 */
+	uint32_t data_offset;
+
+	/* The data size
+	 * This is the size of the address range that is stored in the file
+	 */
+	uint32_t data_size;
+
+	/* The section index
+	 */
+	int section_index;
+};
+
+typedef struct libexe_rva_index libexe_rva_index_t;
+
+struct libexe_rva_index
+{
+	/* The entries sorted by virtual address
+	 */
+	libexe_rva_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 * The entries are retained when the RVA index is cleared
+	 */
+	int number_of_allocated_entries;
+};
+
+int libexe_rva_index_initialize(
+     libexe_rva_index_t **rva_index,
+     libcerror_error_t **error );
+
+int libexe_rva_index_free(
+     libexe_rva_index_t **rva_index,
+     libcerror_error_t **error );
+
+int libexe_rva_index_clear(
+     libexe_rva_index_t *rva_index,
+     libcerror_error_t **error );
+
+int libexe_rva_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libexe_rva_index_set_sections(
+     libexe_rva_index_t *rva_index,
+     libcdata_array_t *sections_array,
+     libcerror_error_t **error );
+
+int libexe_rva_index_get_entry_by_rva(
+     libexe_rva_index_t *rva_index,
+     uint32_t relative_virtual_address,
+     libexe_rva_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libexe_rva_index_get_offset_by_rva(
+     libexe_rva_index_t *rva_index,
+     uint32_t relative_virtual_address,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+int libexe_rva_index_get_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error );
+
+int libexe_rva_index_scan_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error );
+
+int libexe_rva_index_search_offsets_by_rvas(
+     libexe_rva_index_t *rva_index,
+     const uint32_t *relative_virtual_addresses,
+     size_t number_of_relative_virtual_addresses,
+     off64_t *offsets,
+     uint8_t *status,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_RVA_INDEX_H ) */
+
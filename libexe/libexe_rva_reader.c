@@ -0,0 +1,460 @@
+/*
+ * Relative virtual address (RVA) reader functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_rva_index.h"
+#include "libexe_rva_reader.h"
+
+/* Creates a RVA reader
+ * The RVA reader reads the data of the sections that contain the RVAs on first use,
+ * the file IO handle and RVA index must remain valid while the RVA reader is used
+ * Make sure the value rva_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_reader_initialize(
+     libexe_rva_reader_t **rva_reader,
+     libbfio_handle_t *file_io_handle,
+     libexe_rva_index_t *rva_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_reader_initialize";
+	size_t entries_size   = 0;
+
+	if( rva_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rva_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid RVA reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( rva_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA index.",
+		 function );
+
+		return( -1 );
+	}
+	*rva_reader = memory_allocate_structure(
+	               libexe_rva_reader_t );
+
+	if( *rva_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RVA reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *rva_reader,
+	     0,
+	     sizeof( libexe_rva_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear RVA reader.",
+		 function );
+
+		memory_free(
+		 *rva_reader );
+
+		*rva_reader = NULL;
+
+		return( -1 );
+	}
+	if( rva_index->number_of_entries > 0 )
+	{
+		entries_size = sizeof( uint8_t * ) * rva_index->number_of_entries;
+
+		( *rva_reader )->entries_data = (uint8_t **) memory_allocate(
+		                                              entries_size );
+
+		if( ( *rva_reader )->entries_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *rva_reader )->entries_data,
+		     0,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *rva_reader )->file_io_handle    = file_io_handle;
+	( *rva_reader )->rva_index         = rva_index;
+	( *rva_reader )->number_of_entries = rva_index->number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *rva_reader != NULL )
+	{
+		if( ( *rva_reader )->entries_data != NULL )
+		{
+			memory_free(
+			 ( *rva_reader )->entries_data );
+		}
+		memory_free(
+		 *rva_reader );
+
+		*rva_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a RVA reader
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_rva_reader_free(
+     libexe_rva_reader_t **rva_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_rva_reader_free";
+	int entry_index       = 0;
+
+	if( rva_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *rva_reader != NULL )
+	{
+		if( ( *rva_reader )->entries_data != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *rva_reader )->number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *rva_reader )->entries_data[ entry_index ] != NULL )
+				{
+					memory_free(
+					 ( *rva_reader )->entries_data[ entry_index ] );
+				}
+			}
+			memory_free(
+			 ( *rva_reader )->entries_data );
+		}
+		memory_free(
+		 *rva_reader );
+
+		*rva_reader = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific relative virtual address (RVA)
+ * The data is read from the section that contains the RVA on first use. The data size
+ * is the number of bytes from the RVA to the end of the section data stored in the file
+ * Returns 1 if successful, 0 if the RVA is not stored in the file or -1 on error
+ */
+int libexe_rva_reader_get_data(
+     libexe_rva_reader_t *rva_reader,
+     uint32_t relative_virtual_address,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libexe_rva_index_entry_t *entry = NULL;
+	static char *function           = "libexe_rva_reader_get_data";
+	ssize_t read_count              = 0;
+	uint32_t relative_offset        = 0;
+	int entry_index                 = 0;
+	int result                      = 0;
+
+	if( rva_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RVA reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_index_get_entry_by_rva(
+	          rva_reader->rva_index,
+	          relative_virtual_address,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry for RVA: 0x%08" PRIx32 ".",
+		 function,
+		 relative_virtual_address );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	relative_offset = relative_virtual_address - entry->virtual_address;
+
+	if( relative_offset >= entry->data_size )
+	{
+		return( 0 );
+	}
+	entry_index = (int) ( entry - rva_reader->rva_index->entries );
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= rva_reader->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( rva_reader->entries_data[ entry_index ] == NULL )
+	{
+		if( entry->data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entry: %d data size value exceeds maximum allocation size.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		rva_reader->entries_data[ entry_index ] = (uint8_t *) memory_allocate(
+		                                                       sizeof( uint8_t ) * entry->data_size );
+
+		if( rva_reader->entries_data[ entry_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry: %d data.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading section: %d data at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+			 function,
+			 entry->section_index,
+			 entry->data_offset,
+			 entry->data_offset );
+		}
+#endif
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              rva_reader->file_io_handle,
+		              rva_reader->entries_data[ entry_index ],
+		              (size_t) entry->data_size,
+		              (off64_t) entry->data_offset,
+		              error );
+
+		if( read_count != (ssize_t) entry->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read section: %d data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 entry->section_index,
+			 entry->data_offset,
+			 entry->data_offset );
+
+			memory_free(
+			 rva_reader->entries_data[ entry_index ] );
+
+			rva_reader->entries_data[ entry_index ] = NULL;
+
+			return( -1 );
+		}
+		rva_reader->number_of_reads += 1;
+	}
+	*data      = &( rva_reader->entries_data[ entry_index ][ relative_offset ] );
+	*data_size = (size_t) ( entry->data_size - relative_offset );
+
+	return( 1 );
+}
+
+/* Retrieves the string at a specific relative virtual address (RVA)
+ * The string must be terminated by an end of string character, which is not
+ * included in the string length
+ * Returns 1 if successful, 0 if the string is not stored in the file or -1 on error
+ */
+int libexe_rva_reader_get_string(
+     libexe_rva_reader_t *rva_reader,
+     uint32_t relative_virtual_address,
+     const uint8_t **string,
+     size_t *string_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	const uint8_t *end    = NULL;
+	static char *function = "libexe_rva_reader_get_string";
+	size_t data_size      = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string length.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_rva_reader_get_data(
+	          rva_reader,
+	          relative_virtual_address,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data for RVA: 0x%08" PRIx32 ".",
+		 function,
+		 relative_virtual_address );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	end = (const uint8_t *) narrow_string_search_character(
+	                         data,
+	                         0,
+	                         data_size );
+
+	if( end == NULL )
+	{
+		return( 0 );
+	}
+	*string        = data;
+	*string_length = (size_t) ( end - data );
+
+	return( 1 );
+}
+
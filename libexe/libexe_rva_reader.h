@@ -0,0 +1,91 @@
+/*
+ * Relative virtual address (RVA) reader functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_RVA_READER_H )
+#define _LIBEXE_RVA_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_rva_index.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_rva_reader libexe_rva_reader_t;
+
+struct libexe_rva_reader
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The relative virtual address (RVA) index
+	 */
+	libexe_rva_index_t *rva_index;
+
+	/* The data of the RVA index entries
+	 * The data of an entry is NULL until it is first read
+	 */
+	uint8_t **entries_data;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of reads
+	 */
+	int number_of_reads;
+};
+
+int libexe_rva_reader_initialize(
+     libexe_rva_reader_t **rva_reader,
+     libbfio_handle_t *file_io_handle,
+     libexe_rva_index_t *rva_index,
+     libcerror_error_t **error );
+
+int libexe_rva_reader_free(
+     libexe_rva_reader_t **rva_reader,
+     libcerror_error_t **error );
+
+int libexe_rva_reader_get_data(
+     libexe_rva_reader_t *rva_reader,
+     uint32_t relative_virtual_address,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libexe_rva_reader_get_string(
+     libexe_rva_reader_t *rva_reader,
+     uint32_t relative_virtual_address,
+     const uint8_t **string,
+     size_t *string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_RVA_READER_H ) */
+
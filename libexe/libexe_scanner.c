@@ -0,0 +1,1459 @@
+/*
+ * Scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libexe_batch_entry.h"
+#include "libexe_definitions.h"
+#include "libexe_file.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcnotify.h"
+#include "libexe_libcthreads.h"
+#include "libexe_scanner.h"
+#include "libexe_scanner_worker.h"
+
+/* Creates a scanner
+ * Make sure the value scanner is referencing, is set to NULL
+ * The files of the scanner are scanned with at most number_of_threads threads
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_initialize(
+     libexe_scanner_t **scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_scanner_initialize";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEXE_MAXIMUM_SCANNER_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = memory_allocate_structure(
+	                    libexe_internal_scanner_t );
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner,
+	     0,
+	     sizeof( libexe_internal_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanner.",
+		 function );
+
+		memory_free(
+		 internal_scanner );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_scanner->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_scanner->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_scanner->abort_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize abort mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_scanner->number_of_threads = number_of_threads;
+
+	*scanner = (libexe_scanner_t *) internal_scanner;
+
+	return( 1 );
+
+on_error:
+	if( internal_scanner != NULL )
+	{
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( internal_scanner->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_scanner->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_scanner->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_scanner->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_scanner );
+	}
+	return( -1 );
+}
+
+/* Frees a scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_free(
+     libexe_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_scanner_free";
+	int result                                  = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		internal_scanner = (libexe_internal_scanner_t *) *scanner;
+		*scanner         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_scanner->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libexe_batch_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_scanner->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_scanner->abort_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free abort mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_scanner );
+	}
+	return( result );
+}
+
+/* Appends a filename to the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_append_filename(
+     libexe_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry           = NULL;
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_scanner_append_filename";
+	size_t filename_length                      = 0;
+	int entry_index                             = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libexe_internal_scanner_t *) scanner;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libexe_batch_entry_initialize(
+	     &batch_entry,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libexe_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_append_entry(
+	     internal_scanner->entries_array,
+	     &entry_index,
+	     (intptr_t *) batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry to array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_scanner->read_write_lock,
+	 NULL );
+#endif
+	if( batch_entry != NULL )
+	{
+		libexe_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_get_number_of_entries(
+     libexe_scanner_t *scanner,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_scanner_get_number_of_entries";
+	int result                                  = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libexe_internal_scanner_t *) scanner;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_scanner->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Scans the files of the scanner
+ * Every file is opened and passed to the callback function after which it is
+ * closed again. The file argument of the callback function is NULL if the file
+ * could not be opened. The callback function can be called concurrently from
+ * multiple threads and must return 1 to continue or -1 to abort the scan
+ *
+ * The entries are divided into contiguous ranges, one per worker thread. A worker
+ * that runs out of entries steals the back half of the remaining entries of the
+ * most loaded worker, hence a couple of large files do not stall the scan.
+ * Every worker reuses a single file, hence at most one file is open per thread
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_scan(
+     libexe_scanner_t *scanner,
+     int access_flags,
+     int (*callback_function)(
+            const char *filename,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_scanner_scan";
+	size_t workers_size                         = 0;
+	int end_entry_index                         = 0;
+	int first_entry_index                       = 0;
+	int number_of_entries                       = 0;
+	int number_of_workers                       = 0;
+	int result                                  = 1;
+	int worker_index                            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libexe_internal_scanner_t *) scanner;
+
+	if( ( ( access_flags & LIBEXE_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEXE_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_scanner->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		internal_scanner->access_flags      = access_flags;
+		internal_scanner->callback_function = callback_function;
+		internal_scanner->callback_data     = callback_data;
+		internal_scanner->abort             = 0;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		number_of_workers = internal_scanner->number_of_threads;
+
+		if( number_of_workers > number_of_entries )
+		{
+			number_of_workers = number_of_entries;
+		}
+#else
+		number_of_workers = 1;
+#endif
+		workers_size = sizeof( libexe_scanner_worker_t * ) * number_of_workers;
+
+		internal_scanner->workers = (libexe_scanner_worker_t **) memory_allocate(
+		                                                          workers_size );
+
+		if( internal_scanner->workers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create workers.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_scanner->workers,
+		     0,
+		     workers_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear workers.",
+			 function );
+
+			goto on_error;
+		}
+		internal_scanner->number_of_workers = number_of_workers;
+
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( libexe_scanner_worker_initialize(
+			     &( internal_scanner->workers[ worker_index ] ),
+			     worker_index,
+			     (intptr_t *) internal_scanner,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			first_entry_index = (int) ( ( (int64_t) number_of_entries * worker_index ) / number_of_workers );
+			end_entry_index   = (int) ( ( (int64_t) number_of_entries * ( worker_index + 1 ) ) / number_of_workers );
+
+			if( libexe_scanner_worker_set_entries(
+			     internal_scanner->workers[ worker_index ],
+			     first_entry_index,
+			     end_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entries of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( number_of_workers > 1 )
+		{
+			for( worker_index = 0;
+			     worker_index < number_of_workers;
+			     worker_index++ )
+			{
+				if( libcthreads_thread_create(
+				     &( internal_scanner->workers[ worker_index ]->thread ),
+				     NULL,
+				     (int (*)(void *)) &libexe_internal_scanner_run_worker,
+				     (void *) internal_scanner->workers[ worker_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create thread of worker: %d.",
+					 function,
+					 worker_index );
+
+					libexe_internal_scanner_abort_workers(
+					 internal_scanner,
+					 NULL );
+
+					result = -1;
+
+					break;
+				}
+			}
+			for( worker_index = 0;
+			     worker_index < number_of_workers;
+			     worker_index++ )
+			{
+				if( internal_scanner->workers[ worker_index ]->thread == NULL )
+				{
+					continue;
+				}
+				if( libcthreads_thread_join(
+				     &( internal_scanner->workers[ worker_index ]->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+#endif
+		{
+			libexe_internal_scanner_run_worker(
+			 internal_scanner->workers[ 0 ] );
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: worker: %d scanned: %d entries of which %d were stolen.\n",
+				 function,
+				 worker_index,
+				 internal_scanner->workers[ worker_index ]->number_of_scanned_entries,
+				 internal_scanner->workers[ worker_index ]->number_of_stolen_entries );
+			}
+#endif
+			if( internal_scanner->workers[ worker_index ]->result != 1 )
+			{
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( libexe_internal_scanner_free_workers(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_scanner->workers != NULL )
+	{
+		libexe_internal_scanner_free_workers(
+		 internal_scanner,
+		 NULL );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_scanner->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Frees the workers of a scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_scanner_free_workers(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_scanner_free_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < internal_scanner->number_of_workers;
+		     worker_index++ )
+		{
+			if( libexe_scanner_worker_free(
+			     &( internal_scanner->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_scanner->workers );
+
+		internal_scanner->workers = NULL;
+	}
+	internal_scanner->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Aborts the scan and removes the queued entries of all the workers, which makes
+ * the workers stop after they finished scanning their current entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_scanner_abort_workers(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_scanner_abort_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	/* The abort value is set before the queued entries are removed, hence
+	 * a worker that is stealing entries either sees the abort value or has
+	 * its stolen entries removed
+	 */
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_scanner->abort = 1;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( worker_index = 0;
+	     worker_index < internal_scanner->number_of_workers;
+	     worker_index++ )
+	{
+		if( libexe_scanner_worker_set_entries(
+		     internal_scanner->workers[ worker_index ],
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set entries of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Determines if the scan was aborted
+ * Returns 1 if aborted, 0 if not or -1 on error
+ */
+int libexe_internal_scanner_is_aborted(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_scanner_is_aborted";
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_scanner->abort != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Steals entries from the worker with the most queued entries
+ * The stolen entries are discarded if the scan was aborted
+ * Only the mutex of a single worker is held at a time, besides the abort mutex
+ * Returns 1 if successful, 0 if no entries are left to steal or -1 on error
+ */
+int libexe_internal_scanner_steal_entries(
+     libexe_internal_scanner_t *internal_scanner,
+     libexe_scanner_worker_t *scanner_worker,
+     libcerror_error_t **error )
+{
+	libexe_scanner_worker_t *victim_worker = NULL;
+	static char *function                  = "libexe_internal_scanner_steal_entries";
+	int end_entry_index                    = 0;
+	int first_entry_index                  = 0;
+	int maximum_number_of_queued_entries   = 0;
+	int number_of_queued_entries           = 0;
+	int result                             = 0;
+	int victim_worker_index                = 0;
+	int worker_index                       = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	/* Another worker can drain the victim between determining the number of
+	 * queued entries and stealing them, in which case the search is repeated
+	 */
+	while( result == 0 )
+	{
+		victim_worker                    = NULL;
+		maximum_number_of_queued_entries = 0;
+
+		for( worker_index = 0;
+		     worker_index < internal_scanner->number_of_workers;
+		     worker_index++ )
+		{
+			if( worker_index == scanner_worker->worker_index )
+			{
+				continue;
+			}
+			if( libexe_scanner_worker_get_number_of_queued_entries(
+			     internal_scanner->workers[ worker_index ],
+			     &number_of_queued_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of queued entries of worker: %d.",
+				 function,
+				 worker_index );
+
+				return( -1 );
+			}
+			if( number_of_queued_entries > maximum_number_of_queued_entries )
+			{
+				victim_worker                    = internal_scanner->workers[ worker_index ];
+				victim_worker_index              = worker_index;
+				maximum_number_of_queued_entries = number_of_queued_entries;
+			}
+		}
+		if( victim_worker == NULL )
+		{
+			return( 0 );
+		}
+		result = libexe_scanner_worker_steal_back(
+		          victim_worker,
+		          &first_entry_index,
+		          &end_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to steal entries from worker: %d.",
+			 function,
+			 victim_worker_index );
+
+			return( -1 );
+		}
+	}
+	/* The abort mutex is held while setting the stolen entries, otherwise
+	 * the scan can be aborted after checking the abort value and the worker
+	 * would continue scanning the stolen entries
+	 */
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_scanner->abort != 0 )
+	{
+		result = 0;
+	}
+	else if( libexe_scanner_worker_set_entries(
+	          scanner_worker,
+	          first_entry_index,
+	          end_entry_index,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entries of worker: %d.",
+		 function,
+		 scanner_worker->worker_index );
+
+		result = -1;
+	}
+	else
+	{
+		scanner_worker->number_of_stolen_entries += end_entry_index - first_entry_index;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_scanner->abort_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release abort mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Scans a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_scanner_scan_entry(
+     libexe_internal_scanner_t *internal_scanner,
+     libexe_scanner_worker_t *scanner_worker,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libexe_batch_entry_t *batch_entry = NULL;
+	libcerror_error_t *open_error     = NULL;
+	libexe_file_t *file               = NULL;
+	static char *function             = "libexe_internal_scanner_scan_entry";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_scanner->entries_array,
+	     entry_index,
+	     (intptr_t **) &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libbfio_file_set_name(
+	     scanner_worker->file_io_handle,
+	     batch_entry->filename,
+	     batch_entry->filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename of entry: %d in file IO handle.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	/* The file and file IO handle of the worker are reused for every entry,
+	 * a file that cannot be opened does not fail the scan
+	 */
+	if( libexe_file_reopen_file_io_handle(
+	     scanner_worker->file,
+	     scanner_worker->file_io_handle,
+	     internal_scanner->access_flags,
+	     &open_error ) == 1 )
+	{
+		file = scanner_worker->file;
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		libcerror_error_free(
+		 &open_error );
+	}
+	scanner_worker->number_of_scanned_entries += 1;
+
+	if( internal_scanner->callback_function(
+	     batch_entry->filename,
+	     file,
+	     internal_scanner->callback_data ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for entry: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	if( file != NULL )
+	{
+		if( libexe_file_reset(
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to reset file of entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libexe_file_reset(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the entries queued on a worker and steals entries from other workers
+ * when its queue runs empty
+ * Callback function for the worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_scanner_run_worker(
+     libexe_scanner_worker_t *scanner_worker )
+{
+	libcerror_error_t *error                    = NULL;
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libexe_internal_scanner_run_worker";
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner = (libexe_internal_scanner_t *) scanner_worker->scanner;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner worker - missing scanner.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libexe_internal_scanner_is_aborted(
+		          internal_scanner,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if scan was aborted.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		result = libexe_scanner_worker_pop_front(
+		          scanner_worker,
+		          &entry_index,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from worker: %d.",
+			 function,
+			 scanner_worker->worker_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = libexe_internal_scanner_steal_entries(
+			          internal_scanner,
+			          scanner_worker,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to steal entries for worker: %d.",
+				 function,
+				 scanner_worker->worker_index );
+
+				goto on_error;
+			}
+		}
+		else if( libexe_internal_scanner_scan_entry(
+		          internal_scanner,
+		          scanner_worker,
+		          entry_index,
+		          &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	scanner_worker->result = 1;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	if( scanner_worker != NULL )
+	{
+		scanner_worker->result = -1;
+
+		/* Stop the other workers
+		 */
+		if( internal_scanner != NULL )
+		{
+			libexe_internal_scanner_abort_workers(
+			 internal_scanner,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
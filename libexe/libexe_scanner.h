@@ -0,0 +1,154 @@
+/*
+ * Scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_INTERNAL_SCANNER_H )
+#define _LIBEXE_INTERNAL_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_scanner_worker.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_internal_scanner libexe_internal_scanner_t;
+
+struct libexe_internal_scanner
+{
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The number of threads used to scan the files
+	 */
+	int number_of_threads;
+
+	/* The access flags used to open the files
+	 */
+	int access_flags;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       const char *filename,
+	       libexe_file_t *file,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The workers
+	 */
+	libexe_scanner_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* Value to indicate the scan was aborted
+	 */
+	int abort;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The abort mutex
+	 */
+	libcthreads_mutex_t *abort_mutex;
+#endif
+};
+
+LIBEXE_EXTERN \
+int libexe_scanner_initialize(
+     libexe_scanner_t **scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_scanner_free(
+     libexe_scanner_t **scanner,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_scanner_append_filename(
+     libexe_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_scanner_get_number_of_entries(
+     libexe_scanner_t *scanner,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBEXE_EXTERN \
+int libexe_scanner_scan(
+     libexe_scanner_t *scanner,
+     int access_flags,
+     int (*callback_function)(
+            const char *filename,
+            libexe_file_t *file,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_free_workers(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_abort_workers(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_is_aborted(
+     libexe_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_steal_entries(
+     libexe_internal_scanner_t *internal_scanner,
+     libexe_scanner_worker_t *scanner_worker,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_scan_entry(
+     libexe_internal_scanner_t *internal_scanner,
+     libexe_scanner_worker_t *scanner_worker,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libexe_internal_scanner_run_worker(
+     libexe_scanner_worker_t *scanner_worker );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_INTERNAL_SCANNER_H ) */
+
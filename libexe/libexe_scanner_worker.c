@@ -0,0 +1,579 @@
+/*
+ * Scanner worker functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_file.h"
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_scanner_worker.h"
+
+/* Creates a scanner worker
+ * Make sure the value scanner_worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_worker_initialize(
+     libexe_scanner_worker_t **scanner_worker,
+     int worker_index,
+     intptr_t *scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_scanner_worker_initialize";
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid worker index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*scanner_worker = memory_allocate_structure(
+	                   libexe_scanner_worker_t );
+
+	if( *scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scanner_worker,
+	     0,
+	     sizeof( libexe_scanner_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanner worker.",
+		 function );
+
+		memory_free(
+		 *scanner_worker );
+
+		*scanner_worker = NULL;
+
+		return( -1 );
+	}
+	if( libexe_file_initialize(
+	     &( ( *scanner_worker )->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file is reused for every file scanned by the worker, so its metadata
+	 * is allocated from an arena that is reset instead of freed between files
+	 * and the file IO handle is reused with another filename
+	 */
+	if( libexe_file_set_arena_size(
+	     ( *scanner_worker )->file,
+	     LIBEXE_DEFAULT_ARENA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set arena size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &( ( *scanner_worker )->file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scanner_worker )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *scanner_worker )->worker_index = worker_index;
+	( *scanner_worker )->scanner      = scanner;
+
+	return( 1 );
+
+on_error:
+	if( *scanner_worker != NULL )
+	{
+		if( ( *scanner_worker )->file != NULL )
+		{
+			libexe_file_free(
+			 &( ( *scanner_worker )->file ),
+			 NULL );
+		}
+		if( ( *scanner_worker )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *scanner_worker )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *scanner_worker );
+
+		*scanner_worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scanner worker
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_worker_free(
+     libexe_scanner_worker_t **scanner_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_scanner_worker_free";
+	int result            = 1;
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner_worker != NULL )
+	{
+		/* The scanner is referenced and freed elsewhere
+		 */
+		if( libexe_file_free(
+		     &( ( *scanner_worker )->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *scanner_worker )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *scanner_worker )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *scanner_worker );
+
+		*scanner_worker = NULL;
+	}
+	return( result );
+}
+
+/* Sets the entries queued on the scanner worker
+ * The entries are the range of entry indexes from first up to, but not including, end
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_worker_set_entries(
+     libexe_scanner_worker_t *scanner_worker,
+     int first_entry_index,
+     int end_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_scanner_worker_set_entries";
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index < 0 )
+	 || ( end_entry_index < first_entry_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	scanner_worker->first_entry_index = first_entry_index;
+	scanner_worker->end_entry_index   = end_entry_index;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of entries queued on the scanner worker
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_scanner_worker_get_number_of_queued_entries(
+     libexe_scanner_worker_t *scanner_worker,
+     int *number_of_queued_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_scanner_worker_get_number_of_queued_entries";
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_queued_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of queued entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_queued_entries = scanner_worker->end_entry_index - scanner_worker->first_entry_index;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes the first entry queued on the scanner worker
+ * The owning worker takes entries from the front of its queue
+ * Returns 1 if successful, 0 if no entries are queued or -1 on error
+ */
+int libexe_scanner_worker_pop_front(
+     libexe_scanner_worker_t *scanner_worker,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_scanner_worker_pop_front";
+	int result            = 0;
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( scanner_worker->first_entry_index < scanner_worker->end_entry_index )
+	{
+		*entry_index = scanner_worker->first_entry_index;
+
+		scanner_worker->first_entry_index += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes the back half of the entries queued on the scanner worker
+ * Other workers steal entries from the back of the queue so that they
+ * do not contend with the owning worker for the same entries
+ * Returns 1 if successful, 0 if no entries are queued or -1 on error
+ */
+int libexe_scanner_worker_steal_back(
+     libexe_scanner_worker_t *scanner_worker,
+     int *first_entry_index,
+     int *end_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function        = "libexe_scanner_worker_steal_back";
+	int number_of_queued_entries = 0;
+	int number_of_stolen_entries = 0;
+	int result                   = 0;
+
+	if( scanner_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end entry index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	number_of_queued_entries = scanner_worker->end_entry_index - scanner_worker->first_entry_index;
+
+	if( number_of_queued_entries > 0 )
+	{
+		number_of_stolen_entries = ( number_of_queued_entries + 1 ) / 2;
+
+		*end_entry_index   = scanner_worker->end_entry_index;
+		*first_entry_index = *end_entry_index - number_of_stolen_entries;
+
+		scanner_worker->end_entry_index = *first_entry_index;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scanner_worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,125 @@
+/*
+ * Scanner worker functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_SCANNER_WORKER_H )
+#define _LIBEXE_SCANNER_WORKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libbfio.h"
+#include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_scanner_worker libexe_scanner_worker_t;
+
+struct libexe_scanner_worker
+{
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The file, which is reused for every file scanned by the worker
+	 */
+	libexe_file_t *file;
+
+	/* The file IO handle, which is reused for every file scanned by the worker
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The first entry index of the entries queued on the worker
+	 */
+	int first_entry_index;
+
+	/* The end entry index of the entries queued on the worker
+	 */
+	int end_entry_index;
+
+	/* The number of entries scanned by the worker
+	 */
+	int number_of_scanned_entries;
+
+	/* The number of entries stolen by the worker from other workers
+	 */
+	int number_of_stolen_entries;
+
+	/* The result of the worker, which is -1 if the worker failed
+	 */
+	int result;
+
+	/* The scanner
+	 */
+	intptr_t *scanner;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex that protects the queued entries
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libexe_scanner_worker_initialize(
+     libexe_scanner_worker_t **scanner_worker,
+     int worker_index,
+     intptr_t *scanner,
+     libcerror_error_t **error );
+
+int libexe_scanner_worker_free(
+     libexe_scanner_worker_t **scanner_worker,
+     libcerror_error_t **error );
+
+int libexe_scanner_worker_set_entries(
+     libexe_scanner_worker_t *scanner_worker,
+     int first_entry_index,
+     int end_entry_index,
+     libcerror_error_t **error );
+
+int libexe_scanner_worker_get_number_of_queued_entries(
+     libexe_scanner_worker_t *scanner_worker,
+     int *number_of_queued_entries,
+     libcerror_error_t **error );
+
+int libexe_scanner_worker_pop_front(
+     libexe_scanner_worker_t *scanner_worker,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libexe_scanner_worker_steal_back(
+     libexe_scanner_worker_t *scanner_worker,
+     int *first_entry_index,
+     int *end_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_SCANNER_WORKER_H ) */
+
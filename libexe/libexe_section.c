@@ -23,10 +23,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libexe_block_cache.h"
 #include "libexe_definitions.h"
 #include "libexe_io_handle.h"
 #include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
 #include "libexe_libfcache.h"
 #include "libexe_libfdata.h"
 #include "libexe_libuna.h"
@@ -42,6 +44,7 @@ int libexe_section_initialize(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libexe_section_descriptor_t *section_descriptor,
+     libexe_block_cache_t *block_cache,
      libcerror_error_t **error )
 {
 	libexe_internal_section_t *internal_section = NULL;
@@ -114,6 +117,7 @@ int libexe_section_initialize(
 	internal_section->file_io_handle     = file_io_handle;
 	internal_section->io_handle          = io_handle;
 	internal_section->section_descriptor = section_descriptor;
+	internal_section->block_cache        = block_cache;
 
 	*section = (libexe_section_t *) internal_section;
 
@@ -128,7 +132,52 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the values of a borrowed section
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_internal_section_set_borrowed(
+     libexe_internal_section_t *internal_section,
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libexe_section_descriptor_t *section_descriptor,
+     libexe_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_internal_section_set_borrowed";
+
+	if( internal_section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_section->file_io_handle     = file_io_handle;
+	internal_section->io_handle          = io_handle;
+	internal_section->section_descriptor = section_descriptor;
+	internal_section->block_cache        = block_cache;
+	internal_section->is_borrowed        = 1;
+
+	return( 1 );
+}
+
 /* Frees a section
+ * A borrowed section is not freed, only the reference to it is cleared
  * Returns 1 if successful or -1 on error
  */
 int libexe_section_free(
@@ -154,10 +203,13 @@ int libexe_section_free(
 		internal_section = (libexe_internal_section_t *) *section;
 		*section         = NULL;
 
-		/* The file_io_handle, io_handle and section_descriptor references are freed elsewhere
+		/* The file_io_handle, io_handle, section_descriptor and block_cache references are freed elsewhere
 		 */
-		memory_free(
-		 internal_section );
+		if( internal_section->is_borrowed == 0 )
+		{
+			memory_free(
+			 internal_section );
+		}
 	}
 	return( 1 );
 }
@@ -603,6 +655,21 @@ ssize_t libexe_section_read_buffer(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	read_count = libfdata_stream_read_buffer(
 	              internal_section->section_descriptor->data_stream,
 	              (intptr_t *) internal_section->file_io_handle,
@@ -619,13 +686,27 @@ ssize_t libexe_section_read_buffer(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read buffer from section data stream.",
 		 function );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
+#endif
 	return( read_count );
 }
 
 /* Reads data at a specific offset into a buffer
+ * This function does not change the current offset of the section
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libexe_section_read_buffer_at_offset(
@@ -635,38 +716,154 @@ ssize_t libexe_section_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libexe_section_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+	libexe_internal_section_t *internal_section = NULL;
+	static char *function                       = "libexe_section_read_buffer_at_offset";
+	size64_t read_size                          = 0;
+	ssize_t read_count                          = 0;
+	off64_t file_offset                         = 0;
 
-	if( libexe_section_seek_offset(
-	     section,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( section == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libexe_section_read_buffer(
-	              section,
-	              buffer,
-	              buffer_size,
-	              error );
+	internal_section = (libexe_internal_section_t *) section;
+
+	if( internal_section->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid section - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_section->section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid section - missing section descriptor.",
+		 function );
 
-	if( read_count < 0 )
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The section data is stored in a single segment, which is not changed
+	 * after the file has been opened, hence the data can be read directly
+	 * from the file, or the block cache, without using the section data stream
+	 */
+	if( (size64_t) offset >= internal_section->section_descriptor->data_size )
+	{
+		return( 0 );
+	}
+	read_size = internal_section->section_descriptor->data_size - (size64_t) offset;
+
+	if( read_size > (size64_t) buffer_size )
+	{
+		read_size = (size64_t) buffer_size;
+	}
+	file_offset = internal_section->section_descriptor->data_offset + offset;
+
+	if( internal_section->io_handle->file_data != NULL )
+	{
+		if( (size64_t) file_offset >= (size64_t) internal_section->io_handle->file_data_size )
+		{
+			return( 0 );
+		}
+		if( read_size > (size64_t) ( internal_section->io_handle->file_data_size - (size_t) file_offset ) )
+		{
+			read_size = (size64_t) ( internal_section->io_handle->file_data_size - (size_t) file_offset );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_section->io_handle->file_data[ file_offset ] ),
+		     (size_t) read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy section data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+	if( internal_section->block_cache != NULL )
+	{
+		read_count = libexe_block_cache_read_buffer(
+		              internal_section->block_cache,
+		              internal_section->file_io_handle,
+		              internal_section->section_descriptor->index,
+		              internal_section->section_descriptor->data_offset,
+		              internal_section->section_descriptor->data_size,
+		              offset,
+		              (uint8_t *) buffer,
+		              (size_t) read_size,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              internal_section->file_io_handle,
+		              (uint8_t *) buffer,
+		              (size_t) read_size,
+		              file_offset,
+		              error );
+	}
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from file IO handle.",
+		 function,
+		 file_offset,
+		 file_offset );
 
 		return( -1 );
 	}
@@ -709,6 +906,21 @@ off64_t libexe_section_seek_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	offset = libfdata_stream_seek_offset(
 	          internal_section->section_descriptor->data_stream,
 	          offset,
@@ -723,9 +935,22 @@ off64_t libexe_section_seek_offset(
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
 		 "%s: unable to seek in section data stream.",
 		 function );
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
+#endif
 	return( offset );
 }
 
@@ -739,6 +964,7 @@ int libexe_section_get_offset(
 {
 	libexe_internal_section_t *internal_section = NULL;
 	static char *function                       = "libexe_section_get_offset";
+	int result                                  = 1;
 
 	if( section == NULL )
 	{
@@ -764,6 +990,21 @@ int libexe_section_get_offset(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfdata_stream_get_offset(
 	     internal_section->section_descriptor->data_stream,
 	     offset,
@@ -776,9 +1017,24 @@ int libexe_section_get_offset(
 		 "%s: unable to retrieve section data stream offset.",
 		 function );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_section->section_descriptor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the size
@@ -932,6 +1188,129 @@ int libexe_section_get_virtual_address(
 	return( 1 );
 }
 
+/* Retrieves a pointer to the section data
+ * The section data is only available without copying when the file data is
+ * memory mapped or the file was opened from memory. The pointer is borrowed
+ * from the file and remains valid until the file is closed. If the section
+ * data extends beyond the end of the file data the size is truncated to
+ * the available data.
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libexe_section_get_data_pointer(
+     libexe_section_t *section,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libexe_internal_section_t *internal_section = NULL;
+	static char *function                       = "libexe_section_get_data_pointer";
+	size64_t section_data_size                  = 0;
+	off64_t section_data_offset                 = 0;
+
+	if( section == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section.",
+		 function );
+
+		return( -1 );
+	}
+	internal_section = (libexe_internal_section_t *) section;
+
+	if( internal_section->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid section - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_section->section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid section - missing section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_section->io_handle->file_data == NULL )
+	{
+		return( 0 );
+	}
+	if( libexe_section_descriptor_get_data_range(
+	     internal_section->section_descriptor,
+	     &section_data_offset,
+	     &section_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section data range.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Like libexe_section_read_buffer_at_offset the section data is truncated
+	 * at the end of the file data
+	 */
+	if( (size64_t) section_data_offset >= (size64_t) internal_section->io_handle->file_data_size )
+	{
+		return( 0 );
+	}
+	if( section_data_size > (size64_t) ( internal_section->io_handle->file_data_size - (size_t) section_data_offset ) )
+	{
+		section_data_size = (size64_t) ( internal_section->io_handle->file_data_size - (size_t) section_data_offset );
+	}
+	*data      = &( internal_section->io_handle->file_data[ section_data_offset ] );
+	*data_size = (size_t) section_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the section data file IO handle
  * Returns 1 if successful -1 on error
  */
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_block_cache.h"
 #include "libexe_extern.h"
 #include "libexe_io_handle.h"
 #include "libexe_libbfio.h"
@@ -51,6 +52,15 @@ struct libexe_internal_section
 	/* The section descriptor
 	 */
 	libexe_section_descriptor_t *section_descriptor;
+
+	/* The block cache
+	 */
+	libexe_block_cache_t *block_cache;
+
+	/* Value to indicate the section is borrowed from the file
+	 * A borrowed section is owned by the file and not freed by libexe_section_free
+	 */
+	uint8_t is_borrowed;
 };
 
 int libexe_section_initialize(
@@ -58,6 +68,15 @@ int libexe_section_initialize(
      libexe_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libexe_section_descriptor_t *section_descriptor,
+     libexe_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libexe_internal_section_set_borrowed(
+     libexe_internal_section_t *internal_section,
+     libexe_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libexe_section_descriptor_t *section_descriptor,
+     libexe_block_cache_t *block_cache,
      libcerror_error_t **error );
 
 LIBEXE_EXTERN \
@@ -150,6 +169,13 @@ int libexe_section_get_virtual_address(
      uint32_t *virtual_address,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_section_get_data_pointer(
+     libexe_section_t *section,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBEXE_EXTERN \
 int libexe_section_get_data_file_io_handle(
      libexe_section_t *section,
@@ -23,18 +23,24 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libexe_io_handle.h"
+#include "libexe_arena.h"
+#include "libexe_definitions.h"
+#include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
 #include "libexe_libfcache.h"
 #include "libexe_libfdata.h"
 #include "libexe_section_descriptor.h"
+#include "libexe_unused.h"
 
 /* Creates a section descriptor
  * Make sure the value section_descriptor is referencing, is set to NULL
+ * The section descriptor is allocated from the arena if one is provided
  * Returns 1 if successful or -1 on error
  */
 int libexe_section_descriptor_initialize(
      libexe_section_descriptor_t **section_descriptor,
+     libexe_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libexe_section_descriptor_initialize";
@@ -61,19 +67,40 @@ int libexe_section_descriptor_initialize(
 
 		return( -1 );
 	}
-	*section_descriptor = memory_allocate_structure(
-	                       libexe_section_descriptor_t );
+	if( arena != NULL )
+	{
+		if( libexe_arena_allocate(
+		     arena,
+		     sizeof( libexe_section_descriptor_t ),
+		     (void **) section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create section descriptor.",
+			 function );
 
-	if( *section_descriptor == NULL )
+			goto on_error;
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create section descriptor.",
-		 function );
+		*section_descriptor = memory_allocate_structure(
+		                       libexe_section_descriptor_t );
 
-		goto on_error;
+		if( *section_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create section descriptor.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     *section_descriptor,
@@ -87,22 +114,30 @@ int libexe_section_descriptor_initialize(
 		 "%s: unable to clear section descriptor.",
 		 function );
 
-		memory_free(
-		 *section_descriptor );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *section_descriptor );
+		}
 		*section_descriptor = NULL;
 
 		return( -1 );
 	}
+	( *section_descriptor )->maximum_readahead_size = LIBEXE_MAXIMUM_READAHEAD_SIZE;
+	( *section_descriptor )->arena                  = arena;
+
+	/* The section descriptor is passed as a data handle that is not managed
+	 * by the data stream, so that the segment offset is tracked per section
+	 */
 	if( libfdata_stream_initialize(
 	     &( ( *section_descriptor )->data_stream ),
+	     (intptr_t *) *section_descriptor,
 	     NULL,
 	     NULL,
 	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libexe_section_descriptor_read_segment_data,
 	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libexe_io_handle_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libexe_io_handle_seek_segment_offset,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libexe_section_descriptor_seek_segment_offset,
 	     0,
 	     error ) != 1 )
 	{
@@ -129,6 +164,21 @@ int libexe_section_descriptor_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *section_descriptor )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -140,9 +190,11 @@ on_error:
 			 &( ( *section_descriptor )->data_stream ),
 			 NULL );
 		}
-		memory_free(
-		 *section_descriptor );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *section_descriptor );
+		}
 		*section_descriptor = NULL;
 	}
 	return( -1 );
@@ -184,14 +236,72 @@ int libexe_section_descriptor_free(
 
 			result = -1;
 		}
-		memory_free(
-		 *section_descriptor );
+		if( ( *section_descriptor )->readahead_data != NULL )
+		{
+			memory_free(
+			 ( *section_descriptor )->readahead_data );
+		}
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *section_descriptor )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
 
+			result = -1;
+		}
+#endif
+		/* Memory allocated from an arena is released when the arena is reset
+		 */
+		if( ( *section_descriptor )->arena == NULL )
+		{
+			memory_free(
+			 *section_descriptor );
+		}
 		*section_descriptor = NULL;
 	}
 	return( result );
 }
 
+/* Frees the readahead data
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_descriptor_free_readahead_data(
+     libexe_section_descriptor_t *section_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_descriptor_free_readahead_data";
+
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_descriptor->readahead_data != NULL )
+	{
+		memory_free(
+		 section_descriptor->readahead_data );
+
+		section_descriptor->readahead_data = NULL;
+	}
+	section_descriptor->readahead_data_size = 0;
+	section_descriptor->readahead_offset    = 0;
+	section_descriptor->readahead_size      = 0;
+
+	return( 1 );
+}
+
 /* Retrieves the data size
  * Returns 1 if successful or -1 on error
  */
@@ -315,6 +425,329 @@ int libexe_section_descriptor_set_data_range(
 
 		return( -1 );
 	}
+	section_descriptor->data_offset      = data_offset;
+	section_descriptor->data_size        = data_size;
+	section_descriptor->next_read_offset = data_offset;
+
 	return( 1 );
 }
 
+/* Reads the segment data into the buffer
+ * Callback function for the section data stream
+ *
+ * The data is read at the segment offset stored in the section descriptor
+ * so that the read does not depend on the current offset of the file IO handle,
+ * which is shared with the other sections
+ *
+ * Sequential reads are served from a readahead buffer. The readahead window
+ * doubles on every sequential refill, up to the maximum readahead size of
+ * the section. The readahead buffer is freed when the section data is read
+ * at a non-sequential offset or when all the section data has been read.
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libexe_section_descriptor_read_segment_data(
+         libexe_section_descriptor_t *section_descriptor,
+         libbfio_handle_t *file_io_handle,
+         int segment_index LIBEXE_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBEXE_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBEXE_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBEXE_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function      = "libexe_section_descriptor_read_segment_data";
+	size64_t remaining_size    = 0;
+	size_t readahead_data_size = 0;
+	size_t read_size           = 0;
+	size_t segment_data_offset = 0;
+	ssize_t read_count         = 0;
+	off64_t segment_offset     = 0;
+	off64_t section_end_offset = 0;
+
+	LIBEXE_UNREFERENCED_PARAMETER( segment_index )
+	LIBEXE_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBEXE_UNREFERENCED_PARAMETER( segment_flags )
+	LIBEXE_UNREFERENCED_PARAMETER( read_flags )
+
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	segment_offset     = section_descriptor->segment_offset;
+	section_end_offset = section_descriptor->data_offset + (off64_t) section_descriptor->data_size;
+
+	while( segment_data_offset < segment_data_size )
+	{
+		read_size = segment_data_size - segment_data_offset;
+
+		if( ( segment_offset >= section_descriptor->readahead_offset )
+		 && ( segment_offset < ( section_descriptor->readahead_offset + (off64_t) section_descriptor->readahead_size ) ) )
+		{
+			readahead_data_size = (size_t) ( segment_offset - section_descriptor->readahead_offset );
+
+			if( read_size > ( section_descriptor->readahead_size - readahead_data_size ) )
+			{
+				read_size = section_descriptor->readahead_size - readahead_data_size;
+			}
+			if( memory_copy(
+			     &( segment_data[ segment_data_offset ] ),
+			     &( section_descriptor->readahead_data[ readahead_data_size ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			segment_data_offset += read_size;
+			segment_offset      += (off64_t) read_size;
+
+			continue;
+		}
+		if( ( segment_offset == section_descriptor->next_read_offset )
+		 || ( segment_offset == ( section_descriptor->readahead_offset + (off64_t) section_descriptor->readahead_size ) ) )
+		{
+			/* No readahead is done when the share of the section is less than the minimum readahead size
+			 */
+			if( section_descriptor->maximum_readahead_size < LIBEXE_MINIMUM_READAHEAD_SIZE )
+			{
+				section_descriptor->readahead_window_size = 0;
+			}
+			else if( section_descriptor->readahead_window_size == 0 )
+			{
+				section_descriptor->readahead_window_size = LIBEXE_MINIMUM_READAHEAD_SIZE;
+			}
+			else if( section_descriptor->readahead_window_size < section_descriptor->maximum_readahead_size )
+			{
+				section_descriptor->readahead_window_size *= 2;
+			}
+		}
+		else
+		{
+			/* The readahead data is not kept around when the section data is not read sequentially
+			 */
+			if( libexe_section_descriptor_free_readahead_data(
+			     section_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			section_descriptor->readahead_window_size = 0;
+		}
+		if( section_descriptor->readahead_window_size > section_descriptor->maximum_readahead_size )
+		{
+			section_descriptor->readahead_window_size = section_descriptor->maximum_readahead_size;
+		}
+		readahead_data_size = section_descriptor->readahead_window_size;
+
+		if( segment_offset < section_end_offset )
+		{
+			remaining_size = (size64_t) ( section_end_offset - segment_offset );
+
+			if( (size64_t) readahead_data_size > remaining_size )
+			{
+				readahead_data_size = (size_t) remaining_size;
+			}
+		}
+		/* Reads that are larger than the readahead window are read directly
+		 */
+		if( readahead_data_size <= read_size )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( segment_data[ segment_data_offset ] ),
+			              read_size,
+			              segment_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 segment_offset,
+				 segment_offset );
+
+				return( -1 );
+			}
+			segment_data_offset += read_size;
+			segment_offset      += (off64_t) read_size;
+
+			break;
+		}
+		if( readahead_data_size > section_descriptor->readahead_data_size )
+		{
+			if( libexe_section_descriptor_free_readahead_data(
+			     section_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			section_descriptor->readahead_data = (uint8_t *) memory_allocate(
+			                                                  sizeof( uint8_t ) * section_descriptor->readahead_window_size );
+
+			if( section_descriptor->readahead_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create readahead data.",
+				 function );
+
+				return( -1 );
+			}
+			section_descriptor->readahead_data_size = section_descriptor->readahead_window_size;
+		}
+		section_descriptor->readahead_offset = segment_offset;
+		section_descriptor->readahead_size   = 0;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              section_descriptor->readahead_data,
+		              readahead_data_size,
+		              segment_offset,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read readahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segment_offset,
+			 segment_offset );
+
+			return( -1 );
+		}
+		section_descriptor->readahead_size = (size_t) read_count;
+	}
+	/* The readahead data is freed once all the section data has been read
+	 */
+	if( ( section_descriptor->readahead_data != NULL )
+	 && ( segment_offset >= section_end_offset )
+	 && ( segment_offset >= ( section_descriptor->readahead_offset + (off64_t) section_descriptor->readahead_size ) ) )
+	{
+		if( libexe_section_descriptor_free_readahead_data(
+		     section_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free readahead data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	section_descriptor->segment_offset   = segment_offset;
+	section_descriptor->next_read_offset = segment_offset;
+
+	return( (ssize_t) segment_data_size );
+}
+
+/* Seeks a certain segment offset
+ * Callback function for the section data stream
+ *
+ * The segment offset is only stored in the section descriptor,
+ * the file IO handle is positioned when the segment data is read
+ *
+ * Returns the offset or -1 on error
+ */
+off64_t libexe_section_descriptor_seek_segment_offset(
+         libexe_section_descriptor_t *section_descriptor,
+         libbfio_handle_t *file_io_handle LIBEXE_ATTRIBUTE_UNUSED,
+         int segment_index LIBEXE_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBEXE_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libexe_section_descriptor_seek_segment_offset";
+
+	LIBEXE_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBEXE_UNREFERENCED_PARAMETER( segment_index )
+	LIBEXE_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid segment offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	section_descriptor->segment_offset = segment_offset;
+
+	return( segment_offset );
+}
+
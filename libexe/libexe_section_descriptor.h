@@ -25,7 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libexe_arena.h"
+#include "libexe_libbfio.h"
 #include "libexe_libcerror.h"
+#include "libexe_libcthreads.h"
 #include "libexe_libfcache.h"
 #include "libexe_libfdata.h"
 
@@ -37,6 +40,10 @@ typedef struct libexe_section_descriptor libexe_section_descriptor_t;
 
 struct libexe_section_descriptor
 {
+	/* The index of the section in the section table
+	 */
+	int index;
+
 	/* The name
 	 */
 	char name[ 9 ];
@@ -49,19 +56,79 @@ struct libexe_section_descriptor
 	 */
 	uint32_t virtual_address;
 
+	/* The virtual size
+	 */
+	uint32_t virtual_size;
+
+	/* The data offset
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
 	/* The data stream
 	 */
 	libfdata_stream_t *data_stream;
+
+	/* The current segment offset
+	 */
+	off64_t segment_offset;
+
+	/* The readahead data
+	 */
+	uint8_t *readahead_data;
+
+	/* The readahead data size
+	 */
+	size_t readahead_data_size;
+
+	/* The file offset of the data in the readahead data
+	 */
+	off64_t readahead_offset;
+
+	/* The number of bytes in the readahead data
+	 */
+	size_t readahead_size;
+
+	/* The readahead window size, which grows on sequential reads
+	 */
+	size_t readahead_window_size;
+
+	/* The maximum readahead window size
+	 */
+	size_t maximum_readahead_size;
+
+	/* The file offset at which the next sequential read starts
+	 */
+	off64_t next_read_offset;
+
+	/* The arena the section descriptor was allocated from, which is NULL
+	 * when it was allocated from the heap
+	 */
+	libexe_arena_t *arena;
+
+#if defined( HAVE_LIBEXE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libexe_section_descriptor_initialize(
      libexe_section_descriptor_t **section_descriptor,
+     libexe_arena_t *arena,
      libcerror_error_t **error );
 
 int libexe_section_descriptor_free(
      libexe_section_descriptor_t **section_descriptor,
      libcerror_error_t **error );
 
+int libexe_section_descriptor_free_readahead_data(
+     libexe_section_descriptor_t *section_descriptor,
+     libcerror_error_t **error );
+
 int libexe_section_descriptor_get_data_size(
      libexe_section_descriptor_t *section_descriptor,
      size64_t *data_size,
@@ -79,6 +146,25 @@ int libexe_section_descriptor_set_data_range(
      size64_t data_size,
      libcerror_error_t **error );
 
+ssize_t libexe_section_descriptor_read_segment_data(
+         libexe_section_descriptor_t *section_descriptor,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libexe_section_descriptor_seek_segment_offset(
+         libexe_section_descriptor_t *section_descriptor,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
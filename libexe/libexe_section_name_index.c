@@ -0,0 +1,742 @@
+/*
+ * Section name index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+#include "libexe_section_descriptor.h"
+#include "libexe_section_name_index.h"
+
+/* The multiplier of the Fibonacci hash of the name values
+ */
+#define LIBEXE_SECTION_NAME_INDEX_HASH_MULTIPLIER	(uint64_t) 0x9e3779b97f4a7c15ULL
+
+/* Creates a section name index
+ * Make sure the value section_name_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_name_index_initialize(
+     libexe_section_name_index_t **section_name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_name_index_initialize";
+
+	if( section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section_name_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section name index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*section_name_index = memory_allocate_structure(
+	              libexe_section_name_index_t );
+
+	if( *section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create section name index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *section_name_index,
+	     0,
+	     sizeof( libexe_section_name_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear section name index.",
+		 function );
+
+		memory_free(
+		 *section_name_index );
+
+		*section_name_index = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *section_name_index != NULL )
+	{
+		memory_free(
+		 *section_name_index );
+
+		*section_name_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a section name index
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_name_index_free(
+     libexe_section_name_index_t **section_name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_name_index_free";
+
+	if( section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *section_name_index != NULL )
+	{
+		if( ( *section_name_index )->section_indexes != NULL )
+		{
+			memory_free(
+			 ( *section_name_index )->section_indexes );
+		}
+		if( ( *section_name_index )->slots != NULL )
+		{
+			memory_free(
+			 ( *section_name_index )->slots );
+		}
+		memory_free(
+		 *section_name_index );
+
+		*section_name_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a section name index
+ * The allocated slots and section indexes are retained so that the section
+ * name index can be reused without reallocating when the sections are set again
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_name_index_clear(
+     libexe_section_name_index_t *section_name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_name_index_clear";
+
+	if( section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section name index.",
+		 function );
+
+		return( -1 );
+	}
+	section_name_index->number_of_slots     = 0;
+	section_name_index->number_of_hash_bits = 0;
+	section_name_index->number_of_sections  = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the name value of a section name
+ * The name value contains the name packed into a 64-bit value
+ * Returns 1 if successful, 0 if the name cannot be a section name or -1 on error
+ */
+int libexe_section_name_index_get_name_value(
+     const char *name,
+     size_t name_length,
+     uint64_t *name_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_name_index_get_name_value";
+	uint64_t safe_value   = 0;
+	size_t name_index     = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name value.",
+		 function );
+
+		return( -1 );
+	}
+	/* A section name consists of 1 to 8 characters without an end-of-string character
+	 */
+	if( ( name_length == 0 )
+	 || ( name_length > 8 ) )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( name[ name_index ] == 0 )
+		{
+			return( 0 );
+		}
+		safe_value |= (uint64_t) ( (uint8_t) name[ name_index ] ) << ( name_index * 8 );
+	}
+	*name_value = safe_value;
+
+	return( 1 );
+}
+
+/* Retrieves the name value of a specific section
+ * Returns 1 if successful, 0 if the section is not indexed or -1 on error
+ */
+int libexe_section_name_index_get_section_name_value(
+     libcdata_array_t *sections_array,
+     int section_index,
+     uint64_t *name_value,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	static char *function                           = "libexe_section_name_index_get_section_name_value";
+	int result                                      = 0;
+
+	if( libcdata_array_get_entry_by_index(
+	     sections_array,
+	     section_index,
+	     (intptr_t **) &section_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( section_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing section descriptor: %d.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	if( section_descriptor->name_size <= 1 )
+	{
+		return( 0 );
+	}
+	result = libexe_section_name_index_get_name_value(
+	          section_descriptor->name,
+	          section_descriptor->name_size - 1,
+	          name_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section descriptor: %d name value.",
+		 function,
+		 section_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the sections of the section name index
+ * Sections without a name are not indexed
+ *
+ * The section indexes of the sections with the same name are stored as a contiguous
+ * run in section table order, so that the n-th section with a name is retrieved
+ * without walking the preceding ones
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_name_index_set_sections(
+     libexe_section_name_index_t *section_name_index,
+     libcdata_array_t *sections_array,
+     libcerror_error_t **error )
+{
+	libexe_section_name_index_slot_t *slots = NULL;
+	static char *function                   = "libexe_section_name_index_set_sections";
+	uint64_t name_value                     = 0;
+	int *section_indexes                    = NULL;
+	int number_of_hash_bits                 = 0;
+	int number_of_indexed_sections          = 0;
+	int number_of_sections                  = 0;
+	int number_of_slots                     = 0;
+	int result                              = 0;
+	int section_index                       = 0;
+	int slot_index                          = 0;
+
+	if( section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_name_index->number_of_slots != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid section name index - slots value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sections_array,
+	     &number_of_sections,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sections == 0 )
+	{
+		return( 1 );
+	}
+	/* The number of sections is stored in 16 bits
+	 */
+	if( ( number_of_sections < 0 )
+	 || ( number_of_sections > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sections value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least twice as many slots as sections to keep the probe sequences short
+	 */
+	number_of_hash_bits = 3;
+	number_of_slots     = 8;
+
+	while( number_of_slots < ( number_of_sections * 2 ) )
+	{
+		number_of_hash_bits += 1;
+		number_of_slots     *= 2;
+	}
+	/* The slots and section indexes of a previous use of the section
+	 * name index are reused when there are enough
+	 */
+	if( number_of_slots > section_name_index->number_of_allocated_slots )
+	{
+		slots = (libexe_section_name_index_slot_t *) memory_reallocate(
+		                                              section_name_index->slots,
+		                                              sizeof( libexe_section_name_index_slot_t ) * number_of_slots );
+
+		if( slots == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+		section_name_index->slots                     = slots;
+		section_name_index->number_of_allocated_slots = number_of_slots;
+	}
+	if( number_of_sections > section_name_index->number_of_allocated_section_indexes )
+	{
+		section_indexes = (int *) memory_reallocate(
+		                           section_name_index->section_indexes,
+		                           sizeof( int ) * number_of_sections );
+
+		if( section_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize section indexes.",
+			 function );
+
+			return( -1 );
+		}
+		section_name_index->section_indexes                     = section_indexes;
+		section_name_index->number_of_allocated_section_indexes = number_of_sections;
+	}
+	slots           = section_name_index->slots;
+	section_indexes = section_name_index->section_indexes;
+
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		slots[ slot_index ].name_value             = 0;
+		slots[ slot_index ].section_indexes_offset = 0;
+		slots[ slot_index ].number_of_sections     = 0;
+	}
+	/* The first pass counts the number of sections per name
+	 */
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		result = libexe_section_name_index_get_section_name_value(
+		          sections_array,
+		          section_index,
+		          &name_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d name value.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		/* Linear probing for the slot of the name
+		 */
+		slot_index = (int) ( ( name_value * LIBEXE_SECTION_NAME_INDEX_HASH_MULTIPLIER ) >> ( 64 - number_of_hash_bits ) );
+
+		while( ( slots[ slot_index ].number_of_sections != 0 )
+		    && ( slots[ slot_index ].name_value != name_value ) )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ].name_value          = name_value;
+		slots[ slot_index ].number_of_sections += 1;
+	}
+	/* The section indexes offset of a slot is set to the end of its run,
+	 * the second pass fills the run backwards
+	 */
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		number_of_indexed_sections += slots[ slot_index ].number_of_sections;
+
+		slots[ slot_index ].section_indexes_offset = number_of_indexed_sections;
+	}
+	/* The second pass stores the section indexes in reverse section table order,
+	 * hence every run ends up in section table order
+	 */
+	for( section_index = number_of_sections - 1;
+	     section_index >= 0;
+	     section_index-- )
+	{
+		result = libexe_section_name_index_get_section_name_value(
+		          sections_array,
+		          section_index,
+		          &name_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section: %d name value.",
+			 function,
+			 section_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		slot_index = (int) ( ( name_value * LIBEXE_SECTION_NAME_INDEX_HASH_MULTIPLIER ) >> ( 64 - number_of_hash_bits ) );
+
+		while( slots[ slot_index ].name_value != name_value )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ].section_indexes_offset -= 1;
+
+		section_indexes[ slots[ slot_index ].section_indexes_offset ] = section_index;
+	}
+	section_name_index->number_of_slots     = number_of_slots;
+	section_name_index->number_of_hash_bits = number_of_hash_bits;
+	section_name_index->number_of_sections  = number_of_sections;
+
+	return( 1 );
+}
+
+/* Retrieves the slot of a specific name
+ * Returns 1 if successful, 0 if no such name or -1 on error
+ */
+int libexe_section_name_index_get_slot_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     libexe_section_name_index_slot_t **slot,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_section_name_index_get_slot_by_name";
+	uint64_t name_value   = 0;
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( section_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_section_name_index_get_name_value(
+	          name,
+	          name_length,
+	          &name_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( section_name_index->number_of_slots == 0 ) )
+	{
+		return( 0 );
+	}
+	slot_index = (int) ( ( name_value * LIBEXE_SECTION_NAME_INDEX_HASH_MULTIPLIER ) >> ( 64 - section_name_index->number_of_hash_bits ) );
+
+	/* At least half of the slots are empty hence the probing ends
+	 */
+	while( section_name_index->slots[ slot_index ].number_of_sections != 0 )
+	{
+		if( section_name_index->slots[ slot_index ].name_value == name_value )
+		{
+			*slot = &( section_name_index->slots[ slot_index ] );
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( section_name_index->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of sections with a specific name
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_section_name_index_get_number_of_sections_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     int *number_of_sections,
+     libcerror_error_t **error )
+{
+	libexe_section_name_index_slot_t *slot = NULL;
+	static char *function                  = "libexe_section_name_index_get_number_of_sections_by_name";
+	int result                             = 0;
+
+	if( number_of_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sections.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_section_name_index_get_slot_by_name(
+	          section_name_index,
+	          name,
+	          name_length,
+	          &slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_sections = 0;
+	}
+	else
+	{
+		*number_of_sections = slot->number_of_sections;
+	}
+	return( 1 );
+}
+
+/* Retrieves the section index of a specific section with a specific name
+ * The name section index refers to the sections with the name in section table order
+ * Returns 1 if successful, 0 if no such section or -1 on error
+ */
+int libexe_section_name_index_get_section_index_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     int name_section_index,
+     int *section_index,
+     libcerror_error_t **error )
+{
+	libexe_section_name_index_slot_t *slot = NULL;
+	static char *function                  = "libexe_section_name_index_get_section_index_by_name";
+	int result                             = 0;
+
+	if( name_section_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid name section index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libexe_section_name_index_get_slot_by_name(
+	          section_name_index,
+	          name,
+	          name_length,
+	          &slot,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( name_section_index >= slot->number_of_sections ) )
+	{
+		return( 0 );
+	}
+	*section_index = section_name_index->section_indexes[ slot->section_indexes_offset + name_section_index ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,146 @@
+/*
+ * Section name index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_SECTION_NAME_INDEX_H )
+#define _LIBEXE_SECTION_NAME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_libcdata.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_section_name_index_slot libexe_section_name_index_slot_t;
+
+struct libexe_section_name_index_slot
+{
+	/* The name value
+	 * This is the name of the section packed into a 64-bit value
+	 */
+	uint64_t name_value;
+
+	/* The offset of the run of section indexes of the sections with the name
+	 */
+	int section_indexes_offset;
+
+	/* The number of sections with the name
+	 * 0 if the slot is empty
+	 */
+	int number_of_sections;
+};
+
+typedef struct libexe_section_name_index libexe_section_name_index_t;
+
+struct libexe_section_name_index
+{
+	/* The slots
+	 */
+	libexe_section_name_index_slot_t *slots;
+
+	/* The number of slots
+	 * This is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of hash bits
+	 */
+	int number_of_hash_bits;
+
+	/* The section indexes, stored per name as a contiguous run in section table order
+	 */
+	int *section_indexes;
+
+	/* The number of sections
+	 */
+	int number_of_sections;
+
+	/* The number of allocated slots
+	 * The slots are retained when the section name index is cleared
+	 */
+	int number_of_allocated_slots;
+
+	/* The number of allocated section indexes
+	 * The section indexes are retained when the section name index is cleared
+	 */
+	int number_of_allocated_section_indexes;
+};
+
+int libexe_section_name_index_initialize(
+     libexe_section_name_index_t **section_name_index,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_free(
+     libexe_section_name_index_t **section_name_index,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_clear(
+     libexe_section_name_index_t *section_name_index,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_get_name_value(
+     const char *name,
+     size_t name_length,
+     uint64_t *name_value,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_get_section_name_value(
+     libcdata_array_t *sections_array,
+     int section_index,
+     uint64_t *name_value,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_set_sections(
+     libexe_section_name_index_t *section_name_index,
+     libcdata_array_t *sections_array,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_get_slot_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     libexe_section_name_index_slot_t **slot,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_get_number_of_sections_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     int *number_of_sections,
+     libcerror_error_t **error );
+
+int libexe_section_name_index_get_section_index_by_name(
+     libexe_section_name_index_t *section_name_index,
+     const char *name,
+     size_t name_length,
+     int name_section_index,
+     int *section_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_SECTION_NAME_INDEX_H ) */
+
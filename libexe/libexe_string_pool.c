@@ -0,0 +1,584 @@
+/*
+ * String pool functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_arena.h"
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_string_pool.h"
+
+/* The multiplier of the Fibonacci hash of the string hashes
+ */
+#define LIBEXE_STRING_POOL_HASH_MULTIPLIER	(uint32_t) 0x9e3779b9UL
+
+/* Creates a string pool
+ * Make sure the value string_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_initialize(
+     libexe_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_pool_initialize";
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_pool = memory_allocate_structure(
+	                libexe_string_pool_t );
+
+	if( *string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_pool,
+	     0,
+	     sizeof( libexe_string_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string pool.",
+		 function );
+
+		memory_free(
+		 *string_pool );
+
+		*string_pool = NULL;
+
+		return( -1 );
+	}
+	if( libexe_arena_initialize(
+	     &( ( *string_pool )->arena ),
+	     LIBEXE_DEFAULT_ARENA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string_pool != NULL )
+	{
+		memory_free(
+		 *string_pool );
+
+		*string_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string pool
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_free(
+     libexe_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_pool_free";
+	int result            = 1;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		if( ( *string_pool )->slots != NULL )
+		{
+			memory_free(
+			 ( *string_pool )->slots );
+		}
+		if( libexe_arena_free(
+		     &( ( *string_pool )->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *string_pool );
+
+		*string_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the hash of a string
+ * The hash is a 32-bit FNV-1a hash
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_get_hash(
+     const uint8_t *string,
+     size_t string_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_pool_get_hash";
+	size_t string_index   = 0;
+	uint32_t safe_hash    = 0x811c9dc5UL;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		safe_hash ^= string[ string_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Resizes the slots of the string pool
+ * The strings in the slots are rehashed into the new slots
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_resize(
+     libexe_string_pool_t *string_pool,
+     int number_of_hash_bits,
+     libcerror_error_t **error )
+{
+	libexe_string_pool_slot_t *slots = NULL;
+	static char *function            = "libexe_string_pool_resize";
+	size_t slots_size                = 0;
+	int number_of_slots              = 0;
+	int slot_index                   = 0;
+	int source_slot_index            = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_hash_bits <= 0 )
+	 || ( number_of_hash_bits > 24 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hash bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_slots = 1 << number_of_hash_bits;
+
+	if( number_of_slots <= string_pool->number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of hash bits value too small.",
+		 function );
+
+		return( -1 );
+	}
+	slots_size = sizeof( libexe_string_pool_slot_t ) * number_of_slots;
+
+	slots = (libexe_string_pool_slot_t *) memory_allocate(
+	                                       slots_size );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     slots_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	for( source_slot_index = 0;
+	     source_slot_index < string_pool->number_of_slots;
+	     source_slot_index++ )
+	{
+		if( string_pool->slots[ source_slot_index ].string == NULL )
+		{
+			continue;
+		}
+		slot_index = (int) ( ( string_pool->slots[ source_slot_index ].hash * LIBEXE_STRING_POOL_HASH_MULTIPLIER ) >> ( 32 - number_of_hash_bits ) );
+
+		while( slots[ slot_index ].string != NULL )
+		{
+			slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+		}
+		slots[ slot_index ] = string_pool->slots[ source_slot_index ];
+	}
+	if( string_pool->slots != NULL )
+	{
+		memory_free(
+		 string_pool->slots );
+	}
+	string_pool->slots               = slots;
+	string_pool->number_of_slots     = number_of_slots;
+	string_pool->number_of_hash_bits = number_of_hash_bits;
+
+	return( 1 );
+}
+
+/* Interns a string in the string pool
+ * A string that was interned before is only stored once. The pooled string
+ * is terminated by an end of string character and remains valid until
+ * the string pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_intern(
+     libexe_string_pool_t *string_pool,
+     const uint8_t *string,
+     size_t string_length,
+     const char **pooled_string,
+     libcerror_error_t **error )
+{
+	libexe_string_pool_slot_t *slot = NULL;
+	uint8_t *string_data            = NULL;
+	static char *function           = "libexe_string_pool_intern";
+	size_t string_size              = 0;
+	uint32_t hash                   = 0;
+	int number_of_hash_bits         = 0;
+	int slot_index                  = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length >= (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( pooled_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pooled string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libexe_string_pool_get_hash(
+	     string,
+	     string_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the slots at most three quarters full
+	 */
+	if( ( ( string_pool->number_of_strings + 1 ) * 4 ) > ( string_pool->number_of_slots * 3 ) )
+	{
+		number_of_hash_bits = string_pool->number_of_hash_bits + 1;
+
+		if( number_of_hash_bits < 8 )
+		{
+			number_of_hash_bits = 8;
+		}
+		if( libexe_string_pool_resize(
+		     string_pool,
+		     number_of_hash_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string_size = string_length + 1;
+
+	slot_index = (int) ( ( hash * LIBEXE_STRING_POOL_HASH_MULTIPLIER ) >> ( 32 - string_pool->number_of_hash_bits ) );
+
+	while( string_pool->slots[ slot_index ].string != NULL )
+	{
+		slot = &( string_pool->slots[ slot_index ] );
+
+		if( ( slot->hash == hash )
+		 && ( (size_t) slot->string_size == string_size )
+		 && ( memory_compare(
+		       slot->string,
+		       string,
+		       string_length ) == 0 ) )
+		{
+			*pooled_string = slot->string;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( string_pool->number_of_slots - 1 );
+	}
+	/* Strings are packed into blocks allocated from the arena, a string that does
+	 * not fit in a block is allocated from the arena by itself
+	 */
+	if( string_size > string_pool->block_data_size )
+	{
+		if( string_size > LIBEXE_STRING_POOL_BLOCK_SIZE )
+		{
+			if( libexe_arena_allocate(
+			     string_pool->arena,
+			     string_size,
+			     (void **) &string_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to allocate string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libexe_arena_allocate(
+			     string_pool->arena,
+			     LIBEXE_STRING_POOL_BLOCK_SIZE,
+			     (void **) &( string_pool->block_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to allocate block.",
+				 function );
+
+				string_pool->block_data      = NULL;
+				string_pool->block_data_size = 0;
+
+				return( -1 );
+			}
+			string_pool->block_data_size = LIBEXE_STRING_POOL_BLOCK_SIZE;
+		}
+	}
+	if( string_data == NULL )
+	{
+		string_data = string_pool->block_data;
+
+		string_pool->block_data      += string_size;
+		string_pool->block_data_size -= string_size;
+	}
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     string_data,
+		     string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string_data[ string_length ] = 0;
+
+	slot = &( string_pool->slots[ slot_index ] );
+
+	slot->string      = (const char *) string_data;
+	slot->string_size = (uint32_t) string_size;
+	slot->hash        = hash;
+
+	string_pool->number_of_strings += 1;
+
+	*pooled_string = slot->string;
+
+	return( 1 );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libexe_string_pool_get_number_of_strings(
+     libexe_string_pool_t *string_pool,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libexe_string_pool_get_number_of_strings";
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_strings = string_pool->number_of_strings;
+
+	return( 1 );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * String pool functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_STRING_POOL_H )
+#define _LIBEXE_STRING_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_arena.h"
+#include "libexe_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libexe_string_pool_slot libexe_string_pool_slot_t;
+
+struct libexe_string_pool_slot
+{
+	/* The string
+	 * NULL if the slot is empty
+	 */
+	const char *string;
+
+	/* The string size
+	 * This includes the end of string character
+	 */
+	uint32_t string_size;
+
+	/* The hash of the string
+	 */
+	uint32_t hash;
+};
+
+typedef struct libexe_string_pool libexe_string_pool_t;
+
+struct libexe_string_pool
+{
+	/* The arena the strings are allocated from
+	 */
+	libexe_arena_t *arena;
+
+	/* The block the strings are currently packed into
+	 */
+	uint8_t *block_data;
+
+	/* The size of the unused data of the block
+	 */
+	size_t block_data_size;
+
+	/* The slots
+	 */
+	libexe_string_pool_slot_t *slots;
+
+	/* The number of slots
+	 * This is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of hash bits
+	 */
+	int number_of_hash_bits;
+
+	/* The number of strings
+	 */
+	int number_of_strings;
+};
+
+int libexe_string_pool_initialize(
+     libexe_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+int libexe_string_pool_free(
+     libexe_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+int libexe_string_pool_get_hash(
+     const uint8_t *string,
+     size_t string_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libexe_string_pool_resize(
+     libexe_string_pool_t *string_pool,
+     int number_of_hash_bits,
+     libcerror_error_t **error );
+
+int libexe_string_pool_intern(
+     libexe_string_pool_t *string_pool,
+     const uint8_t *string,
+     size_t string_length,
+     const char **pooled_string,
+     libcerror_error_t **error );
+
+int libexe_string_pool_get_number_of_strings(
+     libexe_string_pool_t *string_pool,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_STRING_POOL_H ) */
+
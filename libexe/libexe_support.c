@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
@@ -428,3 +429,439 @@ on_error:
 	return( -1 );
 }
 
+/* Determines the executable type of a file
+ * Returns 1 if successful, 0 if not an executable or -1 on error
+ */
+int libexe_check_file_type(
+     const char *filename,
+     int *executable_type,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libexe_check_file_type";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          executable_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check file type using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the executable type of a file
+ * Returns 1 if successful, 0 if not an executable or -1 on error
+ */
+int libexe_check_file_type_wide(
+     const wchar_t *filename,
+     int *executable_type,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libexe_check_file_type_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          executable_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check file type using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines the executable type of a file using a Basic File IO (bfio) handle
+ * Only the start of the file and the extended header signature, if stored
+ * outside the start of the file, are read
+ * Returns 1 if successful, 0 if not an executable or -1 on error
+ */
+int libexe_check_file_type_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     int *executable_type,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBEXE_FILE_TYPE_DATA_SIZE ];
+
+	const uint8_t *signature         = NULL;
+	static char *function            = "libexe_check_file_type_file_io_handle";
+	ssize_t read_count               = 0;
+	uint32_t extended_header_offset  = 0;
+	uint16_t relocation_table_offset = 0;
+	int file_io_handle_is_open       = 0;
+	int result                       = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable type.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              LIBEXE_FILE_TYPE_DATA_SIZE,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	/* The MZ header must be complete for the file to be opened
+	 */
+	if( ( (size_t) read_count < sizeof( exe_mz_header_t ) )
+	 || ( memory_compare(
+	       ( (exe_mz_header_t *) data )->signature,
+	       EXE_MZ_SIGNATURE,
+	       2 ) != 0 ) )
+	{
+		goto on_close;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (exe_mz_header_t *) data )->relocation_table_offset,
+	 relocation_table_offset );
+
+	if( relocation_table_offset >= 0x40 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_mz_header_t *) data )->extended_header_offset,
+		 extended_header_offset );
+	}
+	if( extended_header_offset == 0 )
+	{
+		*executable_type = LIBEXE_EXECUTABLE_TYPE_MZ;
+
+		result = 1;
+
+		goto on_close;
+	}
+	if( extended_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - 4 ) )
+	{
+		goto on_close;
+	}
+	/* The extended header signature is read separately when it is not stored
+	 * in the start of the file
+	 */
+	if( ( (size_t) extended_header_offset + 4 ) > (size_t) read_count )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              4,
+		              (off64_t) extended_header_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extended header signature at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 extended_header_offset,
+			 extended_header_offset );
+
+			goto on_error;
+		}
+		if( read_count != 4 )
+		{
+			goto on_close;
+		}
+		signature = data;
+	}
+	else
+	{
+		signature = &( data[ extended_header_offset ] );
+	}
+	if( ( signature[ 0 ] == (uint8_t) 'P' )
+	 && ( signature[ 1 ] == (uint8_t) 'E' )
+	 && ( signature[ 2 ] == 0 )
+	 && ( signature[ 3 ] == 0 ) )
+	{
+		*executable_type = LIBEXE_EXECUTABLE_TYPE_PE_COFF;
+
+		result = 1;
+	}
+	else if( ( signature[ 0 ] == (uint8_t) 'L' )
+	      && ( signature[ 1 ] == (uint8_t) 'E' ) )
+	{
+		*executable_type = LIBEXE_EXECUTABLE_TYPE_LE;
+
+		result = 1;
+	}
+	else if( ( signature[ 0 ] == (uint8_t) 'L' )
+	      && ( signature[ 1 ] == (uint8_t) 'X' ) )
+	{
+		*executable_type = LIBEXE_EXECUTABLE_TYPE_LX;
+
+		result = 1;
+	}
+	else if( ( signature[ 0 ] == (uint8_t) 'N' )
+	      && ( signature[ 1 ] == (uint8_t) 'E' ) )
+	{
+		*executable_type = LIBEXE_EXECUTABLE_TYPE_NE;
+
+		result = 1;
+	}
+on_close:
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -74,6 +74,28 @@ int libexe_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_check_file_type(
+     const char *filename,
+     int *executable_type,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEXE_EXTERN \
+int libexe_check_file_type_wide(
+     const wchar_t *filename,
+     int *executable_type,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEXE_EXTERN \
+int libexe_check_file_type_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     int *executable_type,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,417 @@
+/*
+ * Triage functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libexe_definitions.h"
+#include "libexe_libcerror.h"
+#include "libexe_triage.h"
+#include "libexe_types.h"
+
+#include "exe_file_header.h"
+#include "exe_mz_header.h"
+#include "exe_pe_header.h"
+
+/* Retrieves the header information of an executable from the start of its data
+ * The headers are read in place, hence no memory is allocated and the error is
+ * only set for invalid arguments. When the data is too small to contain the
+ * headers the required size is set to the size of data needed
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libexe_triage(
+     const uint8_t *data,
+     size_t data_size,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error )
+{
+	static char *function             = "libexe_triage";
+	uint32_t extended_header_offset   = 0;
+	uint16_t relocation_table_offset  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( triage_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage information.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     triage_info,
+	     0,
+	     sizeof( libexe_triage_info_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear triage information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size >= 2 )
+	 && ( memory_compare(
+	       ( (exe_mz_header_t *) data )->signature,
+	       EXE_MZ_SIGNATURE,
+	       2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( data_size < sizeof( exe_mz_header_t ) )
+	{
+		triage_info->required_size = sizeof( exe_mz_header_t );
+
+		return( 0 );
+	}
+	triage_info->executable_type = LIBEXE_EXECUTABLE_TYPE_MZ;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (exe_mz_header_t *) data )->relocation_table_offset,
+	 relocation_table_offset );
+
+	/* Only executables with a relocation table offset of 0x40 or more
+	 * contain an extended header offset
+	 */
+	if( relocation_table_offset < 0x40 )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (exe_mz_header_t *) data )->extended_header_offset,
+	 extended_header_offset );
+
+	if( extended_header_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( extended_header_offset > (uint32_t) ( LIBEXE_MAXIMUM_HEADER_DATA_SIZE - sizeof( exe_pe_header_t ) - sizeof( exe_coff_header_t ) ) )
+	{
+		return( 0 );
+	}
+	if( data_size < ( (size_t) extended_header_offset + 2 ) )
+	{
+		triage_info->required_size = (size_t) extended_header_offset + 2;
+
+		return( 0 );
+	}
+	if( ( data[ extended_header_offset ] == (uint8_t) 'L' )
+	 && ( data[ extended_header_offset + 1 ] == (uint8_t) 'E' ) )
+	{
+		triage_info->executable_type = LIBEXE_EXECUTABLE_TYPE_LE;
+
+		return( 1 );
+	}
+	else if( ( data[ extended_header_offset ] == (uint8_t) 'L' )
+	      && ( data[ extended_header_offset + 1 ] == (uint8_t) 'X' ) )
+	{
+		triage_info->executable_type = LIBEXE_EXECUTABLE_TYPE_LX;
+
+		return( 1 );
+	}
+	else if( ( data[ extended_header_offset ] == (uint8_t) 'N' )
+	      && ( data[ extended_header_offset + 1 ] == (uint8_t) 'E' ) )
+	{
+		triage_info->executable_type = LIBEXE_EXECUTABLE_TYPE_NE;
+
+		return( 1 );
+	}
+	else if( ( data[ extended_header_offset ] == (uint8_t) 'P' )
+	      && ( data[ extended_header_offset + 1 ] == (uint8_t) 'E' ) )
+	{
+		return( libexe_triage_read_pe_header(
+		         data,
+		         data_size,
+		         extended_header_offset,
+		         triage_info,
+		         error ) );
+	}
+	return( 0 );
+}
+
+/* Retrieves the header information from the PE/COFF header
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libexe_triage_read_pe_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t pe_header_offset,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error )
+{
+	const exe_coff_header_t *coff_header = NULL;
+	static char *function                = "libexe_triage_read_pe_header";
+	size_t data_offset                   = 0;
+	uint16_t optional_header_size        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( triage_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage information.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (size_t) pe_header_offset + sizeof( exe_pe_header_t ) + sizeof( exe_coff_header_t );
+
+	if( data_size < data_offset )
+	{
+		triage_info->required_size = data_offset;
+
+		return( 0 );
+	}
+	if( ( data[ pe_header_offset + 2 ] != 0 )
+	 || ( data[ pe_header_offset + 3 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	coff_header = (exe_coff_header_t *) &( data[ pe_header_offset + sizeof( exe_pe_header_t ) ] );
+
+	triage_info->executable_type = LIBEXE_EXECUTABLE_TYPE_PE_COFF;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->target_architecture_type,
+	 triage_info->target_architecture_type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->number_of_sections,
+	 triage_info->number_of_sections );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 coff_header->creation_time,
+	 triage_info->creation_time );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->optional_header_size,
+	 optional_header_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 coff_header->characteristic_flags,
+	 triage_info->characteristic_flags );
+
+	if( optional_header_size == 0 )
+	{
+		return( 1 );
+	}
+	return( libexe_triage_read_coff_optional_header(
+	         data,
+	         data_size,
+	         data_offset,
+	         optional_header_size,
+	         triage_info,
+	         error ) );
+}
+
+/* Retrieves the header information from the COFF optional header
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libexe_triage_read_coff_optional_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t optional_header_offset,
+     uint16_t optional_header_size,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error )
+{
+	const uint8_t *optional_header_data         = NULL;
+	static char *function                       = "libexe_triage_read_coff_optional_header";
+	size_t data_offset                          = 0;
+	uint32_t data_directory_index               = 0;
+	uint32_t number_of_data_directories_entries = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( triage_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( optional_header_offset > data_size )
+	 || ( (size_t) optional_header_size > ( data_size - optional_header_offset ) ) )
+	{
+		triage_info->required_size = optional_header_offset + optional_header_size;
+
+		return( 0 );
+	}
+	if( optional_header_size < sizeof( exe_coff_optional_header_t ) )
+	{
+		return( 0 );
+	}
+	optional_header_data = &( data[ optional_header_offset ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (exe_coff_optional_header_t *) optional_header_data )->signature,
+	 triage_info->optional_header_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (exe_coff_optional_header_t *) optional_header_data )->entry_point_offset,
+	 triage_info->entry_point );
+
+	if( triage_info->optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32 )
+	{
+		data_offset = sizeof( exe_coff_optional_header_t );
+
+		if( sizeof( exe_coff_optional_header_pe32_t ) > ( (size_t) optional_header_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) &( optional_header_data[ data_offset ] ) )->image_base_offset,
+		 triage_info->image_base );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) &( optional_header_data[ data_offset ] ) )->checksum,
+		 triage_info->checksum );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) &( optional_header_data[ data_offset ] ) )->subsystem,
+		 triage_info->subsystem );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) &( optional_header_data[ data_offset ] ) )->dll_characteristic_flags,
+		 triage_info->dll_characteristic_flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_t *) &( optional_header_data[ data_offset ] ) )->number_of_data_directories_entries,
+		 number_of_data_directories_entries );
+
+		data_offset += sizeof( exe_coff_optional_header_pe32_t );
+	}
+	else if( triage_info->optional_header_signature == LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32_PLUS )
+	{
+		/* The PE32+ optional header does not contain the data base offset
+		 */
+		data_offset = sizeof( exe_coff_optional_header_t ) - 4;
+
+		if( sizeof( exe_coff_optional_header_pe32_plus_t ) > ( (size_t) optional_header_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) &( optional_header_data[ data_offset ] ) )->image_base_offset,
+		 triage_info->image_base );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) &( optional_header_data[ data_offset ] ) )->checksum,
+		 triage_info->checksum );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) &( optional_header_data[ data_offset ] ) )->subsystem,
+		 triage_info->subsystem );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) &( optional_header_data[ data_offset ] ) )->dll_characteristic_flags,
+		 triage_info->dll_characteristic_flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (exe_coff_optional_header_pe32_plus_t *) &( optional_header_data[ data_offset ] ) )->number_of_data_directories_entries,
+		 number_of_data_directories_entries );
+
+		data_offset += sizeof( exe_coff_optional_header_pe32_plus_t );
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( number_of_data_directories_entries > 16 )
+	{
+		return( 0 );
+	}
+	if( ( (size_t) number_of_data_directories_entries * 8 ) > ( (size_t) optional_header_size - data_offset ) )
+	{
+		return( 0 );
+	}
+	for( data_directory_index = 0;
+	     data_directory_index < number_of_data_directories_entries;
+	     data_directory_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( optional_header_data[ data_offset ] ),
+		 triage_info->data_directory_virtual_addresses[ data_directory_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( optional_header_data[ data_offset + 4 ] ),
+		 triage_info->data_directory_sizes[ data_directory_index ] );
+
+		data_offset += 8;
+	}
+	triage_info->number_of_data_directories = number_of_data_directories_entries;
+
+	return( 1 );
+}
+
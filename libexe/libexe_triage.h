@@ -0,0 +1,63 @@
+/*
+ * Triage functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEXE_TRIAGE_H )
+#define _LIBEXE_TRIAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libexe_extern.h"
+#include "libexe_libcerror.h"
+#include "libexe_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBEXE_EXTERN \
+int libexe_triage(
+     const uint8_t *data,
+     size_t data_size,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error );
+
+int libexe_triage_read_pe_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t pe_header_offset,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error );
+
+int libexe_triage_read_coff_optional_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t optional_header_offset,
+     uint16_t optional_header_size,
+     libexe_triage_info_t *triage_info,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEXE_TRIAGE_H ) */
+
@@ -34,15 +34,107 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libexe_batch {}		libexe_batch_t;
 typedef struct libexe_file {}		libexe_file_t;
+typedef struct libexe_scanner {}	libexe_scanner_t;
 typedef struct libexe_section {}	libexe_section_t;
 
 #else
+typedef intptr_t libexe_batch_t;
 typedef intptr_t libexe_file_t;
+typedef intptr_t libexe_scanner_t;
 typedef intptr_t libexe_section_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file data range
+ */
+typedef struct libexe_range libexe_range_t;
+
+struct libexe_range
+{
+	/* The file offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The data, which must be at least size bytes
+	 */
+	uint8_t *data;
+};
+
+/* The header information of an executable
+ */
+typedef struct libexe_triage_info libexe_triage_info_t;
+
+struct libexe_triage_info
+{
+	/* The size of the data required to read the headers, which is larger
+	 * than the size of the data provided when the data is too small
+	 */
+	size_t required_size;
+
+	/* The executable type
+	 */
+	uint8_t executable_type;
+
+	/* The target architecture type (machine)
+	 */
+	uint16_t target_architecture_type;
+
+	/* The number of sections
+	 */
+	uint16_t number_of_sections;
+
+	/* The creation time, which contains a POSIX timestamp
+	 */
+	uint32_t creation_time;
+
+	/* The characteristic flags
+	 */
+	uint16_t characteristic_flags;
+
+	/* The COFF optional header signature (magic)
+	 */
+	uint16_t optional_header_signature;
+
+	/* The entry point relative virtual address (RVA)
+	 */
+	uint32_t entry_point;
+
+	/* The image base
+	 */
+	uint64_t image_base;
+
+	/* The subsystem
+	 */
+	uint16_t subsystem;
+
+	/* The DLL characteristic flags
+	 */
+	uint16_t dll_characteristic_flags;
+
+	/* The checksum
+	 */
+	uint32_t checksum;
+
+	/* The number of data directories
+	 */
+	uint32_t number_of_data_directories;
+
+	/* The relative virtual addresses (RVAs) of the data directories
+	 * indexed by the data directory number in the COFF optional header
+	 */
+	uint32_t data_directory_virtual_addresses[ 16 ];
+
+	/* The sizes of the data directories
+	 */
+	uint32_t data_directory_sizes[ 16 ];
+};
+
 #endif /* defined( HAVE_LOCAL_LIBEXE ) */
 
 #endif /* !defined( _LIBEXE_INTERNAL_TYPES_H ) */
@@ -0,0 +1,659 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_arena.h"
+#include "../libexe/libexe_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libexe_arena_t *arena           = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_arena_initialize(
+	          &arena,
+	          LIBEXE_DEFAULT_ARENA_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_arena_free(
+	          &arena,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_arena_initialize(
+	          NULL,
+	          LIBEXE_DEFAULT_ARENA_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libexe_arena_t *) 0x12345678UL;
+
+	result = libexe_arena_initialize(
+	          &arena,
+	          LIBEXE_DEFAULT_ARENA_SIZE,
+	          &error );
+
+	arena = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_arena_initialize(
+	          &arena,
+	          (size_t) LIBEXE_MAXIMUM_ARENA_SIZE + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_arena_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_arena_initialize(
+		          &arena,
+		          LIBEXE_DEFAULT_ARENA_SIZE,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libexe_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_arena_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_arena_initialize(
+		          &arena,
+		          LIBEXE_DEFAULT_ARENA_SIZE,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libexe_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libexe_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_arena_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libexe_arena_t *arena    = NULL;
+	uint8_t *data1           = NULL;
+	uint8_t *data2           = NULL;
+	uint8_t *data3           = NULL;
+	size_t allocated_size    = 0;
+	size_t first_block_size  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_arena_allocate(
+	          arena,
+	          3,
+	          (void **) &data1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "data1",
+	 data1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data1 alignment",
+	 (size_t) ( (intptr_t) data1 % LIBEXE_ARENA_ALIGNMENT ),
+	 (size_t) 0 );
+
+	result = libexe_arena_get_allocated_size(
+	          arena,
+	          &first_block_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_arena_allocate(
+	          arena,
+	          5,
+	          (void **) &data2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Consecutive allocations are made from the same block
+	 */
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data2 - data1",
+	 (size_t) ( data2 - data1 ),
+	 (size_t) LIBEXE_ARENA_ALIGNMENT );
+
+	/* An allocation larger than the block size is made from a dedicated block
+	 */
+	result = libexe_arena_allocate(
+	          arena,
+	          4096,
+	          (void **) &data3,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "data3",
+	 data3 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data3 alignment",
+	 (size_t) ( (intptr_t) data3 % LIBEXE_ARENA_ALIGNMENT ),
+	 (size_t) 0 );
+
+	memory_set(
+	 data3,
+	 0xff,
+	 4096 );
+
+	result = libexe_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_LESS_THAN_UINT64(
+	 "first_block_size",
+	 (uint64_t) first_block_size + 4096,
+	 (uint64_t) allocated_size );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Resetting the arena retains only the first block
+	 */
+	result = libexe_arena_reset(
+	          arena,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 first_block_size );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The retained block is reused after a reset
+	 */
+	result = libexe_arena_allocate(
+	          arena,
+	          8,
+	          (void **) &data2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data2 - data1",
+	 (size_t) ( data2 - data1 ),
+	 (size_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_arena_allocate(
+	          NULL,
+	          8,
+	          (void **) &data1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_arena_allocate(
+	          arena,
+	          0,
+	          (void **) &data1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_arena_free(
+	          &arena,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libexe_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_arena_initialize",
+	 exe_test_arena_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_arena_free",
+	 exe_test_arena_free );
+
+	EXE_TEST_RUN(
+	 "libexe_arena_allocate",
+	 exe_test_arena_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
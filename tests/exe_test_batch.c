@@ -0,0 +1,1072 @@
+/*
+ * Library batch type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_getopt.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+
+#include "../libexe/libexe_batch.h"
+#include "../libexe/libexe_definitions.h"
+
+/* Tests the libexe_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_batch_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libexe_batch_t *batch           = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_batch_initialize(
+	          &batch,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_free(
+	          &batch,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_batch_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (libexe_batch_t *) 0x12345678UL;
+
+	result = libexe_batch_initialize(
+	          &batch,
+	          4,
+	          &error );
+
+	batch = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_initialize(
+	          &batch,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_initialize(
+	          &batch,
+	          LIBEXE_MAXIMUM_BATCH_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_batch_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_batch_initialize(
+		          &batch,
+		          4,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libexe_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_batch_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_batch_initialize(
+		          &batch,
+		          4,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				libexe_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libexe_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_batch_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_batch_open function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_batch_open(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error      = NULL;
+	libcerror_error_t *open_error = NULL;
+	libexe_batch_t *batch         = NULL;
+	libexe_file_t *file           = NULL;
+	int entry_index               = 0;
+	int number_of_entries         = 0;
+	int number_of_sections        = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_initialize(
+	          &batch,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file is appended multiple times with a file that does not exist in between
+	 */
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		if( entry_index == 2 )
+		{
+			result = libexe_batch_append_filename(
+			          batch,
+			          "exe_test_batch_missing.exe",
+			          &number_of_entries,
+			          &error );
+		}
+		else
+		{
+			result = libexe_batch_append_filename(
+			          batch,
+			          narrow_source,
+			          &number_of_entries,
+			          &error );
+		}
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 entry_index );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libexe_batch_open(
+	          batch,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_get_number_of_entries(
+	          batch,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 4 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		file = NULL;
+
+		result = libexe_batch_get_file(
+		          batch,
+		          entry_index,
+		          &file,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( entry_index == 2 ) ? 0 : 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		open_error = NULL;
+
+		result = libexe_batch_get_open_error(
+		          batch,
+		          entry_index,
+		          &open_error,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( entry_index == 2 ) ? 1 : 0 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( entry_index == 2 )
+		{
+			EXE_TEST_ASSERT_IS_NULL(
+			 "file",
+			 file );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "open_error",
+			 open_error );
+
+			continue;
+		}
+		EXE_TEST_ASSERT_IS_NULL(
+		 "open_error",
+		 open_error );
+
+		result = libexe_file_get_number_of_sections(
+		          file,
+		          &number_of_sections,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Files that were opened before are not opened again
+	 */
+	result = libexe_batch_open(
+	          batch,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_batch_open(
+	          NULL,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_open(
+	          batch,
+	          LIBEXE_OPEN_WRITE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_append_filename(
+	          batch,
+	          NULL,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_get_file(
+	          batch,
+	          -1,
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_get_file(
+	          batch,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_get_open_error(
+	          batch,
+	          -1,
+	          &open_error,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_get_open_error(
+	          batch,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_close_files(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_batch_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_batch_free(
+	          &batch,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libexe_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_batch_close_files function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_batch_close_files(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error  = NULL;
+	libexe_batch_t *batch     = NULL;
+	libexe_file_t *file       = NULL;
+	int entry_index           = 0;
+	int number_of_entries     = 0;
+	int number_of_open_calls  = 0;
+	int number_of_open_files  = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_initialize(
+	          &batch,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 3;
+	     entry_index++ )
+	{
+		result = libexe_batch_append_filename(
+		          batch,
+		          narrow_source,
+		          &number_of_entries,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	( (libexe_internal_batch_t *) batch )->maximum_number_of_open_files = 1;
+
+	/* Test regular cases
+	 */
+	do
+	{
+		result = libexe_batch_open(
+		          batch,
+		          LIBEXE_OPEN_READ,
+		          &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_open_calls++;
+
+		for( entry_index = 0;
+		     entry_index < 3;
+		     entry_index++ )
+		{
+			if( libexe_batch_get_file(
+			     batch,
+			     entry_index,
+			     &file,
+			     &error ) == 1 )
+			{
+				number_of_open_files++;
+			}
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_open_files",
+		 number_of_open_files,
+		 number_of_open_calls );
+
+		result = libexe_batch_close_files(
+		          batch,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( ( number_of_open_calls < 3 )
+	    && ( number_of_open_files < 3 ) );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_files",
+	 number_of_open_files,
+	 3 );
+
+	/* Files that were closed are not opened again
+	 */
+	result = libexe_batch_open(
+	          batch,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_get_file(
+	          batch,
+	          0,
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_free(
+	          &batch,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a file that cannot be opened does not count as an open file
+	 */
+	result = libexe_batch_initialize(
+	          &batch,
+	          1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_append_filename(
+	          batch,
+	          "exe_test_batch_missing.exe",
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_append_filename(
+	          batch,
+	          narrow_source,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libexe_internal_batch_t *) batch )->maximum_number_of_open_files = 1;
+
+	result = libexe_batch_open(
+	          batch,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_batch_get_file(
+	          batch,
+	          1,
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libexe_batch_free(
+	          &batch,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		libexe_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = exe_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	EXE_TEST_RUN(
+	 "libexe_batch_initialize",
+	 exe_test_batch_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_batch_free",
+	 exe_test_batch_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_batch_open",
+		 exe_test_batch_open,
+		 source );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_batch_close_files",
+		 exe_test_batch_close_files,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
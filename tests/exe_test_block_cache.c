@@ -0,0 +1,1214 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libbfio.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_block_cache.h"
+#include "../libexe/libexe_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* The test data is filled in by exe_test_block_cache_data_initialize
+ */
+uint8_t exe_test_block_cache_data1[ 16384 ];
+
+/* Fills the test data with a pattern that differs per block
+ */
+void exe_test_block_cache_data_initialize(
+      void )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		exe_test_block_cache_data1[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+}
+
+/* Tests the libexe_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libexe_block_cache_t *block_cache = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache->cache",
+	 block_cache->cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A cache size smaller than the block size disables block caching
+	 */
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          LIBEXE_BLOCK_CACHE_BLOCK_SIZE - 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "block_cache->cache",
+	 block_cache->cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_block_cache_initialize(
+	          NULL,
+	          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libexe_block_cache_t *) 0x12345678UL;
+
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+	          &error );
+
+	block_cache = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          (size64_t) LIBEXE_MAXIMUM_BLOCK_CACHE_SIZE + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_block_cache_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_block_cache_initialize(
+		          &block_cache,
+		          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libexe_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_block_cache_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_block_cache_initialize(
+		          &block_cache,
+		          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libexe_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libexe_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_block_cache_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_block_cache_get_cache_size and libexe_block_cache_set_cache_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_block_cache_set_cache_size(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libexe_block_cache_t *block_cache = NULL;
+	size64_t cache_size               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          LIBEXE_DEFAULT_BLOCK_CACHE_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_block_cache_get_cache_size(
+	          block_cache,
+	          &cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 (uint64_t) cache_size,
+	 (uint64_t) LIBEXE_DEFAULT_BLOCK_CACHE_SIZE );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_set_cache_size(
+	          block_cache,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "block_cache->cache",
+	 block_cache->cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_set_cache_size(
+	          block_cache,
+	          2 * LIBEXE_BLOCK_CACHE_BLOCK_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache->cache",
+	 block_cache->cache );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_get_cache_size(
+	          block_cache,
+	          &cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 (uint64_t) cache_size,
+	 (uint64_t) ( 2 * LIBEXE_BLOCK_CACHE_BLOCK_SIZE ) );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_block_cache_get_cache_size(
+	          NULL,
+	          &cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_get_cache_size(
+	          block_cache,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_set_cache_size(
+	          NULL,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_set_cache_size(
+	          block_cache,
+	          (size64_t) LIBEXE_MAXIMUM_BLOCK_CACHE_SIZE + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libexe_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_block_cache_read_buffer and libexe_block_cache_get_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_block_cache_read_buffer(
+     void )
+{
+	uint8_t buffer[ 8192 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libexe_block_cache_t *block_cache = NULL;
+	ssize_t read_count                = 0;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_block_cache_initialize(
+	          &block_cache,
+	          2 * LIBEXE_BLOCK_CACHE_BLOCK_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          exe_test_block_cache_data1,
+	          16384,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The section data starts at offset 256 and is 10000 bytes of size
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              4000,
+	              buffer,
+	              200,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( exe_test_block_cache_data1[ 256 + 4000 ] ),
+	          200 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The read spans blocks 0 and 1, both are read from the file
+	 */
+	result = libexe_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              10,
+	              buffer,
+	              100,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( exe_test_block_cache_data1[ 256 + 10 ] ),
+	          100 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Reading block 2 evicts the least recently used block 1
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              9000,
+	              buffer,
+	              8192,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( exe_test_block_cache_data1[ 256 + 9000 ] ),
+	          1000 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              0,
+	              buffer,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 3 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same block index of another section is a different block
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              1,
+	              512,
+	              1024,
+	              0,
+	              buffer,
+	              2048,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( exe_test_block_cache_data1[ 512 ] ),
+	          1024 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read beyond the end of the section data
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              10000,
+	              buffer,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read section data that extends beyond the end of the file
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              2,
+	              16000,
+	              1000,
+	              0,
+	              buffer,
+	              1000,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 384 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clearing the cache resets the statistics
+	 */
+	result = libexe_block_cache_clear(
+	          block_cache,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read with block caching disabled
+	 */
+	result = libexe_block_cache_set_cache_size(
+	          block_cache,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              4000,
+	              buffer,
+	              200,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( exe_test_block_cache_data1[ 256 + 4000 ] ),
+	          200 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libexe_block_cache_read_buffer(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              0,
+	              buffer,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              -1,
+	              10000,
+	              0,
+	              buffer,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              -1,
+	              buffer,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              0,
+	              NULL,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_block_cache_read_buffer(
+	              block_cache,
+	              file_io_handle,
+	              0,
+	              256,
+	              10000,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_get_statistics(
+	          block_cache,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libexe_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	exe_test_block_cache_data_initialize();
+
+	EXE_TEST_RUN(
+	 "libexe_block_cache_initialize",
+	 exe_test_block_cache_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_block_cache_free",
+	 exe_test_block_cache_free );
+
+	EXE_TEST_RUN(
+	 "libexe_block_cache_set_cache_size",
+	 exe_test_block_cache_set_cache_size );
+
+	EXE_TEST_RUN(
+	 "libexe_block_cache_read_buffer",
+	 exe_test_block_cache_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
@@ -59,6 +59,7 @@ int exe_test_coff_header_initialize(
 	 */
 	result = libexe_coff_header_initialize(
 	          &coff_header,
+	          NULL,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -94,6 +95,7 @@ int exe_test_coff_header_initialize(
 	/* Test error cases
 	 */
 	result = libexe_coff_header_initialize(
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -113,6 +115,7 @@ int exe_test_coff_header_initialize(
 
 	result = libexe_coff_header_initialize(
 	          &coff_header,
+	          NULL,
 	          &error );
 
 	coff_header = NULL;
@@ -141,6 +144,7 @@ int exe_test_coff_header_initialize(
 
 		result = libexe_coff_header_initialize(
 		          &coff_header,
+		          NULL,
 		          &error );
 
 		if( exe_test_malloc_attempts_before_fail != -1 )
@@ -183,6 +187,7 @@ int exe_test_coff_header_initialize(
 
 		result = libexe_coff_header_initialize(
 		          &coff_header,
+		          NULL,
 		          &error );
 
 		if( exe_test_memset_attempts_before_fail != -1 )
@@ -0,0 +1,540 @@
+/*
+ * Library data_block type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_libbfio.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_data_block.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+uint8_t exe_test_data_block_data1[ 64 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
+/* Tests the libexe_data_block_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_data_block_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libexe_data_block_t *data_block = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_data_block_initialize(
+	          &data_block,
+	          4096,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_block->data_size",
+	 data_block->data_size,
+	 (size_t) 4096 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_data_block_free(
+	          &data_block,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_data_block_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_block = (libexe_data_block_t *) 0x12345678UL;
+
+	result = libexe_data_block_initialize(
+	          &data_block,
+	          4096,
+	          &error );
+
+	data_block = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_data_block_initialize(
+	          &data_block,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_data_block_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_data_block_initialize(
+		          &data_block,
+		          4096,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( data_block != NULL )
+			{
+				libexe_data_block_free(
+				 &data_block,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "data_block",
+			 data_block );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_data_block_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_data_block_initialize(
+		          &data_block,
+		          4096,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( data_block != NULL )
+			{
+				libexe_data_block_free(
+				 &data_block,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "data_block",
+			 data_block );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		libexe_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_data_block_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_data_block_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_data_block_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_data_block_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_data_block_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_data_block_t *data_block  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_data_block_initialize(
+	          &data_block,
+	          32,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          exe_test_data_block_data1,
+	          64,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_data_block_read_file_io_handle(
+	          data_block,
+	          file_io_handle,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_block->data_size",
+	 data_block->data_size,
+	 (size_t) 32 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data_block->data,
+	          &( exe_test_data_block_data1[ 16 ] ),
+	          32 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The data size is reduced at the end of the file
+	 */
+	result = libexe_data_block_read_file_io_handle(
+	          data_block,
+	          file_io_handle,
+	          48,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_block->data_size",
+	 data_block->data_size,
+	 (size_t) 16 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_data_block_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_data_block_read_file_io_handle(
+	          data_block,
+	          NULL,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_data_block_free(
+	          &data_block,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_block != NULL )
+	{
+		libexe_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_data_block_initialize",
+	 exe_test_data_block_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_data_block_free",
+	 exe_test_data_block_free );
+
+	EXE_TEST_RUN(
+	 "libexe_data_block_read_file_io_handle",
+	 exe_test_data_block_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
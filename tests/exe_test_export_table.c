@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -37,6 +38,32 @@
 
 #if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
 
+uint8_t exe_test_export_table_data1[ 75 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00,
+	0x34, 0x10, 0x00, 0x00, 0x3c, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x41, 0x6c, 0x70, 0x68, 0x61, 0x00, 0x42, 0x65, 0x74, 0x61, 0x00 };
+
+/* Same as data1 but with the names not sorted
+ */
+uint8_t exe_test_export_table_data2[ 75 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00,
+	0x34, 0x10, 0x00, 0x00, 0x3c, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x41, 0x6c, 0x70, 0x68, 0x61, 0x00, 0x42, 0x65, 0x74, 0x61, 0x00 };
+
+/* Same as data1 but with the export address table stored before the header
+ * and outside the range of the export table data directory
+ */
+uint8_t exe_test_export_table_data3[ 75 ] = {
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00,
+	0x3c, 0x10, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x41, 0x6c, 0x70, 0x68, 0x61, 0x00, 0x42, 0x65, 0x74, 0x61, 0x00 };
+
 /* Tests the libexe_export_table_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -305,7 +332,6 @@ int exe_test_export_table_read(
 	          NULL,
 	          NULL,
 	          0,
-	          0,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -324,7 +350,6 @@ int exe_test_export_table_read(
 	          export_table,
 	          NULL,
 	          0,
-	          0,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -375,36 +400,1212 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libexe_export_table_read_data function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc EXE_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc EXE_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
-#endif
+int exe_test_export_table_read_data(
+     void )
 {
-	EXE_TEST_UNREFERENCED_PARAMETER( argc )
-	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error            = NULL;
+	libexe_export_table_t *export_table = NULL;
+	int number_of_entries               = 0;
+	int result                          = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
 
-	EXE_TEST_RUN(
-	 "libexe_export_table_initialize",
-	 exe_test_export_table_initialize );
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	EXE_TEST_RUN(
-	 "libexe_export_table_free",
-	 exe_test_export_table_free );
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_table",
+	 export_table );
 
-	EXE_TEST_RUN(
-	 "libexe_export_table_read",
-	 exe_test_export_table_read );
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_number_of_entries(
+	          export_table,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the export address table is stored before the header
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data3,
+	          75,
+	          12,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_number_of_entries(
+	          export_table,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_read_data(
+	          NULL,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_read_data(
+	          export_table,
+	          NULL,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          0,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data offset is out of bounds
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data3,
+	          75,
+	          64,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the tables are stored outside the data
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00002000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the last name has no end-of-string character
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          74,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_table != NULL )
+	{
+		libexe_export_table_free(
+		 &export_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_export_table_get_entry_index_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_export_table_get_entry_index_by_name(
+     void )
+{
+	char string[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libexe_export_table_t *export_table = NULL;
+	size_t string_size                  = 0;
+	uint32_t ordinal                    = 0;
+	uint32_t relative_virtual_address   = 0;
+	int entry_index                     = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_by_index(
+	          export_table,
+	          2,
+	          &ordinal,
+	          &relative_virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "ordinal",
+	 ordinal,
+	 (uint32_t) 7 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_address",
+	 relative_virtual_address,
+	 (uint32_t) 0x00003000UL );
+
+	result = libexe_export_table_get_entry_name_size(
+	          export_table,
+	          2,
+	          &string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 6 );
+
+	result = libexe_export_table_get_entry_name(
+	          export_table,
+	          2,
+	          string,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Alpha",
+	          6 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_export_table_get_entry_name_size(
+	          export_table,
+	          1,
+	          &string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alpha",
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Beta",
+	          4,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alph",
+	          4,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Gamma",
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that contains an end-of-string character
+	 */
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alpha\0Beta",
+	          10,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_export_table_get_entry_index_by_name(
+	          NULL,
+	          "Alpha",
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          NULL,
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alpha",
+	          5,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_get_entry_name(
+	          export_table,
+	          2,
+	          string,
+	          5,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_get_entry_by_index(
+	          export_table,
+	          3,
+	          &ordinal,
+	          &relative_virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with names that are not sorted
+	 */
+	/* Initialize test
+	 */
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data2,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_by_index(
+	          export_table,
+	          2,
+	          &ordinal,
+	          &relative_virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "ordinal",
+	 ordinal,
+	 (uint32_t) 7 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_virtual_address",
+	 relative_virtual_address,
+	 (uint32_t) 0x00003000UL );
+
+	result = libexe_export_table_get_entry_name_size(
+	          export_table,
+	          2,
+	          &string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 6 );
+
+	result = libexe_export_table_get_entry_name(
+	          export_table,
+	          2,
+	          string,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Alpha",
+	          6 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_export_table_get_entry_name_size(
+	          export_table,
+	          1,
+	          &string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alpha",
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Beta",
+	          4,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Alph",
+	          4,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_name(
+	          export_table,
+	          "Gamma",
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_table != NULL )
+	{
+		libexe_export_table_free(
+		 &export_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_export_table_get_entry_index_by_ordinal function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_export_table_get_entry_index_by_ordinal(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libexe_export_table_t *export_table = NULL;
+	int entry_index                     = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_export_table_initialize(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_read_data(
+	          export_table,
+	          exe_test_export_table_data1,
+	          75,
+	          0,
+	          0x00001000,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          7,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	/* Test unused entry and ordinals outside the table
+	 */
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          6,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          4,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          8,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          NULL,
+	          5,
+	          &entry_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_export_table_get_entry_index_by_ordinal(
+	          export_table,
+	          5,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_export_table_free(
+	          &export_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "export_table",
+	 export_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_table != NULL )
+	{
+		libexe_export_table_free(
+		 &export_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_initialize",
+	 exe_test_export_table_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_free",
+	 exe_test_export_table_free );
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_read",
+	 exe_test_export_table_read );
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_read_data",
+	 exe_test_export_table_read_data );
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_get_entry_index_by_name",
+	 exe_test_export_table_get_entry_index_by_name );
+
+	EXE_TEST_RUN(
+	 "libexe_export_table_get_entry_index_by_ordinal",
+	 exe_test_export_table_get_entry_index_by_ordinal );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -34,10 +35,12 @@
 #include "exe_test_getopt.h"
 #include "exe_test_libbfio.h"
 #include "exe_test_libcerror.h"
+#include "exe_test_libcthreads.h"
 #include "exe_test_libexe.h"
 #include "exe_test_macros.h"
 #include "exe_test_memory.h"
 
+#include "../libexe/libexe_definitions.h"
 #include "../libexe/libexe_file.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -48,6 +51,61 @@
 #define EXE_TEST_FILE_VERBOSE
  */
 
+typedef struct exe_test_file_stream_values exe_test_file_stream_values_t;
+
+struct exe_test_file_stream_values
+{
+	/* The index of the section of which data was last passed
+	 */
+	int section_index;
+
+	/* The data offset of the next data of the section
+	 */
+	off64_t next_data_offset;
+
+	/* The total size of the section data passed
+	 */
+	size64_t data_size;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define EXE_TEST_FILE_NUMBER_OF_THREADS			4
+#define EXE_TEST_FILE_NUMBER_OF_THREAD_ITERATIONS	256
+#define EXE_TEST_FILE_THREAD_READ_SIZE			512
+#define EXE_TEST_FILE_MAXIMUM_THREAD_SECTION_SIZE	65536
+
+typedef struct exe_test_file_thread_values exe_test_file_thread_values_t;
+
+struct exe_test_file_thread_values
+{
+	/* The file shared by the threads
+	 */
+	libexe_file_t *file;
+
+	/* The reference data of the sections
+	 */
+	uint8_t **section_data;
+
+	/* The sizes of the reference data of the sections
+	 */
+	size_t *section_data_sizes;
+
+	/* The number of sections
+	 */
+	int number_of_sections;
+
+	/* The index of the thread
+	 */
+	int thread_index;
+
+	/* The result of the thread
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 #if !defined( LIBEXE_HAVE_BFIO )
 
 LIBEXE_EXTERN \
@@ -62,6 +120,20 @@ int libexe_file_open_file_io_handle(
      int access_flags,
      libexe_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_file_open_stream_file_io_handle(
+     libexe_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     int (*callback_function)(
+            int section_index,
+            off64_t data_offset,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data ),
+     void *callback_data,
+     libexe_error_t **error );
+
 #endif /* !defined( LIBEXE_HAVE_BFIO ) */
 
 /* Creates and opens a source file
@@ -776,22 +848,29 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Tests the libexe_file_open_file_io_handle function
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Tests the libexe_file_open_mmap function
  * Returns 1 if successful or 0 if not
  */
-int exe_test_file_open_file_io_handle(
+int exe_test_file_open_mmap(
      const system_character_t *source )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libexe_file_t *file              = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error  = NULL;
+	libexe_file_t *file       = NULL;
+	libexe_section_t *section = NULL;
+	const uint8_t *data       = NULL;
+	size_t data_size          = 0;
+	ssize_t read_count        = 0;
+	int number_of_sections    = 0;
+	int result                = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
+	result = libexe_file_initialize(
+	          &file,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -800,29 +879,21 @@ int exe_test_file_open_file_io_handle(
 	 1 );
 
 	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	 "file",
+	 file );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
+	/* Test open
+	 */
+	result = libexe_file_open_mmap(
+	          file,
 	          source,
-	          string_length,
+	          LIBEXE_OPEN_READ | LIBEXE_ACCESS_FLAG_ADVISE_DATA_RANGES,
 	          &error );
-#endif
+
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -832,8 +903,9 @@ int exe_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libexe_file_initialize(
-	          &file,
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -841,73 +913,159 @@ int exe_test_file_open_file_io_handle(
 	 result,
 	 1 );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = libexe_file_open_file_io_handle(
-	          file,
-	          file_io_handle,
-	          LIBEXE_OPEN_READ,
-	          &error );
+	if( number_of_sections > 0 )
+	{
+		result = libexe_file_get_section_by_index(
+		          file,
+		          0,
+		          &section,
+		          &error );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
 
-	/* Test error cases
-	 */
-	result = libexe_file_open_file_io_handle(
-	          NULL,
-	          file_io_handle,
-	          LIBEXE_OPEN_READ,
-	          &error );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		/* Test if the section data pointer matches the section data
+		 */
+		result = libexe_section_get_data_pointer(
+		          section,
+		          &data,
+		          &data_size,
+		          &error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libexe_file_open_file_io_handle(
-	          file,
-	          NULL,
-	          LIBEXE_OPEN_READ,
-	          &error );
+		if( data_size > 0 )
+		{
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "data",
+			 data );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			if( data_size > 64 )
+			{
+				data_size = 64;
+			}
+			read_count = libexe_section_read_buffer_at_offset(
+			              section,
+			              buffer,
+			              data_size,
+			              0,
+			              &error );
+
+			EXE_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) data_size );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
 
-	libcerror_error_free(
-	 &error );
+			result = memory_compare(
+			          data,
+			          buffer,
+			          data_size );
 
-	result = libexe_file_open_file_io_handle(
-	          file,
-	          file_io_handle,
-	          -1,
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* Test error cases
+		 */
+		result = libexe_section_get_data_pointer(
+		          NULL,
+		          &data,
+		          &data_size,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libexe_section_get_data_pointer(
+		          section,
+		          NULL,
+		          &data_size,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libexe_section_get_data_pointer(
+		          section,
+		          &data,
+		          NULL,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libexe_section_free(
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_open_mmap(
+	          NULL,
+	          source,
+	          LIBEXE_OPEN_READ,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -922,11 +1080,9 @@ int exe_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Test open when already opened
-	 */
-	result = libexe_file_open_file_io_handle(
+	result = libexe_file_open_mmap(
 	          file,
-	          file_io_handle,
+	          source,
 	          LIBEXE_OPEN_READ,
 	          &error );
 
@@ -961,23 +1117,6 @@ int exe_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	EXE_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	EXE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -986,73 +1125,60 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
+	if( section != NULL )
 	{
-		libexe_file_free(
-		 &file,
+		libexe_section_free(
+		 &section,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
+	if( file != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libexe_file_free(
+		 &file,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libexe_file_close function
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Tests the libexe_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int exe_test_file_close(
-     void )
+int exe_test_file_open_memory(
+     libbfio_handle_t *file_io_handle )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	libexe_file_t *file       = NULL;
+	libexe_section_t *section = NULL;
+	const uint8_t *data       = NULL;
+	uint8_t *file_data        = NULL;
+	size64_t file_size        = 0;
+	size_t data_size          = 0;
+	ssize_t read_count        = 0;
+	int number_of_open_reads  = 0;
+	int number_of_sections    = 0;
+	int result                = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libexe_file_close(
-	          NULL,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
+	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libexe_file_open and libexe_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int exe_test_file_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error = NULL;
-	libexe_file_t *file      = NULL;
-	int result               = 0;
-
-	/* Initialize test
-	 */
-	result = libexe_file_initialize(
-	          &file,
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1060,67 +1186,76 @@ int exe_test_file_open_close(
 	 result,
 	 1 );
 
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE );
+
+	file_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
 	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+	 "file_data",
+	 file_data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_data,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libexe_file_open_wide(
-	          file,
-	          source,
-	          LIBEXE_OPEN_READ,
-	          &error );
-#else
-	result = libexe_file_open(
-	          file,
-	          source,
-	          LIBEXE_OPEN_READ,
+	result = libbfio_handle_close(
+	          file_io_handle,
 	          &error );
-#endif
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libexe_file_close(
-	          file,
+	result = libexe_file_initialize(
+	          &file,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libexe_file_open_wide(
-	          file,
-	          source,
-	          LIBEXE_OPEN_READ,
-	          &error );
-#else
-	result = libexe_file_open(
+	result = libexe_file_open_memory(
 	          file,
-	          source,
+	          file_data,
+	          (size_t) file_size,
 	          LIBEXE_OPEN_READ,
 	          &error );
-#endif
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1131,23 +1266,30 @@ int exe_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libexe_file_close(
+	/* The headers are parsed in place
+	 */
+	result = libexe_file_get_number_of_open_reads(
 	          file,
+	          &number_of_open_reads,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_reads",
+	 number_of_open_reads,
 	 0 );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libexe_file_free(
-	          &file,
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1155,59 +1297,109 @@ int exe_test_file_open_close(
 	 result,
 	 1 );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
-
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
+	if( number_of_sections > 0 )
 	{
-		libexe_file_free(
-		 &file,
-		 NULL );
+		result = libexe_file_get_section_by_index(
+		          file,
+		          0,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The section data points into the caller provided buffer
+		 */
+		result = libexe_section_get_data_pointer(
+		          section,
+		          &data,
+		          &data_size,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( data_size > 0 )
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "data in file data",
+			 (int) ( ( data >= file_data ) && ( ( data + data_size ) <= ( file_data + file_size ) ) ),
+			 1 );
+		}
+		result = libexe_section_free(
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 	}
-	return( 0 );
-}
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          (size_t) file_size,
+	          LIBEXE_OPEN_READ,
+	          &error );
 
-/* Tests the libexe_file_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int exe_test_file_signal_abort(
-     libexe_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test regular cases
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
 	 */
-	result = libexe_file_signal_abort(
+	result = libexe_file_close(
 	          file,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open with data that is too small, after which the file can be opened again
 	 */
-	result = libexe_file_signal_abort(
-	          NULL,
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          64,
+	          LIBEXE_OPEN_READ,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1222,153 +1414,114 @@ int exe_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          (size_t) file_size,
+	          LIBEXE_OPEN_READ,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libexe_file_get_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int exe_test_file_get_ascii_codepage(
-     libexe_file_t *file )
-{
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libexe_file_get_ascii_codepage(
+	result = libexe_file_close(
 	          file,
-	          &ascii_codepage,
 	          &error );
 
-	EXE_TEST_ASSERT_NOT_EQUAL_INT(
+	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
-
-	/* Test error cases
+	/* Test open with truncated section data, the section data pointer is
+	 * limited to the available data
 	 */
-	result = libexe_file_get_ascii_codepage(
-	          NULL,
-	          &ascii_codepage,
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          (size_t) file_size - 1,
+	          LIBEXE_OPEN_READ,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
+	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
+	          &error );
 
-	if( ascii_codepage_is_set != 0 )
-	{
-		result = libexe_file_get_ascii_codepage(
-		          file,
-		          NULL,
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sections > 0 )
+	{
+		result = libexe_file_get_section_by_index(
+		          file,
+		          number_of_sections - 1,
+		          &section,
 		          &error );
 
 		EXE_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
 		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libexe_file_set_ascii_codepage function
- * Returns 1 if successful or 0 if not
- */
-int exe_test_file_set_ascii_codepage(
-     libexe_file_t *file )
-{
-	int supported_codepages[ 15 ] = {
-		LIBEXE_CODEPAGE_ASCII,
-		LIBEXE_CODEPAGE_WINDOWS_874,
-		LIBEXE_CODEPAGE_WINDOWS_932,
-		LIBEXE_CODEPAGE_WINDOWS_936,
-		LIBEXE_CODEPAGE_WINDOWS_949,
-		LIBEXE_CODEPAGE_WINDOWS_950,
-		LIBEXE_CODEPAGE_WINDOWS_1250,
-		LIBEXE_CODEPAGE_WINDOWS_1251,
-		LIBEXE_CODEPAGE_WINDOWS_1252,
-		LIBEXE_CODEPAGE_WINDOWS_1253,
-		LIBEXE_CODEPAGE_WINDOWS_1254,
-		LIBEXE_CODEPAGE_WINDOWS_1255,
-		LIBEXE_CODEPAGE_WINDOWS_1256,
-		LIBEXE_CODEPAGE_WINDOWS_1257,
-		LIBEXE_CODEPAGE_WINDOWS_1258 };
-
-	int unsupported_codepages[ 17 ] = {
-		LIBEXE_CODEPAGE_ISO_8859_1,
-		LIBEXE_CODEPAGE_ISO_8859_2,
-		LIBEXE_CODEPAGE_ISO_8859_3,
-		LIBEXE_CODEPAGE_ISO_8859_4,
-		LIBEXE_CODEPAGE_ISO_8859_5,
-		LIBEXE_CODEPAGE_ISO_8859_6,
-		LIBEXE_CODEPAGE_ISO_8859_7,
-		LIBEXE_CODEPAGE_ISO_8859_8,
-		LIBEXE_CODEPAGE_ISO_8859_9,
-		LIBEXE_CODEPAGE_ISO_8859_10,
-		LIBEXE_CODEPAGE_ISO_8859_11,
-		LIBEXE_CODEPAGE_ISO_8859_13,
-		LIBEXE_CODEPAGE_ISO_8859_14,
-		LIBEXE_CODEPAGE_ISO_8859_15,
-		LIBEXE_CODEPAGE_ISO_8859_16,
-		LIBEXE_CODEPAGE_KOI8_R,
-		LIBEXE_CODEPAGE_KOI8_U };
+		result = libexe_section_get_data_pointer(
+		          section,
+		          &data,
+		          &data_size,
+		          &error );
 
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	/* Test set ASCII codepage
-	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
-	{
-		codepage = supported_codepages[ index ];
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-		result = libexe_file_set_ascii_codepage(
-		          file,
-		          codepage,
+		if( ( result == 1 )
+		 && ( data_size > 0 ) )
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "data in file data",
+			 (int) ( ( data >= file_data ) && ( ( data + data_size ) <= ( file_data + file_size - 1 ) ) ),
+			 1 );
+		}
+		result = libexe_section_free(
+		          &section,
 		          &error );
 
 		EXE_TEST_ASSERT_EQUAL_INT(
@@ -1380,11 +1533,26 @@ int exe_test_file_set_ascii_codepage(
 		 "error",
 		 error );
 	}
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libexe_file_set_ascii_codepage(
+	result = libexe_file_open_memory(
 	          NULL,
-	          LIBEXE_CODEPAGE_ASCII,
+	          file_data,
+	          (size_t) file_size,
+	          LIBEXE_OPEN_READ,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1399,34 +1567,67 @@ int exe_test_file_set_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+	result = libexe_file_open_memory(
+	          file,
+	          NULL,
+	          (size_t) file_size,
+	          LIBEXE_OPEN_READ,
+	          &error );
 
-		result = libexe_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		EXE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		EXE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          0,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_memory(
+	          file,
+	          file_data,
+	          (size_t) file_size,
+	          -1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
-	result = libexe_file_set_ascii_codepage(
-	          file,
-	          LIBEXE_CODEPAGE_WINDOWS_1252,
+	result = libexe_file_free(
+	          &file,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1434,10 +1635,17 @@ int exe_test_file_set_ascii_codepage(
 	 result,
 	 1 );
 
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	memory_free(
+	 file_data );
+
 	return( 1 );
 
 on_error:
@@ -1446,24 +1654,46 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_data != NULL )
+	{
+		memory_free(
+		 file_data );
+	}
+	libbfio_handle_close(
+	 file_io_handle,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libexe_file_get_number_of_sections function
+/* Tests the libexe_file_open_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int exe_test_file_get_number_of_sections(
-     libexe_file_t *file )
+int exe_test_file_open_file_io_handle(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_sections   = 0;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_file_t *file              = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libexe_file_get_number_of_sections(
-	          file,
-	          &number_of_sections,
+	result = libbfio_file_initialize(
+	          &file_io_handle,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1471,15 +1701,4657 @@ int exe_test_file_get_number_of_sections(
 	 result,
 	 1 );
 
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libexe_file_get_number_of_sections(
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libexe_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_file_io_handle(
+	          file,
+	          NULL,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libexe_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_reset and libexe_file_reopen_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_reset(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_file_t *file              = NULL;
+	libexe_section_t *section        = NULL;
+	size_t string_length             = 0;
+	int number_of_sections           = 0;
+	int open_index                   = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_file_reset(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file is reset by a reopen and opened again with the same file IO handle
+	 */
+	for( open_index = 0;
+	     open_index < 3;
+	     open_index++ )
+	{
+		result = libexe_file_reopen_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBEXE_OPEN_READ,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_number_of_sections(
+		          file,
+		          &number_of_sections,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_sections > 0 )
+		{
+			result = libexe_file_borrow_section_by_index(
+			          file,
+			          0,
+			          &section,
+			          &error );
+
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "section",
+			 section );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libexe_file_reset(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_reset(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_reopen_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_reopen_file_io_handle(
+	          file,
+	          NULL,
+	          LIBEXE_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Checks that the section data of a stream is passed in order
+ * Callback function for libexe_file_open_stream_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_file_open_stream_callback(
+     int section_index,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data )
+{
+	exe_test_file_stream_values_t *stream_values = NULL;
+
+	if( ( data == NULL )
+	 || ( data_size == 0 )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	stream_values = (exe_test_file_stream_values_t *) callback_data;
+
+	if( section_index != stream_values->section_index )
+	{
+		stream_values->section_index    = section_index;
+		stream_values->next_data_offset = 0;
+	}
+	if( data_offset != stream_values->next_data_offset )
+	{
+		return( -1 );
+	}
+	stream_values->next_data_offset += (off64_t) data_size;
+	stream_values->data_size        += (size64_t) data_size;
+
+	return( 1 );
+}
+
+/* Tests the libexe_file_open_stream_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_stream_file_io_handle(
+     const system_character_t *source )
+{
+	exe_test_file_stream_values_t stream_values;
+
+	libbfio_handle_t *file_io_handle   = NULL;
+	libbfio_handle_t *stream_io_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	libexe_file_t *file                = NULL;
+	libexe_section_t *section          = NULL;
+	uint8_t *file_data                 = NULL;
+	size64_t file_size                 = 0;
+	size64_t section_size              = 0;
+	size64_t sections_data_size        = 0;
+	size_t string_length               = 0;
+	ssize_t read_count                 = 0;
+	int number_of_sections             = 0;
+	int result                         = 0;
+	int section_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	stream_values.section_index    = -1;
+	stream_values.next_data_offset = 0;
+	stream_values.data_size        = 0;
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The section data passed to the callback function should match the section sizes
+	 */
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_by_index(
+		          file,
+		          section_index,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_section_get_size(
+		          section,
+		          &section_size,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sections_data_size += section_size;
+
+		result = libexe_section_free(
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_values.data_size",
+	 (uint64_t) stream_values.data_size,
+	 (uint64_t) sections_data_size );
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a callback function that fails, after which the file can be opened again
+	 */
+	if( number_of_sections > 0 )
+	{
+		result = libexe_file_open_stream_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBEXE_OPEN_READ,
+		          &exe_test_file_open_stream_callback,
+		          NULL,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	stream_values.section_index    = -1;
+	stream_values.next_data_offset = 0;
+	stream_values.data_size        = 0;
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "stream_values.data_size",
+	 (uint64_t) stream_values.data_size,
+	 (uint64_t) sections_data_size );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a stream that ends before the end of the section data,
+	 * the available section data is passed to the callback function
+	 */
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE );
+
+	file_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_data",
+	 file_data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_data,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_open_file_io_handle(
+	          &stream_io_handle,
+	          file_data,
+	          (size_t) file_size - 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_io_handle",
+	 stream_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream_values.section_index    = -1;
+	stream_values.next_data_offset = 0;
+	stream_values.data_size        = 0;
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          stream_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_LESS_THAN_UINT64(
+	 "stream_values.data_size",
+	 (uint64_t) stream_values.data_size,
+	 (uint64_t) sections_data_size + 1 );
+
+	EXE_TEST_ASSERT_LESS_THAN_UINT64(
+	 "sections_data_size",
+	 (uint64_t) sections_data_size,
+	 (uint64_t) stream_values.data_size + 2 );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_close_file_io_handle(
+	          &stream_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 file_data );
+
+	file_data = NULL;
+
+	/* Test error cases
+	 */
+	result = libexe_file_open_stream_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          NULL,
+	          LIBEXE_OPEN_READ,
+	          &exe_test_file_open_stream_callback,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_open_stream_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          NULL,
+	          (void *) &stream_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( stream_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &stream_io_handle,
+		 NULL );
+	}
+	if( file_data != NULL )
+	{
+		memory_free(
+		 file_data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_file_close(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_open and libexe_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libexe_file_open_wide(
+	          file,
+	          source,
+	          LIBEXE_OPEN_READ,
+	          &error );
+#else
+	result = libexe_file_open(
+	          file,
+	          source,
+	          LIBEXE_OPEN_READ,
+	          &error );
+#endif
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libexe_file_open_wide(
+	          file,
+	          source,
+	          LIBEXE_OPEN_READ,
+	          &error );
+#else
+	result = libexe_file_open(
+	          file,
+	          source,
+	          LIBEXE_OPEN_READ,
+	          &error );
+#endif
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_signal_abort(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_signal_abort(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_signal_abort(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_ascii_codepage(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	EXE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( ascii_codepage_is_set != 0 )
+	{
+		result = libexe_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_set_ascii_codepage(
+     libexe_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBEXE_CODEPAGE_ASCII,
+		LIBEXE_CODEPAGE_WINDOWS_874,
+		LIBEXE_CODEPAGE_WINDOWS_932,
+		LIBEXE_CODEPAGE_WINDOWS_936,
+		LIBEXE_CODEPAGE_WINDOWS_949,
+		LIBEXE_CODEPAGE_WINDOWS_950,
+		LIBEXE_CODEPAGE_WINDOWS_1250,
+		LIBEXE_CODEPAGE_WINDOWS_1251,
+		LIBEXE_CODEPAGE_WINDOWS_1252,
+		LIBEXE_CODEPAGE_WINDOWS_1253,
+		LIBEXE_CODEPAGE_WINDOWS_1254,
+		LIBEXE_CODEPAGE_WINDOWS_1255,
+		LIBEXE_CODEPAGE_WINDOWS_1256,
+		LIBEXE_CODEPAGE_WINDOWS_1257,
+		LIBEXE_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBEXE_CODEPAGE_ISO_8859_1,
+		LIBEXE_CODEPAGE_ISO_8859_2,
+		LIBEXE_CODEPAGE_ISO_8859_3,
+		LIBEXE_CODEPAGE_ISO_8859_4,
+		LIBEXE_CODEPAGE_ISO_8859_5,
+		LIBEXE_CODEPAGE_ISO_8859_6,
+		LIBEXE_CODEPAGE_ISO_8859_7,
+		LIBEXE_CODEPAGE_ISO_8859_8,
+		LIBEXE_CODEPAGE_ISO_8859_9,
+		LIBEXE_CODEPAGE_ISO_8859_10,
+		LIBEXE_CODEPAGE_ISO_8859_11,
+		LIBEXE_CODEPAGE_ISO_8859_13,
+		LIBEXE_CODEPAGE_ISO_8859_14,
+		LIBEXE_CODEPAGE_ISO_8859_15,
+		LIBEXE_CODEPAGE_ISO_8859_16,
+		LIBEXE_CODEPAGE_KOI8_R,
+		LIBEXE_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libexe_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_set_ascii_codepage(
+	          NULL,
+	          LIBEXE_CODEPAGE_ASCII,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libexe_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libexe_file_set_ascii_codepage(
+	          file,
+	          LIBEXE_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_number_of_open_reads function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_number_of_open_reads(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_reads      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_open_reads(
+	          file,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_open_reads(
+	          NULL,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_open_reads(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_internal_file_get_import_table function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_internal_file_get_import_table(
+     libexe_file_t *file )
+{
+	libexe_data_directory_descriptor_t delay_import_data_directory;
+
+	libcerror_error_t *error                             = NULL;
+	libexe_data_directory_descriptor_t *data_directories = NULL;
+	libexe_import_table_t *cached_table                  = NULL;
+	libexe_import_table_t *import_table                  = NULL;
+	libexe_internal_file_t *internal_file                = NULL;
+	int number_of_reads                                  = 0;
+	int result                                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_internal_file_get_import_table(
+	          (libexe_internal_file_t *) file,
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "import_table",
+		 import_table );
+
+		number_of_reads = ( (libexe_internal_file_t *) file )->io_handle->number_of_reads;
+
+		/* Test if the import table is read only once
+		 */
+		result = libexe_internal_file_get_import_table(
+		          (libexe_internal_file_t *) file,
+		          &cached_table,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "cached_table",
+		 cached_table );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_reads",
+		 ( (libexe_internal_file_t *) file )->io_handle->number_of_reads,
+		 number_of_reads );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test if a delay-load import table that cannot be resolved is ignored
+	 */
+	internal_file    = (libexe_internal_file_t *) file;
+	data_directories = internal_file->io_handle->coff_optional_header->data_directories;
+
+	if( data_directories[ LIBEXE_DATA_DIRECTORY_IMPORT_TABLE ].size != 0 )
+	{
+		delay_import_data_directory = data_directories[ LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR ];
+
+		data_directories[ LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR ].virtual_address = 0xfffff000UL;
+		data_directories[ LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR ].size            = 64;
+
+		result = libexe_import_table_free(
+		          &( internal_file->import_table ),
+		          &error );
+
+		internal_file->import_table_is_read = 0;
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libexe_internal_file_get_import_table(
+		          internal_file,
+		          &import_table,
+		          &error );
+
+		data_directories[ LIBEXE_DATA_DIRECTORY_DELAY_IMPORT_DESCRIPTOR ] = delay_import_data_directory;
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read the import table again with the original delay-load import table
+		 */
+		result = libexe_import_table_free(
+		          &( internal_file->import_table ),
+		          &error );
+
+		internal_file->import_table_is_read = 0;
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libexe_internal_file_get_import_table(
+	          NULL,
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_internal_file_get_import_table(
+	          (libexe_internal_file_t *) file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests opening a file with the headers only access flag
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_open_headers_only(
+     const system_character_t *source )
+{
+	libcerror_error_t *error            = NULL;
+	libexe_file_t *file                 = NULL;
+	libexe_import_table_t *import_table = NULL;
+	int number_of_sections              = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with headers only
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libexe_file_open_wide(
+	          file,
+	          source,
+	          LIBEXE_OPEN_HEADERS_ONLY,
+	          &error );
+#else
+	result = libexe_file_open(
+	          file,
+	          source,
+	          LIBEXE_OPEN_HEADERS_ONLY,
+	          &error );
+#endif
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data directories are not available when only the headers are read
+	 */
+	result = libexe_internal_file_get_import_table(
+	          (libexe_internal_file_t *) file,
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "import_table",
+	 import_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_close(
+	          file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* Tests the libexe_file_get_arena_size and libexe_file_set_arena_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_set_arena_size(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libexe_file_t *file      = NULL;
+	size_t arena_size        = 0;
+	int number_of_sections   = 0;
+	int open_index           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_arena_size(
+	          file,
+	          &arena_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "arena_size",
+	 arena_size,
+	 (size_t) 0 );
+
+	result = libexe_file_set_arena_size(
+	          file,
+	          LIBEXE_DEFAULT_ARENA_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_arena_size(
+	          file,
+	          &arena_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "arena_size",
+	 arena_size,
+	 (size_t) LIBEXE_DEFAULT_ARENA_SIZE );
+
+	/* The arena is reset and reused when the file is closed and opened again
+	 */
+	for( open_index = 0;
+	     open_index < 2;
+	     open_index++ )
+	{
+	#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libexe_file_open_wide(
+		          file,
+		          source,
+		          LIBEXE_OPEN_READ,
+		          &error );
+	#else
+		result = libexe_file_open(
+		          file,
+		          source,
+		          LIBEXE_OPEN_READ,
+		          &error );
+	#endif
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_number_of_sections(
+		          file,
+		          &number_of_sections,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The arena size cannot be changed while the file is open
+		 */
+		result = libexe_file_set_arena_size(
+		          file,
+		          0,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libexe_file_close(
+		          file,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libexe_file_set_arena_size(
+	          file,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_arena_size(
+	          file,
+	          &arena_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "arena_size",
+	 arena_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_arena_size(
+	          NULL,
+	          &arena_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_arena_size(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_arena_size(
+	          NULL,
+	          LIBEXE_DEFAULT_ARENA_SIZE,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_set_arena_size(
+	          file,
+	          (size_t) LIBEXE_MAXIMUM_ARENA_SIZE + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_offset_by_rva function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_offset_by_rva(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	off64_t offset            = 0;
+	off64_t start_offset      = 0;
+	size64_t section_size     = 0;
+	uint32_t virtual_address  = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_get_section_by_index(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_virtual_address(
+	          section,
+	          &virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_start_offset(
+	          section,
+	          &start_offset,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_size(
+	          section,
+	          &section_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_free(
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( section_size > 0 )
+	{
+		result = libexe_file_get_offset_by_rva(
+		          file,
+		          virtual_address,
+		          &offset,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) start_offset );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_get_offset_by_rva(
+	          NULL,
+	          virtual_address,
+	          &offset,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_offset_by_rva(
+	          file,
+	          virtual_address,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_translate_rvas function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_translate_rvas(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	off64_t expected_offset   = 0;
+	off64_t offsets[ 5 ];
+	uint32_t rvas[ 5 ];
+	uint32_t virtual_address  = 0;
+	uint8_t status[ 5 ];
+	int expected_result       = 0;
+	int result                = 0;
+	int test_index            = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_get_section_by_index(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_virtual_address(
+	          section,
+	          &virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_free(
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rvas[ 0 ] = 0;
+	rvas[ 1 ] = virtual_address;
+	rvas[ 2 ] = virtual_address + 16;
+	rvas[ 3 ] = virtual_address - 1;
+	rvas[ 4 ] = 0xffffffffUL;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_translate_rvas(
+	          file,
+	          rvas,
+	          5,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_index = 0;
+	     test_index < 5;
+	     test_index++ )
+	{
+		expected_result = libexe_file_get_offset_by_rva(
+		                   file,
+		                   rvas[ test_index ],
+		                   &expected_offset,
+		                   &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "expected_result",
+		 expected_result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "status",
+		 (int) status[ test_index ],
+		 expected_result );
+
+		EXE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offsets[ test_index ],
+		 (int64_t) expected_offset );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_translate_rvas(
+	          NULL,
+	          rvas,
+	          5,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_translate_rvas(
+	          file,
+	          NULL,
+	          5,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_translate_rvas(
+	          file,
+	          rvas,
+	          5,
+	          NULL,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_read_ranges(
+     libexe_file_t *file )
+{
+	uint8_t first_data[ 64 ];
+	uint8_t second_data[ 64 ];
+
+	libexe_range_t ranges[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	ranges[ 0 ].offset = 64;
+	ranges[ 0 ].size   = 64;
+	ranges[ 0 ].data   = second_data;
+
+	ranges[ 1 ].offset = 0;
+	ranges[ 1 ].size   = 64;
+	ranges[ 1 ].data   = first_data;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_read_ranges(
+	          file,
+	          ranges,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "first_data[ 0 ]",
+	 first_data[ 0 ],
+	 (uint8_t) 'M' );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "first_data[ 1 ]",
+	 first_data[ 1 ],
+	 (uint8_t) 'Z' );
+
+	/* Test error cases
+	 */
+	result = libexe_file_read_ranges(
+	          NULL,
+	          ranges,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_read_ranges(
+	          file,
+	          NULL,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_number_of_sections function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_number_of_sections(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_sections   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_sections(
+	          NULL,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_number_of_exports and related export functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_exports(
+     libexe_file_t *file )
+{
+	char name[ 256 ];
+
+	libcerror_error_t *error          = NULL;
+	size_t name_size                  = 0;
+	uint32_t lookup_ordinal           = 0;
+	uint32_t lookup_rva               = 0;
+	uint32_t ordinal                  = 0;
+	uint32_t relative_virtual_address = 0;
+	int export_index                  = 0;
+	int number_of_exports             = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_exports(
+	          file,
+	          &number_of_exports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( export_index = 0;
+	     export_index < number_of_exports;
+	     export_index++ )
+	{
+		result = libexe_file_get_export_by_index(
+		          file,
+		          export_index,
+		          &ordinal,
+		          &relative_virtual_address,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( relative_virtual_address != 0 )
+		{
+			result = libexe_file_get_export_by_ordinal(
+			          file,
+			          ordinal,
+			          &lookup_rva,
+			          &error );
+
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			EXE_TEST_ASSERT_EQUAL_UINT32(
+			 "lookup_rva",
+			 lookup_rva,
+			 relative_virtual_address );
+		}
+		result = libexe_file_get_export_name_size(
+		          file,
+		          export_index,
+		          &name_size,
+		          &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result == 0 )
+		 || ( name_size > 256 ) )
+		{
+			continue;
+		}
+		result = libexe_file_get_export_name(
+		          file,
+		          export_index,
+		          name,
+		          256,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_export_by_name(
+		          file,
+		          name,
+		          name_size - 1,
+		          &lookup_ordinal,
+		          &lookup_rva,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_UINT32(
+		 "lookup_rva",
+		 lookup_rva,
+		 relative_virtual_address );
+	}
+	result = libexe_file_get_export_by_name(
+	          file,
+	          "libexe test non-existing export",
+	          31,
+	          &lookup_ordinal,
+	          &lookup_rva,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_exports(
+	          NULL,
+	          &number_of_exports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_exports(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_export_by_index(
+	          file,
+	          number_of_exports,
+	          &ordinal,
+	          &relative_virtual_address,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_export_by_ordinal(
+	          file,
+	          1,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_number_of_imports and related import functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_imports(
+     libexe_file_t *file )
+{
+	char name[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t name_size         = 0;
+	uint16_t ordinal         = 0;
+	uint8_t flags            = 0;
+	int first_import_index   = 0;
+	int import_index         = 0;
+	int module_index         = 0;
+	int number_of_imports    = 0;
+	int number_of_modules    = 0;
+	int result               = 0;
+	int total_imports        = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_import_modules(
+	          file,
+	          &number_of_modules,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		result = libexe_file_get_import_module_by_index(
+		          file,
+		          module_index,
+		          &first_import_index,
+		          &number_of_imports,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_import_module_name_size(
+		          file,
+		          module_index,
+		          &name_size,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "name_size",
+		 (ssize_t) name_size,
+		 (ssize_t) 0 );
+
+		if( name_size <= 256 )
+		{
+			result = libexe_file_get_import_module_name(
+			          file,
+			          module_index,
+			          name,
+			          256,
+			          &error );
+
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "name[ name_size - 1 ]",
+			 (int) name[ name_size - 1 ],
+			 0 );
+		}
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "first_import_index",
+		 first_import_index,
+		 total_imports );
+
+		total_imports += number_of_imports;
+	}
+	result = libexe_file_get_number_of_imports(
+	          file,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_imports",
+	 number_of_imports,
+	 total_imports );
+
+	for( import_index = 0;
+	     import_index < number_of_imports;
+	     import_index++ )
+	{
+		result = libexe_file_get_import_by_index(
+		          file,
+		          import_index,
+		          &module_index,
+		          &ordinal,
+		          &flags,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_import_name_size(
+		          file,
+		          import_index,
+		          &name_size,
+		          &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( flags & LIBEXE_IMPORT_FLAG_BY_ORDINAL ) == 0 )
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		if( ( result == 1 )
+		 && ( name_size <= 256 ) )
+		{
+			result = libexe_file_get_import_name(
+			          file,
+			          import_index,
+			          name,
+			          256,
+			          &error );
+
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_get_number_of_imports(
+	          NULL,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_imports(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_import_modules(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_module_by_index(
+	          file,
+	          number_of_modules,
+	          &first_import_index,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_by_index(
+	          file,
+	          -1,
+	          &module_index,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_module_name_size(
+	          file,
+	          number_of_modules,
+	          &name_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_module_name(
+	          file,
+	          number_of_modules,
+	          name,
+	          256,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_name_size(
+	          file,
+	          -1,
+	          &name_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_name(
+	          file,
+	          -1,
+	          name,
+	          256,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_import_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_import_hash(
+     libexe_file_t *file )
+{
+	uint8_t import_hash[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_imports    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_number_of_imports(
+	          file,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_import_hash(
+	          file,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_imports == 0 )
+	{
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_get_import_hash(
+	          NULL,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_hash(
+	          file,
+	          NULL,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_import_hash(
+	          file,
+	          import_hash,
+	          15,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	result = libexe_section_free(
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section(
+	          NULL,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section(
+	          file,
+	          -1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_by_index(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_file_get_section_by_index(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	result = libexe_section_free(
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_by_index(
+	          NULL,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_index(
+	          file,
+	          -1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_get_section_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_get_section_by_name(
+     libexe_file_t *file )
+{
+	char name[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	size_t name_length        = 0;
+	int number_of_sections    = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_get_section_by_index(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_name(
+	          section,
+	          name,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_free(
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name_length = narrow_string_length(
+	               name );
+
+	/* Test regular cases
+	 */
+	if( name_length > 0 )
+	{
+		result = libexe_file_get_section_by_name(
+		          file,
+		          name,
+		          name_length,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_section_free(
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_number_of_sections_by_name(
+		          file,
+		          name,
+		          name_length,
+		          &number_of_sections,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "number_of_sections",
+		 number_of_sections,
+		 0 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_section_by_name_and_index(
+		          file,
+		          name,
+		          name_length,
+		          number_of_sections - 1,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_section_free(
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_section_by_name_and_index(
+		          file,
+		          name,
+		          name_length,
+		          number_of_sections,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libexe_file_get_section_by_name(
+	          file,
+	          "bogus",
+	          5,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_get_section_by_name(
+	          NULL,
+	          name,
+	          name_length,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_name(
+	          file,
+	          NULL,
+	          name_length,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_name(
+	          file,
+	          name,
+	          (size_t) SSIZE_MAX + 1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_name(
+	          file,
+	          name,
+	          name_length,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_number_of_sections_by_name(
+	          file,
+	          name,
+	          name_length,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_section_by_name_and_index(
+	          file,
+	          name,
+	          name_length,
+	          -1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section != NULL )
+	{
+		libexe_section_free(
+		 &section,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_borrow_section_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_borrow_section_by_index(
+     libexe_file_t *file )
+{
+	libcerror_error_t *error           = NULL;
+	libexe_section_t *borrowed_section = NULL;
+	libexe_section_t *section          = NULL;
+	int number_of_sections             = 0;
+	int result                         = 0;
+	int section_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_get_number_of_sections(
+	          file,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		result = libexe_file_borrow_section_by_index(
+		          file,
+		          section_index,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "section",
+		 section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( number_of_sections > 0 )
+	{
+		result = libexe_file_borrow_section_by_index(
+		          file,
+		          0,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The same section is returned every time
+		 */
+		result = libexe_file_borrow_section_by_index(
+		          file,
+		          0,
+		          &borrowed_section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "borrowed_section == section",
+		 (int) ( borrowed_section == section ),
+		 1 );
+
+		/* Freeing a borrowed section only clears the reference
+		 */
+		result = libexe_section_free(
+		          &borrowed_section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "borrowed_section",
+		 borrowed_section );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_borrow_section_by_index(
+		          file,
+		          0,
+		          &borrowed_section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "borrowed_section == section",
+		 (int) ( borrowed_section == section ),
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libexe_file_borrow_section_by_index(
+	          NULL,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_index(
+	          file,
+	          -1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_index(
+	          file,
+	          number_of_sections,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_borrow_section_by_name function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_borrow_section_by_name(
+     libexe_file_t *file )
+{
+	char name[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libexe_section_t *borrowed_section = NULL;
+	libexe_section_t *section          = NULL;
+	size_t name_length                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_borrow_section_by_index(
+	          file,
+	          0,
+	          &borrowed_section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_get_name(
+	          borrowed_section,
+	          name,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name_length = narrow_string_length(
+	               name );
+
+	/* Test regular cases
+	 */
+	if( name_length > 0 )
+	{
+		result = libexe_file_borrow_section_by_name(
+		          file,
+		          name,
+		          name_length,
+		          &section,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The first section with the name is section 0
+		 */
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "borrowed_section == section",
+		 (int) ( borrowed_section == section ),
+		 1 );
+	}
+	section = NULL;
+
+	result = libexe_file_borrow_section_by_name(
+	          file,
+	          "bogus",
+	          5,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section",
+	 section );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_borrow_section_by_name(
+	          NULL,
+	          name,
+	          name_length,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_name(
+	          file,
+	          NULL,
+	          name_length,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_name(
+	          file,
+	          name,
+	          (size_t) SSIZE_MAX + 1,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_borrow_section_by_name(
+	          file,
+	          name,
+	          name_length,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_file_set_cache_size, libexe_file_get_cache_size and libexe_file_get_cache_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_set_cache_size(
+     libexe_file_t *file )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	libexe_section_t *section        = NULL;
+	size64_t cache_size              = 0;
+	size64_t original_cache_size     = 0;
+	ssize_t read_count               = 0;
+	uint64_t number_of_hits          = 0;
+	uint64_t number_of_misses        = 0;
+	uint64_t previous_number_of_hits = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_get_cache_size(
+	          file,
+	          &original_cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_file_set_cache_size(
+	          file,
+	          65536,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_cache_size(
+	          file,
+	          &cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_size",
+	 (uint64_t) cache_size,
+	 (uint64_t) 65536 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_borrow_section_by_index(
+	          file,
+	          0,
+	          &section,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              data,
+	              64,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_get_cache_statistics(
+	          file,
+	          &previous_number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reading the same data again is served from the block cache
+	 */
+	if( read_count > 0 )
+	{
+		read_count = libexe_section_read_buffer_at_offset(
+		              section,
+		              data,
+		              64,
+		              0,
+		              &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_file_get_cache_statistics(
+		          file,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_hits",
+		 number_of_hits,
+		 previous_number_of_hits + 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libexe_file_set_cache_size(
+	          file,
+	          original_cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_file_set_cache_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_cache_size(
+	          NULL,
+	          &cache_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_cache_size(
+	          file,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_file_get_cache_statistics(
 	          NULL,
-	          &number_of_sections,
+	          &number_of_hits,
+	          &number_of_misses,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1494,9 +6366,10 @@ int exe_test_file_get_number_of_sections(
 	libcerror_error_free(
 	 &error );
 
-	result = libexe_file_get_number_of_sections(
+	result = libexe_file_get_cache_statistics(
 	          file,
 	          NULL,
+	          &number_of_misses,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1522,19 +6395,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libexe_file_get_section function
+/* Tests the libexe_section_read_buffer_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int exe_test_file_get_section(
+int exe_test_file_read_section_buffer_at_offset(
      libexe_file_t *file )
 {
+	uint8_t expected_data[ 64 ];
+	uint8_t data[ 64 ];
+
 	libcerror_error_t *error  = NULL;
 	libexe_section_t *section = NULL;
+	size64_t section_size     = 0;
+	ssize_t expected_count    = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
 	int result                = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libexe_file_get_section(
+	result = libexe_file_borrow_section_by_index(
 	          file,
 	          0,
 	          &section,
@@ -1549,12 +6429,9 @@ int exe_test_file_get_section(
 	 "error",
 	 error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "section",
-	 section );
-
-	result = libexe_section_free(
-	          &section,
+	result = libexe_section_get_size(
+	          section,
+	          &section_size,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1566,22 +6443,135 @@ int exe_test_file_get_section(
 	 "error",
 	 error );
 
-	/* Test error cases
+	if( section_size < 80 )
+	{
+		return( 1 );
+	}
+	offset = libexe_section_seek_offset(
+	          section,
+	          16,
+	          SEEK_SET,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_count = libexe_section_read_buffer(
+	                  section,
+	                  expected_data,
+	                  64,
+	                  &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "expected_count",
+	 expected_count,
+	 (ssize_t) 64 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libexe_section_seek_offset(
+	          section,
+	          3,
+	          SEEK_SET,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 3 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libexe_file_get_section(
-	          NULL,
-	          0,
-	          &section,
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              data,
+	              64,
+	              16,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          64 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The current offset is not changed by a read at a specific offset
+	 */
+	result = libexe_section_get_offset(
+	          section,
+	          &offset,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 3 );
 
 	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+	 "error",
+	 error );
+
+	/* Read buffer at the end of the section
+	 */
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              data,
+	              64,
+	              (off64_t) section_size,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libexe_section_read_buffer_at_offset(
+	              NULL,
+	              data,
+	              64,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	EXE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1590,20 +6580,36 @@ int exe_test_file_get_section(
 	libcerror_error_free(
 	 &error );
 
-	result = libexe_file_get_section(
-	          file,
-	          -1,
-	          &section,
-	          &error );
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              NULL,
+	              64,
+	              0,
+	              &error );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              data,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
 
 	EXE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1612,27 +6618,376 @@ int exe_test_file_get_section(
 	libcerror_error_free(
 	 &error );
 
-	result = libexe_file_get_section(
+	read_count = libexe_section_read_buffer_at_offset(
+	              section,
+	              data,
+	              64,
+	              -1,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests sequential libexe_section_read_buffer calls
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_file_read_section_buffer_sequential(
+     libexe_file_t *file )
+{
+	uint8_t expected_data[ 512 ];
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error  = NULL;
+	libexe_section_t *section = NULL;
+	size64_t section_size     = 0;
+	size_t read_size          = 0;
+	ssize_t expected_count    = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_file_borrow_section_by_index(
 	          file,
 	          0,
-	          NULL,
+	          &section,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+	 "error",
+	 error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
+	result = libexe_section_get_size(
+	          section,
+	          &section_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	offset = libexe_section_seek_offset(
+	          section,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Sequential reads that are smaller than the readahead window
+	 */
+	while( (size64_t) offset < section_size )
+	{
+		read_size = 512;
+
+		if( (size64_t) read_size > ( section_size - offset ) )
+		{
+			read_size = (size_t) ( section_size - offset );
+		}
+		read_count = libexe_section_read_buffer(
+		              section,
+		              data,
+		              read_size,
+		              &error );
+
+		EXE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_count = libexe_section_read_buffer_at_offset(
+		                  section,
+		                  expected_data,
+		                  read_size,
+		                  offset,
+		                  &error );
+
+		EXE_TEST_ASSERT_EQUAL_SSIZE(
+		 "expected_count",
+		 expected_count,
+		 (ssize_t) read_size );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          expected_data,
+		          read_size );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += (off64_t) read_size;
+	}
+	/* Non-sequential read after the sequential reads
+	 */
+	if( section_size >= 96 )
+	{
+		offset = libexe_section_seek_offset(
+		          section,
+		          32,
+		          SEEK_SET,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) 32 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libexe_section_read_buffer(
+		              section,
+		              data,
+		              64,
+		              &error );
+
+		EXE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 64 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_count = libexe_section_read_buffer_at_offset(
+		                  section,
+		                  expected_data,
+		                  64,
+		                  32,
+		                  &error );
+
+		EXE_TEST_ASSERT_EQUAL_SSIZE(
+		 "expected_count",
+		 expected_count,
+		 (ssize_t) 64 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          expected_data,
+		          64 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads sections of a file concurrently with other threads
+ * Callback function for libcthreads_thread_create
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_file_read_sections_thread_callback(
+     exe_test_file_thread_values_t *thread_values )
+{
+	uint8_t buffer[ EXE_TEST_FILE_THREAD_READ_SIZE ];
+
+	libcerror_error_t *error    = NULL;
+	libexe_section_t *section   = NULL;
+	size_t read_size            = 0;
+	ssize_t read_count          = 0;
+	off64_t offset              = 0;
+	off64_t section_offset      = 0;
+	uint32_t virtual_address    = 0;
+	int first_number_of_exports = 0;
+	int first_number_of_modules = 0;
+	int iteration               = 0;
+	int number_of_exports       = 0;
+	int number_of_modules       = 0;
+	int number_of_sections      = 0;
+	int result                  = 0;
+	int section_index           = 0;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	thread_values->result = -1;
+
+	for( iteration = 0;
+	     iteration < EXE_TEST_FILE_NUMBER_OF_THREAD_ITERATIONS;
+	     iteration++ )
+	{
+		section_index = ( thread_values->thread_index + iteration ) % thread_values->number_of_sections;
+
+		/* Alternate between borrowed sections, which are shared by all threads,
+		 * and sections created by this thread, which share the section descriptor
+		 */
+		if( ( iteration % 2 ) == 0 )
+		{
+			result = libexe_file_borrow_section_by_index(
+			          thread_values->file,
+			          section_index,
+			          &section,
+			          &error );
+		}
+		else
+		{
+			result = libexe_file_get_section_by_index(
+			          thread_values->file,
+			          section_index,
+			          &section,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		if( thread_values->section_data_sizes[ section_index ] > 0 )
+		{
+			section_offset = (off64_t) ( ( (size_t) iteration * 97 ) % thread_values->section_data_sizes[ section_index ] );
+			read_size      = thread_values->section_data_sizes[ section_index ] - (size_t) section_offset;
+
+			if( read_size > EXE_TEST_FILE_THREAD_READ_SIZE )
+			{
+				read_size = EXE_TEST_FILE_THREAD_READ_SIZE;
+			}
+			read_count = libexe_section_read_buffer_at_offset(
+			              section,
+			              buffer,
+			              read_size,
+			              section_offset,
+			              &error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				goto on_error;
+			}
+			if( memory_compare(
+			     buffer,
+			     &( ( thread_values->section_data[ section_index ] )[ section_offset ] ),
+			     read_size ) != 0 )
+			{
+				goto on_error;
+			}
+		}
+		if( libexe_section_get_virtual_address(
+		     section,
+		     &virtual_address,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libexe_section_free(
+		     &section,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libexe_file_get_offset_by_rva(
+		     thread_values->file,
+		     virtual_address,
+		     &offset,
+		     &error ) == -1 )
+		{
+			goto on_error;
+		}
+		if( libexe_file_get_number_of_sections(
+		     thread_values->file,
+		     &number_of_sections,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( number_of_sections != thread_values->number_of_sections )
+		{
+			goto on_error;
+		}
+		/* The export and import tables are read by the first thread that
+		 * needs them and are then shared by all threads
+		 */
+		if( libexe_file_get_number_of_exports(
+		     thread_values->file,
+		     &number_of_exports,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libexe_file_get_number_of_import_modules(
+		     thread_values->file,
+		     &number_of_modules,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			first_number_of_exports = number_of_exports;
+			first_number_of_modules = number_of_modules;
+		}
+		else if( ( number_of_exports != first_number_of_exports )
+		      || ( number_of_modules != first_number_of_modules ) )
+		{
+			goto on_error;
+		}
+	}
+	thread_values->result = 1;
 
 	return( 1 );
 
@@ -1648,25 +7003,38 @@ on_error:
 		 &section,
 		 NULL );
 	}
-	return( 0 );
+	return( -1 );
 }
 
-/* Tests the libexe_file_get_section_by_index function
+/* Tests reading the sections of a file from multiple threads
  * Returns 1 if successful or 0 if not
  */
-int exe_test_file_get_section_by_index(
+int exe_test_file_read_sections_multi_thread(
      libexe_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	libexe_section_t *section = NULL;
-	int result                = 0;
-
-	/* Test regular cases
-	 */
-	result = libexe_file_get_section_by_index(
+	exe_test_file_thread_values_t thread_values[ EXE_TEST_FILE_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ EXE_TEST_FILE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error    = NULL;
+	libexe_section_t *section   = NULL;
+	uint8_t **section_data      = NULL;
+	size_t *section_data_sizes  = NULL;
+	size64_t section_size       = 0;
+	ssize_t read_count          = 0;
+	int number_of_sections      = 0;
+	int result                  = 0;
+	int section_index           = 0;
+	int thread_index            = 0;
+
+	for( thread_index = 0;
+	     thread_index < EXE_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	result = libexe_file_get_number_of_sections(
 	          file,
-	          0,
-	          &section,
+	          &number_of_sections,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -1678,90 +7046,178 @@ int exe_test_file_get_section_by_index(
 	 "error",
 	 error );
 
+	if( number_of_sections == 0 )
+	{
+		return( 1 );
+	}
+	/* Read the reference section data using a single thread
+	 */
+	section_data = (uint8_t **) memory_allocate(
+	                             sizeof( uint8_t * ) * number_of_sections );
+
 	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "section",
-	 section );
+	 "section_data",
+	 section_data );
 
-	result = libexe_section_free(
-	          &section,
-	          &error );
+	section_data_sizes = (size_t *) memory_allocate(
+	                                 sizeof( size_t ) * number_of_sections );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section_data_sizes",
+	 section_data_sizes );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		section_data[ section_index ]       = NULL;
+		section_data_sizes[ section_index ] = 0;
+	}
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		result = libexe_file_get_section_by_index(
+		          file,
+		          section_index,
+		          &section,
+		          &error );
 
-	/* Test error cases
-	 */
-	result = libexe_file_get_section_by_index(
-	          NULL,
-	          0,
-	          &section,
-	          &error );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+		result = libexe_section_get_size(
+		          section,
+		          &section_size,
+		          &error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libexe_file_get_section_by_index(
-	          file,
-	          -1,
-	          &section,
-	          &error );
+		if( section_size > EXE_TEST_FILE_MAXIMUM_THREAD_SECTION_SIZE )
+		{
+			section_size = EXE_TEST_FILE_MAXIMUM_THREAD_SECTION_SIZE;
+		}
+		if( section_size > 0 )
+		{
+			section_data[ section_index ] = (uint8_t *) memory_allocate(
+			                                             sizeof( uint8_t ) * (size_t) section_size );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "section_data[ section_index ]",
+			 section_data[ section_index ] );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+			read_count = libexe_section_read_buffer_at_offset(
+			              section,
+			              section_data[ section_index ],
+			              (size_t) section_size,
+			              0,
+			              &error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			EXE_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) section_size );
 
-	libcerror_error_free(
-	 &error );
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		section_data_sizes[ section_index ] = (size_t) section_size;
 
-	result = libexe_file_get_section_by_index(
-	          file,
-	          0,
-	          NULL,
-	          &error );
+		result = libexe_section_free(
+		          &section,
+		          &error );
 
-	EXE_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "section",
-	 section );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < EXE_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].file               = file;
+		thread_values[ thread_index ].section_data       = section_data;
+		thread_values[ thread_index ].section_data_sizes = section_data_sizes;
+		thread_values[ thread_index ].number_of_sections = number_of_sections;
+		thread_values[ thread_index ].thread_index       = thread_index;
+		thread_values[ thread_index ].result             = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &exe_test_file_read_sections_thread_callback,
+		          (void *) &( thread_values[ thread_index ] ),
+		          &error );
 
-	EXE_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < EXE_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].result",
+		 thread_values[ thread_index ].result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	for( section_index = 0;
+	     section_index < number_of_sections;
+	     section_index++ )
+	{
+		if( section_data[ section_index ] != NULL )
+		{
+			memory_free(
+			 section_data[ section_index ] );
+		}
+	}
+	memory_free(
+	 section_data_sizes );
+
+	memory_free(
+	 section_data );
 
 	return( 1 );
 
@@ -1771,15 +7227,48 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( thread_index = 0;
+	     thread_index < EXE_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
 	if( section != NULL )
 	{
 		libexe_section_free(
 		 &section,
 		 NULL );
 	}
+	if( section_data != NULL )
+	{
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			if( section_data[ section_index ] != NULL )
+			{
+				memory_free(
+				 section_data[ section_index ] );
+			}
+		}
+		memory_free(
+		 section_data );
+	}
+	if( section_data_sizes != NULL )
+	{
+		memory_free(
+		 section_data_sizes );
+	}
 	return( 0 );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1911,20 +7400,58 @@ int main(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_open_mmap",
+		 exe_test_file_open_mmap,
+		 source );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_open_memory",
+		 exe_test_file_open_memory,
+		 file_io_handle );
+
 		EXE_TEST_RUN_WITH_ARGS(
 		 "libexe_file_open_file_io_handle",
 		 exe_test_file_open_file_io_handle,
 		 source );
 
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_open_stream_file_io_handle",
+		 exe_test_file_open_stream_file_io_handle,
+		 source );
+
 		EXE_TEST_RUN(
 		 "libexe_file_close",
 		 exe_test_file_close );
 
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_reset",
+		 exe_test_file_reset,
+		 source );
+
 		EXE_TEST_RUN_WITH_ARGS(
 		 "libexe_file_open_close",
 		 exe_test_file_open_close,
 		 source );
 
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_set_arena_size",
+		 exe_test_file_set_arena_size,
+		 source );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_open_headers_only",
+		 exe_test_file_open_headers_only,
+		 source );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
 		/* Initialize file for tests
 		 */
 		result = exe_test_file_open_source(
@@ -1966,10 +7493,45 @@ int main(
 		 exe_test_file_set_ascii_codepage,
 		 file );
 
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_number_of_open_reads",
+		 exe_test_file_get_number_of_open_reads,
+		 file );
+
 #if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
 
 		/* TODO: add tests for libexe_file_get_offset_by_relative_virtual_address */
 
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_offset_by_rva",
+		 exe_test_file_get_offset_by_rva,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_translate_rvas",
+		 exe_test_file_translate_rvas,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_read_ranges",
+		 exe_test_file_read_ranges,
+		 file );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+		/* TODO: add tests for libexe_internal_file_get_data_directory_range */
+
+		/* TODO: add tests for libexe_internal_file_get_export_table */
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_internal_file_get_import_table",
+		 exe_test_internal_file_get_import_table,
+		 file );
+
+		/* TODO: add tests for libexe_internal_file_get_debug_data */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
 		EXE_TEST_RUN_WITH_ARGS(
@@ -1982,12 +7544,64 @@ int main(
 		 exe_test_file_get_section,
 		 file );
 
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_exports",
+		 exe_test_file_get_exports,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_imports",
+		 exe_test_file_get_imports,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_import_hash",
+		 exe_test_file_get_import_hash,
+		 file );
+
 		EXE_TEST_RUN_WITH_ARGS(
 		 "libexe_file_get_section_by_index",
 		 exe_test_file_get_section_by_index,
 		 file );
 
-		/* TODO: add tests for libexe_file_get_section_by_name */
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_get_section_by_name",
+		 exe_test_file_get_section_by_name,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_borrow_section_by_index",
+		 exe_test_file_borrow_section_by_index,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_borrow_section_by_name",
+		 exe_test_file_borrow_section_by_name,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_section_read_buffer_at_offset",
+		 exe_test_file_read_section_buffer_at_offset,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_section_read_buffer_sequential",
+		 exe_test_file_read_section_buffer_sequential,
+		 file );
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_set_cache_size",
+		 exe_test_file_set_cache_size,
+		 file );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_file_read_sections_multi_thread",
+		 exe_test_file_read_sections_multi_thread,
+		 file );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 		/* Clean up
 		 */
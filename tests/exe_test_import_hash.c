@@ -0,0 +1,825 @@
+/*
+ * Library import hash functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_definitions.h"
+#include "../libexe/libexe_import_hash.h"
+#include "../libexe/libexe_import_table.h"
+#include "../libexe/libexe_md5.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_import_hash_update_lower_case function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_import_hash_update_lower_case(
+     void )
+{
+	uint8_t hash[ 16 ];
+
+	uint8_t expected_hash[ 16 ] = {
+		0x4b, 0xf4, 0xb3, 0xb2, 0xc2, 0x35, 0xc8, 0x67, 0x84, 0x26, 0x83, 0x35, 0x2a, 0x96, 0x59, 0xe1 };
+
+	libcerror_error_t *error          = NULL;
+	libexe_md5_context_t *md5_context = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_md5_initialize(
+	          &md5_context,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_import_hash_update_lower_case(
+	          md5_context,
+	          (uint8_t *) "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789[\\]^_`@{|}\x80\xc1.DLL",
+	          52,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_md5_finalize(
+	          md5_context,
+	          hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_hash,
+	          16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_import_hash_update_lower_case(
+	          md5_context,
+	          NULL,
+	          1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_md5_free(
+	          &md5_context,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( md5_context != NULL )
+	{
+		libexe_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_import_hash_get_module_name_length function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_import_hash_get_module_name_length(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	size_t hash_module_name_length = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 8 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "MyLib.OCX",
+	          9,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 5 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "driver.Sys",
+	          10,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 6 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "driver.txt.dll",
+	          14,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 10 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "module.exe",
+	          10,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 10 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "dll",
+	          3,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 3 );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) ".dll",
+	          4,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_module_name_length",
+	 hash_module_name_length,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_import_hash_get_module_name_length(
+	          NULL,
+	          12,
+	          &hash_module_name_length,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_hash_get_module_name_length(
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_import_hash_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_import_hash_calculate(
+     void )
+{
+	uint8_t import_hash[ 16 ];
+
+	uint8_t expected_import_hash[ 16 ] = {
+		0x08, 0xb3, 0x49, 0xe5, 0xd3, 0xae, 0x00, 0xe1, 0xab, 0xd7, 0x68, 0x38, 0x8f, 0x2a, 0xb4, 0xae };
+
+	libcerror_error_t *error            = NULL;
+	libexe_import_table_t *import_table = NULL;
+	int module_index                    = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_import_table_initialize(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an import table without imports
+	 */
+	result = libexe_import_hash_calculate(
+	          import_table,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an import table with only delay-loaded imports
+	 */
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "USER32.dll",
+	          10,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          (uint8_t *) "MessageBoxA",
+	          11,
+	          0,
+	          0,
+	          LIBEXE_IMPORT_FLAG_DELAY_LOAD,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_hash_calculate(
+	          import_table,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          (uint8_t *) "GetProcAddressForCaller",
+	          23,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          NULL,
+	          0,
+	          7,
+	          0,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "WS2_32.dll",
+	          10,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          NULL,
+	          0,
+	          115,
+	          0,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          NULL,
+	          0,
+	          999,
+	          0,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "MyLib.OCX",
+	          9,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          (uint8_t *) "ExitProcess",
+	          11,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An import with an empty name is not part of the import hash
+	 */
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          (uint8_t *) "",
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "driver.txt.dll",
+	          14,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          module_index,
+	          (uint8_t *) "DllMain",
+	          7,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_import_hash_calculate(
+	          import_table,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          import_hash,
+	          expected_import_hash,
+	          16 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_import_hash_calculate(
+	          NULL,
+	          import_hash,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_hash_calculate(
+	          import_table,
+	          NULL,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_hash_calculate(
+	          import_table,
+	          import_hash,
+	          15,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_import_table_free(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( import_table != NULL )
+	{
+		libexe_import_table_free(
+		 &import_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_import_hash_update_lower_case",
+	 exe_test_import_hash_update_lower_case );
+
+	EXE_TEST_RUN(
+	 "libexe_import_hash_get_module_name_length",
+	 exe_test_import_hash_get_module_name_length );
+
+	EXE_TEST_RUN(
+	 "libexe_import_hash_calculate",
+	 exe_test_import_hash_calculate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,7 @@
 #include "exe_test_memory.h"
 #include "exe_test_unused.h"
 
+#include "../libexe/libexe_definitions.h"
 #include "../libexe/libexe_import_table.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
@@ -304,8 +306,504 @@ int exe_test_import_table_read(
 	result = libexe_import_table_read(
 	          NULL,
 	          NULL,
+	          LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32,
 	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_read(
+	          import_table,
+	          NULL,
+	          LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_import_table_free(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "import_table",
+	 import_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( import_table != NULL )
+	{
+		libexe_import_table_free(
+		 &import_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_import_table_read_delay_imports function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_import_table_read_delay_imports(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libexe_import_table_t *import_table = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_import_table_initialize(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "import_table",
+	 import_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_import_table_read_delay_imports(
+	          NULL,
+	          NULL,
+	          LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_read_delay_imports(
+	          import_table,
+	          NULL,
+	          LIBEXE_COFF_OPTIONAL_HEADER_SIGNATURE_PE32,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_import_table_free(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "import_table",
+	 import_table );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( import_table != NULL )
+	{
+		libexe_import_table_free(
+		 &import_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_import_table_append_module, libexe_import_table_append_entry
+ * libexe_import_table_get_*_by_index and libexe_import_table_get_*_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_import_table_append(
+     void )
+{
+	char name_string[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libexe_import_table_t *import_table = NULL;
+	const char *name                    = NULL;
+	const char *second_name             = NULL;
+	size_t name_string_size             = 0;
+	uint16_t ordinal                    = 0;
+	uint8_t flags                       = 0;
+	int first_import_index              = 0;
+	int module_index                    = 0;
+	int number_of_entries               = 0;
+	int number_of_imports               = 0;
+	int number_of_modules               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_import_table_initialize(
+	          &import_table,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "module_index",
+	 module_index,
+	 0 );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          0,
+	          (uint8_t *) "GetProcAddress",
+	          14,
+	          5,
+	          0x00002000UL,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          0,
+	          NULL,
+	          0,
+	          23,
+	          0x00002004UL,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "USER32.dll",
+	          10,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          1,
+	          (uint8_t *) "GetProcAddress",
+	          14,
+	          7,
+	          0x00002010UL,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_get_number_of_modules(
+	          import_table,
+	          &number_of_modules,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 2 );
+
+	result = libexe_import_table_get_module_by_index(
+	          import_table,
+	          0,
+	          &name,
+	          &first_import_index,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "KERNEL32.dll",
+	          13 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "first_import_index",
+	 first_import_index,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_imports",
+	 number_of_imports,
+	 2 );
+
+	result = libexe_import_table_get_number_of_entries(
+	          import_table,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          0,
+	          &module_index,
+	          &name,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "module_index",
+	 module_index,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "ordinal",
+	 (int) ordinal,
+	 5 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "flags",
+	 (int) flags,
+	 0 );
+
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          1,
+	          &module_index,
+	          &second_name,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "second_name",
+	 second_name );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "ordinal",
+	 (int) ordinal,
+	 23 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "flags",
+	 (int) flags,
+	 LIBEXE_IMPORT_FLAG_BY_ORDINAL );
+
+	/* The same name imported from different modules is interned once
+	 */
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          2,
+	          &module_index,
+	          &second_name,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "module_index",
+	 module_index,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "second_name == name",
+	 (int) ( second_name == name ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_import_table_append_entry(
+	          import_table,
+	          2,
+	          NULL,
 	          0,
+	          1,
+	          0,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -320,11 +818,332 @@ int exe_test_import_table_read(
 	libcerror_error_free(
 	 &error );
 
-	result = libexe_import_table_read(
+	result = libexe_import_table_get_module_by_index(
+	          import_table,
+	          2,
+	          &name,
+	          &first_import_index,
+	          &number_of_imports,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          -1,
+	          &module_index,
+	          &name,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          0,
+	          &module_index,
+	          NULL,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the name of a function imported by ordinal from the ordinal names
+	 */
+	result = libexe_import_table_append_module(
+	          import_table,
+	          (uint8_t *) "WS2_32.dll",
+	          10,
+	          &module_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_append_entry(
 	          import_table,
+	          module_index,
 	          NULL,
 	          0,
+	          115,
+	          0x00002020UL,
+	          LIBEXE_IMPORT_FLAG_BY_ORDINAL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_get_entry_by_index(
+	          import_table,
+	          3,
+	          &module_index,
+	          &name,
+	          &ordinal,
+	          &flags,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "WSAStartup",
+	          11 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "ordinal",
+	 (int) ordinal,
+	 115 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "flags",
+	 (int) flags,
+	 LIBEXE_IMPORT_FLAG_BY_ORDINAL );
+
+	/* Test the copied module and entry names
+	 */
+	result = libexe_import_table_get_module_name_size(
+	          import_table,
+	          0,
+	          &name_string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "name_string_size",
+	 name_string_size,
+	 (size_t) 13 );
+
+	result = libexe_import_table_get_module_name(
+	          import_table,
+	          0,
+	          name_string,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name_string,
+	          "KERNEL32.dll",
+	          13 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_import_table_get_entry_name_size(
+	          import_table,
+	          3,
+	          &name_string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "name_string_size",
+	 name_string_size,
+	 (size_t) 11 );
+
+	result = libexe_import_table_get_entry_name(
+	          import_table,
+	          3,
+	          name_string,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name_string,
+	          "WSAStartup",
+	          11 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_import_table_get_entry_name_size(
+	          import_table,
+	          1,
+	          &name_string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_get_entry_name(
+	          import_table,
+	          1,
+	          name_string,
+	          16,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_import_table_get_module_name(
+	          import_table,
+	          0,
+	          name_string,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_get_entry_name(
+	          import_table,
 	          0,
+	          name_string,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_get_module_name_size(
+	          import_table,
+	          3,
+	          &name_string_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_import_table_get_entry_name_size(
+	          import_table,
+	          4,
+	          &name_string_size,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -350,10 +1169,6 @@ int exe_test_import_table_read(
 	 result,
 	 1 );
 
-	EXE_TEST_ASSERT_IS_NULL(
-	 "import_table",
-	 import_table );
-
 	EXE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -406,6 +1221,14 @@ int main(
 	 "libexe_import_table_read",
 	 exe_test_import_table_read );
 
+	EXE_TEST_RUN(
+	 "libexe_import_table_read_delay_imports",
+	 exe_test_import_table_read_delay_imports );
+
+	EXE_TEST_RUN(
+	 "libexe_import_table_append",
+	 exe_test_import_table_append );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
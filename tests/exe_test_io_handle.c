@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "exe_test_functions.h"
+#include "exe_test_libbfio.h"
 #include "exe_test_libcerror.h"
 #include "exe_test_libexe.h"
 #include "exe_test_macros.h"
@@ -34,9 +37,45 @@
 #include "exe_test_unused.h"
 
 #include "../libexe/libexe_io_handle.h"
+#include "../libexe/libexe_libcdata.h"
+#include "../libexe/libexe_section_descriptor.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
 
+uint8_t exe_test_io_handle_data1[ 512 ] = {
+	0x4d, 0x5a, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x45, 0x00, 0x00, 0x4c, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x01, 0x0b, 0x01, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x81,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60,
+	0x2e, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 /* Tests the libexe_io_handle_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -398,52 +437,933 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+/* Tests the libexe_io_handle_read_header_data function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_io_handle_read_header_data(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_io_handle_t *io_handle    = NULL;
+	int result                       = 0;
 
-/* The main program
+	/* Initialize test
+	 */
+	result = libexe_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          exe_test_io_handle_data1,
+	          512,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_io_handle_read_header_data(
+	          io_handle,
+	          file_io_handle,
+	          64,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The header data is read ahead up to the size of the file
+	 */
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->header_data_size",
+	 io_handle->header_data_size,
+	 (size_t) 512 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->number_of_reads",
+	 io_handle->number_of_reads,
+	 1 );
+
+	result = libexe_io_handle_read_header_data(
+	          io_handle,
+	          file_io_handle,
+	          512,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->number_of_reads",
+	 io_handle->number_of_reads,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_io_handle_read_header_data(
+	          NULL,
+	          file_io_handle,
+	          64,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_header_data(
+	          io_handle,
+	          file_io_handle,
+	          1024,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_header_data(
+	          io_handle,
+	          file_io_handle,
+	          (size_t) LIBEXE_MAXIMUM_HEADER_DATA_SIZE + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libexe_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_io_handle_read_file_header and libexe_io_handle_read_section_table functions
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc EXE_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc EXE_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
-#endif
+int exe_test_io_handle_read_file_header(
+     void )
 {
-	EXE_TEST_UNREFERENCED_PARAMETER( argc )
-	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcdata_array_t *sections_array = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_io_handle_t *io_handle    = NULL;
+	uint16_t number_of_sections      = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libexe_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	EXE_TEST_RUN(
-	 "libexe_io_handle_initialize",
-	 exe_test_io_handle_initialize );
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	EXE_TEST_RUN(
-	 "libexe_io_handle_free",
-	 exe_test_io_handle_free );
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	EXE_TEST_RUN(
-	 "libexe_io_handle_clear",
-	 exe_test_io_handle_clear );
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &sections_array,
+	          0,
+	          &error );
 
-	/* TODO: add tests for libexe_io_handle_read_file_header */
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libexe_io_handle_read_extended_header */
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "sections_array",
+	 sections_array );
 
-	/* TODO: add tests for libexe_io_handle_read_le_header */
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libexe_io_handle_read_ne_header */
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          exe_test_io_handle_data1,
+	          512,
+	          &error );
 
-	/* TODO: add tests for libexe_io_handle_read_pe_header */
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_io_handle_read_file_header(
+	          io_handle,
+	          file_io_handle,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->executable_type",
+	 io_handle->executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_PE_COFF );
+
+	EXE_TEST_ASSERT_EQUAL_UINT16(
+	 "number_of_sections",
+	 number_of_sections,
+	 2 );
 
-	/* TODO: add tests for libexe_io_handle_read_section_table */
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->section_table_offset",
+	 io_handle->section_table_offset,
+	 (size_t) 0x178 );
 
-	/* TODO: add tests for libexe_io_handle_read_segment_data */
+	result = libexe_io_handle_read_section_table(
+	          io_handle,
+	          file_io_handle,
+	          number_of_sections,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libexe_io_handle_seek_segment_offset */
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          sections_array,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* All the headers are read with a single read
+	 */
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->number_of_reads",
+	 io_handle->number_of_reads,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libexe_io_handle_read_file_header(
+	          NULL,
+	          file_io_handle,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_section_table(
+	          NULL,
+	          file_io_handle,
+	          number_of_sections,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libexe_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_io_handle_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_io_handle_read_ranges(
+     void )
+{
+	uint8_t first_data[ 2 ];
+	uint8_t second_data[ 8 ];
+	uint8_t third_data[ 4 ];
+
+	libexe_range_t ranges[ 4 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_io_handle_t *io_handle    = NULL;
+	int number_of_reads              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          exe_test_io_handle_data1,
+	          512,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The ranges are not sorted by offset and contain an empty range
+	 */
+	ranges[ 0 ].offset = 0x80;
+	ranges[ 0 ].size   = 8;
+	ranges[ 0 ].data   = second_data;
+
+	ranges[ 1 ].offset = 0;
+	ranges[ 1 ].size   = 2;
+	ranges[ 1 ].data   = first_data;
+
+	ranges[ 2 ].offset = 0x1d8;
+	ranges[ 2 ].size   = 4;
+	ranges[ 2 ].data   = third_data;
+
+	ranges[ 3 ].offset = 0x100;
+	ranges[ 3 ].size   = 0;
+	ranges[ 3 ].data   = NULL;
+
+	/* Test regular cases
+	 */
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          ranges,
+	          4,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The nearby ranges are merged into a single read
+	 */
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 1 );
+
+	result = memory_compare(
+	          first_data,
+	          &( exe_test_io_handle_data1[ 0 ] ),
+	          2 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          second_data,
+	          &( exe_test_io_handle_data1[ 0x80 ] ),
+	          8 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          third_data,
+	          &( exe_test_io_handle_data1[ 0x1d8 ] ),
+	          4 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A single range is read directly
+	 */
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          &( ranges[ 0 ] ),
+	          1,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 1 );
+
+	/* The ranges are copied directly from the file data without reads
+	 */
+	io_handle->file_data      = exe_test_io_handle_data1;
+	io_handle->file_data_size = 512;
+
+	memory_set(
+	 third_data,
+	 0,
+	 4 );
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          ranges,
+	          4,
+	          &number_of_reads,
+	          &error );
+
+	io_handle->file_data      = NULL;
+	io_handle->file_data_size = 0;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_reads",
+	 number_of_reads,
+	 0 );
+
+	result = memory_compare(
+	          third_data,
+	          &( exe_test_io_handle_data1[ 0x1d8 ] ),
+	          4 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_io_handle_read_ranges(
+	          NULL,
+	          file_io_handle,
+	          ranges,
+	          4,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          4,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          ranges,
+	          0,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          ranges,
+	          4,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a range that is not stored in the file
+	 */
+	ranges[ 2 ].offset = 0x1fe;
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          &( ranges[ 2 ] ),
+	          1,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a range with a negative offset
+	 */
+	ranges[ 2 ].offset = -1;
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          &( ranges[ 2 ] ),
+	          1,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a range without data
+	 */
+	ranges[ 2 ].offset = 0x1d8;
+	ranges[ 2 ].data   = NULL;
+
+	result = libexe_io_handle_read_ranges(
+	          io_handle,
+	          file_io_handle,
+	          &( ranges[ 2 ] ),
+	          1,
+	          &number_of_reads,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libexe_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_initialize",
+	 exe_test_io_handle_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_free",
+	 exe_test_io_handle_free );
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_clear",
+	 exe_test_io_handle_clear );
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_read_header_data",
+	 exe_test_io_handle_read_header_data );
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_read_file_header",
+	 exe_test_io_handle_read_file_header );
+
+	/* TODO: add tests for libexe_io_handle_read_extended_header */
+
+	/* TODO: add tests for libexe_io_handle_read_le_header */
+
+	/* TODO: add tests for libexe_io_handle_read_ne_header */
+
+	/* TODO: add tests for libexe_io_handle_read_pe_header */
+
+	EXE_TEST_RUN(
+	 "libexe_io_handle_read_ranges",
+	 exe_test_io_handle_read_ranges );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
@@ -0,0 +1,655 @@
+/*
+ * Library ordinal names functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_ordinal_names.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_ordinal_names_get_module_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_ordinal_names_get_module_name_hash(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint32_t module_name_hash = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "module_name_hash",
+	 module_name_hash,
+	 (uint32_t) 0xf730d303UL );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "WS2_32.DLL",
+	          10,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "module_name_hash",
+	 module_name_hash,
+	 (uint32_t) 0xf730d303UL );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "WSock32.dll",
+	          11,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "module_name_hash",
+	 module_name_hash,
+	 (uint32_t) 0x309f7c1dUL );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "oleaut32.dll",
+	          12,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "module_name_hash",
+	 module_name_hash,
+	 (uint32_t) 0x733d6d1eUL );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "",
+	          0,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "module_name_hash",
+	 module_name_hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	/* Test error cases
+	 */
+	result = libexe_ordinal_names_get_module_name_hash(
+	          NULL,
+	          10,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "ws2_32.dll",
+	          (size_t) SSIZE_MAX + 1,
+	          &module_name_hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_ordinal_names_get_module_name_hash(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_ordinal_names_get_key_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_ordinal_names_get_key_hash(
+     void )
+{
+	uint32_t key_hash = 0;
+
+	/* Test regular cases
+	 */
+	key_hash = libexe_ordinal_names_get_key_hash(
+	            0,
+	            0,
+	            0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hash",
+	 key_hash,
+	 (uint32_t) 0 );
+
+	key_hash = libexe_ordinal_names_get_key_hash(
+	            0xf730d303UL,
+	            115,
+	            0 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hash",
+	 key_hash,
+	 (uint32_t) 0x8b3d1697UL );
+
+	key_hash = libexe_ordinal_names_get_key_hash(
+	            0xf730d303UL,
+	            115,
+	            1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "key_hash",
+	 key_hash,
+	 (uint32_t) 0x0e1cf2daUL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libexe_ordinal_names_get_name function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_ordinal_names_get_name(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	const char *name         = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          0xf730d303UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "WSAStartup",
+	          11 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "wsock32.dll",
+	          11,
+	          0x309f7c1dUL,
+	          23,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "socket",
+	          7 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          0xf730d303UL,
+	          500,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "WEP",
+	          4 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "oleaut32.dll",
+	          12,
+	          0x733d6d1eUL,
+	          2,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "SysAllocString",
+	          15 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "oleaut32.dll",
+	          12,
+	          0x733d6d1eUL,
+	          443,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	result = memory_compare(
+	          name,
+	          "UnRegisterTypeLibForUser",
+	          25 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test ordinals and modules without a name
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          0xf730d303UL,
+	          100,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          0xf730d303UL,
+	          0,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "oleaut32.dll",
+	          12,
+	          0x733d6d1eUL,
+	          302,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "kernel32.dll",
+	          12,
+	          0xa3e6f6c3UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a module name with the same hash as ws2_32.dll
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "auxcwma.dll",
+	          11,
+	          0xf730d303UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a module name that is a prefix of ws2_32.dll
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          6,
+	          0xf730d303UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the module name is compared case insensitive
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "WS2_32.DLL",
+	          10,
+	          0xf730d303UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_ordinal_names_get_name(
+	          (uint8_t *) "ws2_32.dll",
+	          10,
+	          0xf730d303UL,
+	          115,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_ordinal_names_get_name(
+	          NULL,
+	          10,
+	          0xf730d303UL,
+	          115,
+	          &name,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_ordinal_names_get_module_name_hash",
+	 exe_test_ordinal_names_get_module_name_hash );
+
+	EXE_TEST_RUN(
+	 "libexe_ordinal_names_get_key_hash",
+	 exe_test_ordinal_names_get_key_hash );
+
+	EXE_TEST_RUN(
+	 "libexe_ordinal_names_get_name",
+	 exe_test_ordinal_names_get_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1148 @@
+/*
+ * Library rva_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_libcdata.h"
+#include "../libexe/libexe_rva_index.h"
+#include "../libexe/libexe_section_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* The test sections: virtual address, virtual size, data offset, data size
+ */
+uint32_t exe_test_rva_index_sections[ 5 ][ 4 ] = {
+	{ 0x00001000UL, 0x00001800UL, 0x00000400UL, 0x00002000UL },
+	{ 0x00002000UL, 0x00000500UL, 0x00002400UL, 0x00000200UL },
+	{ 0x00002000UL, 0x00000100UL, 0x00003000UL, 0x00000100UL },
+	{ 0x00004000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL },
+	{ 0x00003000UL, 0x00001000UL, 0x00002600UL, 0x00001000UL } };
+
+/* Creates a sections array for testing
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_rva_index_sections_array_initialize(
+     libcdata_array_t **sections_array,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	int entry_index                                 = 0;
+	int section_index                               = 0;
+
+	if( libcdata_array_initialize(
+	     sections_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < 5;
+	     section_index++ )
+	{
+		if( libexe_section_descriptor_initialize(
+		     &section_descriptor,
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		section_descriptor->virtual_address = exe_test_rva_index_sections[ section_index ][ 0 ];
+		section_descriptor->virtual_size    = exe_test_rva_index_sections[ section_index ][ 1 ];
+
+		if( libexe_section_descriptor_set_data_range(
+		     section_descriptor,
+		     (off64_t) exe_test_rva_index_sections[ section_index ][ 2 ],
+		     (size64_t) exe_test_rva_index_sections[ section_index ][ 3 ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     *sections_array,
+		     &entry_index,
+		     (intptr_t *) section_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		section_descriptor = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( section_descriptor != NULL )
+	{
+		libexe_section_descriptor_free(
+		 &section_descriptor,
+		 NULL );
+	}
+	if( *sections_array != NULL )
+	{
+		libcdata_array_free(
+		 sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libexe_rva_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_rva_index_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libexe_rva_index_t *rva_index   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_rva_index_initialize(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "rva_index",
+	 rva_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_free(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "rva_index",
+	 rva_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_rva_index_initialize(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	rva_index = (libexe_rva_index_t *) 0x12345678UL;
+
+	result = libexe_rva_index_initialize(
+	          &rva_index,
+	          &error );
+
+	rva_index = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_rva_index_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_rva_index_initialize(
+		          &rva_index,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( rva_index != NULL )
+			{
+				libexe_rva_index_free(
+				 &rva_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "rva_index",
+			 rva_index );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_rva_index_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_rva_index_initialize(
+		          &rva_index,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( rva_index != NULL )
+			{
+				libexe_rva_index_free(
+				 &rva_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "rva_index",
+			 rva_index );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rva_index != NULL )
+	{
+		libexe_rva_index_free(
+		 &rva_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_rva_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_rva_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_rva_index_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_rva_index_set_sections function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_rva_index_set_sections(
+     void )
+{
+	libcdata_array_t *sections_array = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_rva_index_t *rva_index    = NULL;
+	int number_of_allocated_entries  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_rva_index_sections_array_initialize(
+	          &sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "sections_array",
+	 sections_array );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_initialize(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "rva_index",
+	 rva_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_rva_index_set_sections(
+	          rva_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The section with a duplicate virtual address and the empty section are not indexed
+	 */
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->number_of_entries",
+	 rva_index->number_of_entries,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "rva_index->entries[ 0 ].virtual_address",
+	 rva_index->entries[ 0 ].virtual_address,
+	 (uint32_t) 0x00001000UL );
+
+	/* The first section is truncated at the start of the second section
+	 */
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "rva_index->entries[ 0 ].virtual_size",
+	 rva_index->entries[ 0 ].virtual_size,
+	 (uint32_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "rva_index->entries[ 0 ].data_size",
+	 rva_index->entries[ 0 ].data_size,
+	 (uint32_t) 0x00001000UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->entries[ 1 ].section_index",
+	 rva_index->entries[ 1 ].section_index,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->entries[ 2 ].section_index",
+	 rva_index->entries[ 2 ].section_index,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libexe_rva_index_set_sections(
+	          NULL,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_rva_index_set_sections(
+	          rva_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test set sections after clear reuses the allocated entries
+	 */
+	number_of_allocated_entries = rva_index->number_of_allocated_entries;
+
+	result = libexe_rva_index_clear(
+	          rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->number_of_entries",
+	 rva_index->number_of_entries,
+	 0 );
+
+	result = libexe_rva_index_set_sections(
+	          rva_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->number_of_entries",
+	 rva_index->number_of_entries,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "rva_index->number_of_allocated_entries",
+	 rva_index->number_of_allocated_entries,
+	 number_of_allocated_entries );
+
+	result = libexe_rva_index_clear(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_rva_index_free(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "rva_index",
+	 rva_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rva_index != NULL )
+	{
+		libexe_rva_index_free(
+		 &rva_index,
+		 NULL );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_rva_index_get_offset_by_rva function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_rva_index_get_offset_by_rva(
+     void )
+{
+	/* The test RVAs: RVA, expected result, expected offset
+	 */
+	uint32_t test_values[ 10 ][ 3 ] = {
+		{ 0x00000fffUL, 0, 0x00000000UL },
+		{ 0x00001000UL, 1, 0x00000400UL },
+		{ 0x00001fffUL, 1, 0x000013ffUL },
+		{ 0x00002000UL, 1, 0x00002400UL },
+		{ 0x000021ffUL, 1, 0x000025ffUL },
+		{ 0x00002200UL, 0, 0x00000000UL },
+		{ 0x00002500UL, 0, 0x00000000UL },
+		{ 0x00003010UL, 1, 0x00002610UL },
+		{ 0x00004000UL, 0, 0x00000000UL },
+		{ 0xffffffffUL, 0, 0x00000000UL } };
+
+	libcdata_array_t *sections_array = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_rva_index_t *rva_index    = NULL;
+	off64_t offset                   = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_rva_index_sections_array_initialize(
+	          &sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_initialize(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_set_sections(
+	          rva_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 10;
+	     test_index++ )
+	{
+		result = libexe_rva_index_get_offset_by_rva(
+		          rva_index,
+		          test_values[ test_index ][ 0 ],
+		          &offset,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 (int) test_values[ test_index ][ 1 ] );
+
+		EXE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) test_values[ test_index ][ 2 ] );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_rva_index_get_offset_by_rva(
+	          NULL,
+	          0x00001000UL,
+	          &offset,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_rva_index_get_offset_by_rva(
+	          rva_index,
+	          0x00001000UL,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_rva_index_free(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rva_index != NULL )
+	{
+		libexe_rva_index_free(
+		 &rva_index,
+		 NULL );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_rva_index_get_offsets_by_rvas function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_rva_index_get_offsets_by_rvas(
+     void )
+{
+	/* The test RVAs with the expected status and offset
+	 */
+	uint32_t test_rvas[ 10 ] = {
+		0x00000fffUL, 0x00001000UL, 0x00001fffUL, 0x00002000UL, 0x000021ffUL,
+		0x00002200UL, 0x00002500UL, 0x00003010UL, 0x00004000UL, 0xffffffffUL };
+
+	uint8_t expected_status[ 10 ] = {
+		0, 1, 1, 1, 1, 0, 0, 1, 0, 0 };
+
+	off64_t expected_offsets[ 10 ] = {
+		0x00000000UL, 0x00000400UL, 0x000013ffUL, 0x00002400UL, 0x000025ffUL,
+		0x00000000UL, 0x00000000UL, 0x00002610UL, 0x00000000UL, 0x00000000UL };
+
+	libcdata_array_t *sections_array = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_rva_index_t *rva_index    = NULL;
+	off64_t offsets[ 10 ];
+	uint8_t status[ 10 ];
+	int function_index               = 0;
+	int result                       = 0;
+	int test_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_rva_index_sections_array_initialize(
+	          &sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_initialize(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_rva_index_set_sections(
+	          rva_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The scan and search variants must give the same results, an odd number
+	 * of RVAs is used to include the part that is not handled by the vector code
+	 */
+	for( function_index = 0;
+	     function_index < 3;
+	     function_index++ )
+	{
+		for( test_index = 0;
+		     test_index < 10;
+		     test_index++ )
+		{
+			offsets[ test_index ] = -1;
+			status[ test_index ]  = 0xff;
+		}
+		if( function_index == 0 )
+		{
+			result = libexe_rva_index_get_offsets_by_rvas(
+			          rva_index,
+			          test_rvas,
+			          9,
+			          offsets,
+			          status,
+			          &error );
+		}
+		else if( function_index == 1 )
+		{
+			result = libexe_rva_index_scan_offsets_by_rvas(
+			          rva_index,
+			          test_rvas,
+			          9,
+			          offsets,
+			          status,
+			          &error );
+		}
+		else
+		{
+			result = libexe_rva_index_search_offsets_by_rvas(
+			          rva_index,
+			          test_rvas,
+			          9,
+			          offsets,
+			          status,
+			          &error );
+		}
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( test_index = 0;
+		     test_index < 9;
+		     test_index++ )
+		{
+			EXE_TEST_ASSERT_EQUAL_UINT8(
+			 "status",
+			 status[ test_index ],
+			 expected_status[ test_index ] );
+
+			EXE_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 (int64_t) offsets[ test_index ],
+			 (int64_t) expected_offsets[ test_index ] );
+		}
+		EXE_TEST_ASSERT_EQUAL_UINT8(
+		 "status",
+		 status[ 9 ],
+		 0xff );
+	}
+	/* Test without status
+	 */
+	result = libexe_rva_index_get_offsets_by_rvas(
+	          rva_index,
+	          test_rvas,
+	          10,
+	          offsets,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offsets[ 7 ],
+	 (int64_t) expected_offsets[ 7 ] );
+
+	/* Test error cases
+	 */
+	result = libexe_rva_index_get_offsets_by_rvas(
+	          NULL,
+	          test_rvas,
+	          10,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_rva_index_get_offsets_by_rvas(
+	          rva_index,
+	          NULL,
+	          10,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_rva_index_get_offsets_by_rvas(
+	          rva_index,
+	          test_rvas,
+	          (size_t) SSIZE_MAX,
+	          offsets,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_rva_index_get_offsets_by_rvas(
+	          rva_index,
+	          test_rvas,
+	          10,
+	          NULL,
+	          status,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_rva_index_free(
+	          &rva_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rva_index != NULL )
+	{
+		libexe_rva_index_free(
+		 &rva_index,
+		 NULL );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_rva_index_initialize",
+	 exe_test_rva_index_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_rva_index_free",
+	 exe_test_rva_index_free );
+
+	/* TODO: add tests for libexe_rva_index_entry_compare */
+
+	EXE_TEST_RUN(
+	 "libexe_rva_index_set_sections",
+	 exe_test_rva_index_set_sections );
+
+	/* TODO: add tests for libexe_rva_index_get_entry_by_rva */
+
+	EXE_TEST_RUN(
+	 "libexe_rva_index_get_offset_by_rva",
+	 exe_test_rva_index_get_offset_by_rva );
+
+	EXE_TEST_RUN(
+	 "libexe_rva_index_get_offsets_by_rvas",
+	 exe_test_rva_index_get_offsets_by_rvas );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
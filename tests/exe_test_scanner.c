@@ -0,0 +1,1190 @@
+/*
+ * Library scanner type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_getopt.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libcthreads.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_scanner.h"
+#include "../libexe/libexe_scanner_worker.h"
+#include "../libexe/libexe_definitions.h"
+
+#define EXE_TEST_SCANNER_NUMBER_OF_ENTRIES	16
+#define EXE_TEST_SCANNER_MISSING_ENTRY_INDEX	5
+
+typedef struct exe_test_scanner_callback_values exe_test_scanner_callback_values_t;
+
+struct exe_test_scanner_callback_values
+{
+	/* The number of files that were opened
+	 */
+	int number_of_opened_files;
+
+	/* The number of files that could not be opened
+	 */
+	int number_of_missing_files;
+
+	/* The number of files that could not be read
+	 */
+	int number_of_invalid_files;
+
+	/* The result returned by the callback function
+	 */
+	int result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the values
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+/* Counts the files passed by the scanner
+ * Callback function for libexe_scanner_scan
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_scanner_callback(
+     const char *filename EXE_TEST_ATTRIBUTE_UNUSED,
+     libexe_file_t *file,
+     exe_test_scanner_callback_values_t *callback_values )
+{
+	int number_of_sections = 0;
+	int result             = 0;
+
+	EXE_TEST_UNREFERENCED_PARAMETER( filename )
+
+	if( callback_values == NULL )
+	{
+		return( -1 );
+	}
+	if( file != NULL )
+	{
+		result = libexe_file_get_number_of_sections(
+		          file,
+		          &number_of_sections,
+		          NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     callback_values->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	if( file == NULL )
+	{
+		callback_values->number_of_missing_files += 1;
+	}
+	else if( result != 1 )
+	{
+		callback_values->number_of_invalid_files += 1;
+	}
+	else
+	{
+		callback_values->number_of_opened_files += 1;
+	}
+	result = callback_values->result;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     callback_values->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Tests the libexe_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libexe_scanner_t *scanner       = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_scanner_free(
+	          &scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_scanner_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scanner = (libexe_scanner_t *) 0x12345678UL;
+
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          4,
+	          &error );
+
+	scanner = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          LIBEXE_MAXIMUM_SCANNER_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_scanner_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_scanner_initialize(
+		          &scanner,
+		          4,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( scanner != NULL )
+			{
+				libexe_scanner_free(
+				 &scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "scanner",
+			 scanner );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_scanner_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_scanner_initialize(
+		          &scanner,
+		          4,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( scanner != NULL )
+			{
+				libexe_scanner_free(
+				 &scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "scanner",
+			 scanner );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libexe_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_scanner_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_scanner_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_scanner_scan(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	exe_test_scanner_callback_values_t callback_values;
+
+	libcerror_error_t *error  = NULL;
+	libexe_scanner_t *scanner = NULL;
+	int entry_index           = 0;
+	int number_of_entries     = 0;
+	int number_of_threads     = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &callback_values,
+	 0,
+	 sizeof( exe_test_scanner_callback_values_t ) );
+
+	result = exe_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libcthreads_mutex_initialize(
+	          &( callback_values.mutex ),
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+	/* Test regular cases with a single thread and with more threads than entries
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 32;
+	     number_of_threads *= 4 )
+	{
+		result = libexe_scanner_initialize(
+		          &scanner,
+		          number_of_threads,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The file is appended multiple times with a file that does not exist in between
+		 */
+		for( entry_index = 0;
+		     entry_index < EXE_TEST_SCANNER_NUMBER_OF_ENTRIES;
+		     entry_index++ )
+		{
+			if( entry_index == EXE_TEST_SCANNER_MISSING_ENTRY_INDEX )
+			{
+				result = libexe_scanner_append_filename(
+				          scanner,
+				          "exe_test_scanner_missing.exe",
+				          &error );
+			}
+			else
+			{
+				result = libexe_scanner_append_filename(
+				          scanner,
+				          narrow_source,
+				          &error );
+			}
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libexe_scanner_get_number_of_entries(
+		          scanner,
+		          &number_of_entries,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 EXE_TEST_SCANNER_NUMBER_OF_ENTRIES );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		callback_values.number_of_opened_files  = 0;
+		callback_values.number_of_missing_files = 0;
+		callback_values.number_of_invalid_files = 0;
+		callback_values.result                  = 1;
+
+		result = libexe_scanner_scan(
+		          scanner,
+		          LIBEXE_OPEN_READ,
+		          (int (*)(const char *, libexe_file_t *, void *)) &exe_test_scanner_callback,
+		          (void *) &callback_values,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "callback_values.number_of_opened_files",
+		 callback_values.number_of_opened_files,
+		 EXE_TEST_SCANNER_NUMBER_OF_ENTRIES - 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "callback_values.number_of_missing_files",
+		 callback_values.number_of_missing_files,
+		 1 );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "callback_values.number_of_invalid_files",
+		 callback_values.number_of_invalid_files,
+		 0 );
+
+		/* Test a callback function that aborts the scan
+		 */
+		callback_values.number_of_opened_files  = 0;
+		callback_values.number_of_missing_files = 0;
+		callback_values.result                  = -1;
+
+		result = libexe_scanner_scan(
+		          scanner,
+		          LIBEXE_OPEN_READ,
+		          (int (*)(const char *, libexe_file_t *, void *)) &exe_test_scanner_callback,
+		          (void *) &callback_values,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Without other threads the scan stops directly after the first entry
+		 */
+		if( number_of_threads == 1 )
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "callback_values.number_of_opened_files",
+			 callback_values.number_of_opened_files,
+			 1 );
+		}
+
+		result = libexe_scanner_free(
+		          &scanner,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_scanner_scan(
+	          NULL,
+	          LIBEXE_OPEN_READ,
+	          (int (*)(const char *, libexe_file_t *, void *)) &exe_test_scanner_callback,
+	          (void *) &callback_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_scan(
+	          scanner,
+	          LIBEXE_OPEN_WRITE,
+	          (int (*)(const char *, libexe_file_t *, void *)) &exe_test_scanner_callback,
+	          (void *) &callback_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_scan(
+	          scanner,
+	          LIBEXE_OPEN_READ,
+	          NULL,
+	          (void *) &callback_values,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_append_filename(
+	          scanner,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_scanner_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_scanner_free(
+	          &scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libcthreads_mutex_free(
+	          &( callback_values.mutex ),
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libexe_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( callback_values.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( callback_values.mutex ),
+		 NULL );
+	}
+#endif
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_internal_scanner_steal_entries and libexe_internal_scanner_abort_workers functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_internal_scanner_abort_workers(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libexe_internal_scanner_t *internal_scanner = NULL;
+	libexe_scanner_t *scanner                   = NULL;
+	int number_of_queued_entries                = 0;
+	int result                                  = 0;
+	int worker_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_scanner_initialize(
+	          &scanner,
+	          2,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner = (libexe_internal_scanner_t *) scanner;
+
+	internal_scanner->workers = (libexe_scanner_worker_t **) memory_allocate(
+	                                                          sizeof( libexe_scanner_worker_t * ) * 2 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_scanner->workers",
+	 internal_scanner->workers );
+
+	internal_scanner->workers[ 0 ]      = NULL;
+	internal_scanner->workers[ 1 ]      = NULL;
+	internal_scanner->number_of_workers = 2;
+
+	for( worker_index = 0;
+	     worker_index < 2;
+	     worker_index++ )
+	{
+		result = libexe_scanner_worker_initialize(
+		          &( internal_scanner->workers[ worker_index ] ),
+		          worker_index,
+		          (intptr_t *) internal_scanner,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libexe_scanner_worker_set_entries(
+	          internal_scanner->workers[ 1 ],
+	          0,
+	          8,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_internal_scanner_steal_entries(
+	          internal_scanner,
+	          internal_scanner->workers[ 0 ],
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_scanner_worker_get_number_of_queued_entries(
+	          internal_scanner->workers[ 0 ],
+	          &number_of_queued_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_queued_entries",
+	 number_of_queued_entries,
+	 4 );
+
+	result = libexe_internal_scanner_is_aborted(
+	          internal_scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that entries stolen after the scan was aborted are discarded
+	 */
+	result = libexe_scanner_worker_set_entries(
+	          internal_scanner->workers[ 0 ],
+	          0,
+	          0,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_scanner->abort = 1;
+
+	result = libexe_internal_scanner_steal_entries(
+	          internal_scanner,
+	          internal_scanner->workers[ 0 ],
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_scanner_worker_get_number_of_queued_entries(
+	          internal_scanner->workers[ 0 ],
+	          &number_of_queued_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_queued_entries",
+	 number_of_queued_entries,
+	 0 );
+
+	/* Test that a worker of an aborted scan does not scan its queued entries
+	 */
+	result = libexe_scanner_worker_set_entries(
+	          internal_scanner->workers[ 0 ],
+	          0,
+	          4,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_internal_scanner_run_worker(
+	          internal_scanner->workers[ 0 ] );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "internal_scanner->workers[ 0 ]->number_of_scanned_entries",
+	 internal_scanner->workers[ 0 ]->number_of_scanned_entries,
+	 0 );
+
+	internal_scanner->abort = 0;
+
+	result = libexe_internal_scanner_abort_workers(
+	          internal_scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "internal_scanner->abort",
+	 internal_scanner->abort,
+	 1 );
+
+	result = libexe_scanner_worker_get_number_of_queued_entries(
+	          internal_scanner->workers[ 0 ],
+	          &number_of_queued_entries,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_queued_entries",
+	 number_of_queued_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libexe_internal_scanner_is_aborted(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_internal_scanner_steal_entries(
+	          internal_scanner,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_internal_scanner_free_workers(
+	          internal_scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_scanner_free(
+	          &scanner,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_scanner != NULL )
+	{
+		libexe_internal_scanner_free_workers(
+		 internal_scanner,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libexe_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = exe_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	EXE_TEST_RUN(
+	 "libexe_scanner_initialize",
+	 exe_test_scanner_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_scanner_free",
+	 exe_test_scanner_free );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_internal_scanner_abort_workers",
+	 exe_test_internal_scanner_abort_workers );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_scanner_scan",
+		 exe_test_scanner_scan,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -57,6 +57,7 @@ int exe_test_section_descriptor_initialize(
 	 */
 	result = libexe_section_descriptor_initialize(
 	          &section_descriptor,
+	          NULL,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -92,6 +93,7 @@ int exe_test_section_descriptor_initialize(
 	/* Test error cases
 	 */
 	result = libexe_section_descriptor_initialize(
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -111,6 +113,7 @@ int exe_test_section_descriptor_initialize(
 
 	result = libexe_section_descriptor_initialize(
 	          &section_descriptor,
+	          NULL,
 	          &error );
 
 	section_descriptor = NULL;
@@ -139,6 +142,7 @@ int exe_test_section_descriptor_initialize(
 
 		result = libexe_section_descriptor_initialize(
 		          &section_descriptor,
+		          NULL,
 		          &error );
 
 		if( exe_test_malloc_attempts_before_fail != -1 )
@@ -181,6 +185,7 @@ int exe_test_section_descriptor_initialize(
 
 		result = libexe_section_descriptor_initialize(
 		          &section_descriptor,
+		          NULL,
 		          &error );
 
 		if( exe_test_memset_attempts_before_fail != -1 )
@@ -270,6 +275,105 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libexe_section_descriptor_free_readahead_data function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_descriptor_free_readahead_data(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_section_descriptor_initialize(
+	          &section_descriptor,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section_descriptor",
+	 section_descriptor );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_section_descriptor_free_readahead_data(
+	          section_descriptor,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_section_descriptor_free_readahead_data(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_section_descriptor_free(
+	          &section_descriptor,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section_descriptor",
+	 section_descriptor );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section_descriptor != NULL )
+	{
+		libexe_section_descriptor_free(
+		 &section_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libexe_section_descriptor_get_data_size function
  * Returns 1 if successful or 0 if not
  */
@@ -285,6 +389,7 @@ int exe_test_section_descriptor_get_data_size(
 	 */
 	result = libexe_section_descriptor_initialize(
 	          &section_descriptor,
+	          NULL,
 	          &error );
 
 	EXE_TEST_ASSERT_EQUAL_INT(
@@ -388,6 +493,139 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libexe_section_descriptor_seek_segment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_descriptor_seek_segment_offset(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	off64_t offset                                  = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_section_descriptor_initialize(
+	          &section_descriptor,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section_descriptor",
+	 section_descriptor );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libexe_section_descriptor_seek_segment_offset(
+	          section_descriptor,
+	          NULL,
+	          0,
+	          0,
+	          1024,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1024 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "section_descriptor->segment_offset",
+	 (int64_t) section_descriptor->segment_offset,
+	 (int64_t) 1024 );
+
+	/* Test error cases
+	 */
+	offset = libexe_section_descriptor_seek_segment_offset(
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          1024,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libexe_section_descriptor_seek_segment_offset(
+	          section_descriptor,
+	          NULL,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_section_descriptor_free(
+	          &section_descriptor,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section_descriptor",
+	 section_descriptor );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section_descriptor != NULL )
+	{
+		libexe_section_descriptor_free(
+		 &section_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
 /* The main program
@@ -415,6 +653,10 @@ int main(
 	 "libexe_section_descriptor_free",
 	 exe_test_section_descriptor_free );
 
+	EXE_TEST_RUN(
+	 "libexe_section_descriptor_free_readahead_data",
+	 exe_test_section_descriptor_free_readahead_data );
+
 /* TODO implement
 	EXE_TEST_RUN(
 	 "libexe_section_descriptor_get_data_size",
@@ -425,6 +667,12 @@ int main(
 
 	/* TODO: add tests for libexe_section_descriptor_set_data_range */
 
+	/* TODO: add tests for libexe_section_descriptor_read_segment_data */
+
+	EXE_TEST_RUN(
+	 "libexe_section_descriptor_seek_segment_offset",
+	 exe_test_section_descriptor_seek_segment_offset );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
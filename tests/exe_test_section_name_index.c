@@ -0,0 +1,1115 @@
+/*
+ * Library section_name_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_libcdata.h"
+#include "../libexe/libexe_section_descriptor.h"
+#include "../libexe/libexe_section_name_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* The test section names
+ */
+char *exe_test_section_name_index_section_names[ 7 ] = {
+	".text", ".data", ".text", "", "UPX0", "12345678", ".text" };
+
+/* Creates a sections array for testing
+ * Returns 1 if successful or -1 on error
+ */
+int exe_test_section_name_index_sections_array_initialize(
+     libcdata_array_t **sections_array,
+     libcerror_error_t **error )
+{
+	libexe_section_descriptor_t *section_descriptor = NULL;
+	size_t name_length                              = 0;
+	int entry_index                                 = 0;
+	int section_index                               = 0;
+
+	if( libcdata_array_initialize(
+	     sections_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( section_index = 0;
+	     section_index < 7;
+	     section_index++ )
+	{
+		if( libexe_section_descriptor_initialize(
+		     &section_descriptor,
+		     NULL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		name_length = narrow_string_length(
+		               exe_test_section_name_index_section_names[ section_index ] );
+
+		if( narrow_string_copy(
+		     section_descriptor->name,
+		     exe_test_section_name_index_section_names[ section_index ],
+		     name_length ) == NULL )
+		{
+			goto on_error;
+		}
+		section_descriptor->name[ name_length ] = 0;
+
+		if( name_length > 0 )
+		{
+			section_descriptor->name_size = name_length + 1;
+		}
+		if( libcdata_array_append_entry(
+		     *sections_array,
+		     &entry_index,
+		     (intptr_t *) section_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		section_descriptor = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( section_descriptor != NULL )
+	{
+		libexe_section_descriptor_free(
+		 &section_descriptor,
+		 NULL );
+	}
+	if( *sections_array != NULL )
+	{
+		libcdata_array_free(
+		 sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libexe_section_name_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_name_index_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libexe_section_name_index_t *section_name_index = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_section_name_index_initialize(
+	          &section_name_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "section_name_index",
+	 section_name_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_free(
+	          &section_name_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "section_name_index",
+	 section_name_index );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_section_name_index_initialize(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	section_name_index = (libexe_section_name_index_t *) 0x12345678UL;
+
+	result = libexe_section_name_index_initialize(
+	          &section_name_index,
+	          &error );
+
+	section_name_index = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_section_name_index_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_section_name_index_initialize(
+		          &section_name_index,
+		          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( section_name_index != NULL )
+			{
+				libexe_section_name_index_free(
+				 &section_name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "section_name_index",
+			 section_name_index );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_section_name_index_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_section_name_index_initialize(
+		          &section_name_index,
+		          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( section_name_index != NULL )
+			{
+				libexe_section_name_index_free(
+				 &section_name_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "section_name_index",
+			 section_name_index );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section_name_index != NULL )
+	{
+		libexe_section_name_index_free(
+		 &section_name_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_section_name_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_name_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_section_name_index_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_section_name_index_get_name_value function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_name_index_get_name_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t name_value      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_section_name_index_get_name_value(
+	          ".text",
+	          5,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "name_value",
+	 name_value,
+	 (uint64_t) 0x000000747865742eULL );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Names that cannot be a section name
+	 */
+	result = libexe_section_name_index_get_name_value(
+	          ".text",
+	          0,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_name_value(
+	          "123456789",
+	          9,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_name_value(
+	          ".text",
+	          6,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_section_name_index_get_name_value(
+	          NULL,
+	          5,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_name_value(
+	          ".text",
+	          5,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_section_name_index_get_section_name_value function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_name_index_get_section_name_value(
+     void )
+{
+	libcdata_array_t *sections_array = NULL;
+	libcerror_error_t *error         = NULL;
+	uint64_t name_value              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_section_name_index_sections_array_initialize(
+	          &sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_section_name_index_get_section_name_value(
+	          sections_array,
+	          0,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "name_value",
+	 name_value,
+	 (uint64_t) 0x747865742eULL );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a section without a name
+	 */
+	result = libexe_section_name_index_get_section_name_value(
+	          sections_array,
+	          3,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_section_name_index_get_section_name_value(
+	          NULL,
+	          0,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_section_name_value(
+	          sections_array,
+	          -1,
+	          &name_value,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_section_name_index_set_sections, libexe_section_name_index_get_number_of_sections_by_name
+ * and libexe_section_name_index_get_section_index_by_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_section_name_index_get_section_index_by_name(
+     void )
+{
+	libcdata_array_t *sections_array                = NULL;
+	libcerror_error_t *error                        = NULL;
+	libexe_section_name_index_t *section_name_index = NULL;
+	int number_of_sections                          = 0;
+	int result                                      = 0;
+	int section_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = exe_test_section_name_index_sections_array_initialize(
+	          &sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_initialize(
+	          &section_name_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test lookups without sections
+	 */
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_set_sections(
+	          section_name_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_section_name_index_get_number_of_sections_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sections",
+	 number_of_sections,
+	 3 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_index",
+	 section_index,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          2,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_index",
+	 section_index,
+	 6 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          3,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          "12345678",
+	          8,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_index",
+	 section_index,
+	 5 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A prefix of a section name does not match
+	 */
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          "UPX",
+	          3,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sections without a name are not indexed
+	 */
+	result = libexe_section_name_index_get_number_of_sections_by_name(
+	          section_name_index,
+	          "",
+	          0,
+	          &number_of_sections,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sections",
+	 number_of_sections,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test lookups after clear and set sections again
+	 */
+	result = libexe_section_name_index_clear(
+	          section_name_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_set_sections(
+	          section_name_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          2,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "section_index",
+	 section_index,
+	 6 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_section_name_index_set_sections(
+	          section_name_index,
+	          sections_array,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          NULL,
+	          ".text",
+	          5,
+	          0,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          -1,
+	          &section_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_section_index_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          0,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_section_name_index_get_number_of_sections_by_name(
+	          section_name_index,
+	          ".text",
+	          5,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_section_name_index_free(
+	          &section_name_index,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &sections_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( section_name_index != NULL )
+	{
+		libexe_section_name_index_free(
+		 &section_name_index,
+		 NULL );
+	}
+	if( sections_array != NULL )
+	{
+		libcdata_array_free(
+		 &sections_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libexe_section_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_section_name_index_initialize",
+	 exe_test_section_name_index_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_section_name_index_free",
+	 exe_test_section_name_index_free );
+
+	EXE_TEST_RUN(
+	 "libexe_section_name_index_get_name_value",
+	 exe_test_section_name_index_get_name_value );
+
+	EXE_TEST_RUN(
+	 "libexe_section_name_index_get_section_name_value",
+	 exe_test_section_name_index_get_section_name_value );
+
+	/* TODO: add tests for libexe_section_name_index_get_slot_by_name */
+
+	EXE_TEST_RUN(
+	 "libexe_section_name_index_get_section_index_by_name",
+	 exe_test_section_name_index_get_section_index_by_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
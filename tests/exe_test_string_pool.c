@@ -0,0 +1,748 @@
+/*
+ * Library string pool type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+#include "exe_test_unused.h"
+
+#include "../libexe/libexe_definitions.h"
+#include "../libexe/libexe_string_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+/* Tests the libexe_string_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_string_pool_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libexe_string_pool_t *string_pool = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libexe_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_string_pool_initialize(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_pool = (libexe_string_pool_t *) 0x12345678UL;
+
+	result = libexe_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	string_pool = NULL;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EXE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_string_pool_initialize with malloc failing
+		 */
+		exe_test_malloc_attempts_before_fail = test_number;
+
+		result = libexe_string_pool_initialize(
+		          &string_pool,
+			          &error );
+
+		if( exe_test_malloc_attempts_before_fail != -1 )
+		{
+			exe_test_malloc_attempts_before_fail = -1;
+
+			if( string_pool != NULL )
+			{
+				libexe_string_pool_free(
+				 &string_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "string_pool",
+			 string_pool );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libexe_string_pool_initialize with memset failing
+		 */
+		exe_test_memset_attempts_before_fail = test_number;
+
+		result = libexe_string_pool_initialize(
+		          &string_pool,
+			          &error );
+
+		if( exe_test_memset_attempts_before_fail != -1 )
+		{
+			exe_test_memset_attempts_before_fail = -1;
+
+			if( string_pool != NULL )
+			{
+				libexe_string_pool_free(
+				 &string_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			EXE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EXE_TEST_ASSERT_IS_NULL(
+			 "string_pool",
+			 string_pool );
+
+			EXE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EXE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libexe_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_string_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_string_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libexe_string_pool_free(
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_string_pool_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_string_pool_get_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libexe_string_pool_get_hash(
+	          (uint8_t *) "a",
+	          1,
+	          &hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	result = libexe_string_pool_get_hash(
+	          (uint8_t *) "",
+	          0,
+	          &hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	/* Test error cases
+	 */
+	result = libexe_string_pool_get_hash(
+	          NULL,
+	          1,
+	          &hash,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_string_pool_get_hash(
+	          (uint8_t *) "a",
+	          1,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_string_pool_intern function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_string_pool_intern(
+     void )
+{
+	uint8_t large_string[ 5000 ];
+	uint8_t string[ 16 ];
+
+	const char *pooled_strings[ 1000 ];
+
+	libcerror_error_t *error          = NULL;
+	libexe_string_pool_t *string_pool = NULL;
+	const char *pooled_string         = NULL;
+	const char *second_pooled_string  = NULL;
+	int number_of_strings             = 0;
+	int result                        = 0;
+	int string_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libexe_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "pooled_string",
+	 pooled_string );
+
+	result = memory_compare(
+	          pooled_string,
+	          "KERNEL32.dll",
+	          13 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &second_pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "second_pooled_string == pooled_string",
+	 (int) ( second_pooled_string == pooled_string ),
+	 1 );
+
+	/* A prefix of a pooled string is a different string
+	 */
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          (uint8_t *) "KERNEL32",
+	          8,
+	          &second_pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "second_pooled_string == pooled_string",
+	 (int) ( second_pooled_string == pooled_string ),
+	 0 );
+
+	result = libexe_string_pool_get_number_of_strings(
+	          string_pool,
+	          &number_of_strings,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 2 );
+
+	/* Test a string that does not fit in a block
+	 */
+	for( string_index = 0;
+	     string_index < 5000;
+	     string_index++ )
+	{
+		large_string[ string_index ] = (uint8_t) 'A';
+	}
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          large_string,
+	          5000,
+	          &pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "pooled_string[ 5000 ]",
+	 (int) pooled_string[ 5000 ],
+	 0 );
+
+	/* Test growing the slots
+	 */
+	for( string_index = 0;
+	     string_index < 1000;
+	     string_index++ )
+	{
+		string[ 0 ] = (uint8_t) 's';
+		string[ 1 ] = (uint8_t) ( '0' + ( string_index / 100 ) );
+		string[ 2 ] = (uint8_t) ( '0' + ( ( string_index / 10 ) % 10 ) );
+		string[ 3 ] = (uint8_t) ( '0' + ( string_index % 10 ) );
+
+		result = libexe_string_pool_intern(
+		          string_pool,
+		          string,
+		          4,
+		          &( pooled_strings[ string_index ] ),
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+	}
+	for( string_index = 0;
+	     string_index < 1000;
+	     string_index++ )
+	{
+		string[ 0 ] = (uint8_t) 's';
+		string[ 1 ] = (uint8_t) ( '0' + ( string_index / 100 ) );
+		string[ 2 ] = (uint8_t) ( '0' + ( ( string_index / 10 ) % 10 ) );
+		string[ 3 ] = (uint8_t) ( '0' + ( string_index % 10 ) );
+
+		result = libexe_string_pool_intern(
+		          string_pool,
+		          string,
+		          4,
+		          &pooled_string,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "pooled_string == pooled_strings[ string_index ]",
+		 (int) ( pooled_string == pooled_strings[ string_index ] ),
+		 1 );
+	}
+	result = libexe_string_pool_get_number_of_strings(
+	          string_pool,
+	          &number_of_strings,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 1003 );
+
+	/* Test error cases
+	 */
+	result = libexe_string_pool_intern(
+	          NULL,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          &pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          NULL,
+	          12,
+	          &pooled_string,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_string_pool_intern(
+	          string_pool,
+	          (uint8_t *) "KERNEL32.dll",
+	          12,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libexe_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libexe_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EXE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EXE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EXE_TEST_UNREFERENCED_PARAMETER( argc )
+	EXE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+	EXE_TEST_RUN(
+	 "libexe_string_pool_initialize",
+	 exe_test_string_pool_initialize );
+
+	EXE_TEST_RUN(
+	 "libexe_string_pool_free",
+	 exe_test_string_pool_free );
+
+	EXE_TEST_RUN(
+	 "libexe_string_pool_get_hash",
+	 exe_test_string_pool_get_hash );
+
+	EXE_TEST_RUN(
+	 "libexe_string_pool_intern",
+	 exe_test_string_pool_intern );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEXE_DLL_IMPORT ) */
+}
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <narrow_string.h>
 #include <system_string.h>
@@ -46,6 +47,12 @@ int libexe_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBEXE_EXTERN \
+int libexe_check_file_type_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     int *executable_type,
+     libcerror_error_t **error );
+
 #endif /* !defined( LIBEXE_HAVE_BFIO ) */
 
 /* Tests the libexe_get_version function
@@ -713,6 +720,435 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libexe_check_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_check_file_type(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	int executable_type      = 0;
+	int result               = 0;
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = exe_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test check file type
+		 */
+		result = libexe_check_file_type(
+		          narrow_source,
+		          &executable_type,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libexe_check_file_type(
+	          NULL,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_check_file_type(
+	          "",
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( source != NULL )
+	{
+		result = libexe_check_file_type(
+		          narrow_source,
+		          NULL,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_check_file_type_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_check_file_type_file_io_handle(
+     void )
+{
+	uint8_t data[ 8192 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	void *memset_result              = NULL;
+	int executable_type              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 data,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test check file type with empty block
+	 */
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with a MZ executable without an extended header
+	 */
+	data[ 0 ] = (uint8_t) 'M';
+	data[ 1 ] = (uint8_t) 'Z';
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "executable_type",
+	 executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_MZ );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with a NE executable
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( data[ 0x18 ] ),
+	 0x0040 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x3c ] ),
+	 0x00000200UL );
+
+	data[ 0x200 ] = (uint8_t) 'N';
+	data[ 0x201 ] = (uint8_t) 'E';
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "executable_type",
+	 executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_NE );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with a LX executable
+	 */
+	data[ 0x200 ] = (uint8_t) 'L';
+	data[ 0x201 ] = (uint8_t) 'X';
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "executable_type",
+	 executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_LX );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with an unsupported extended header signature
+	 */
+	data[ 0x200 ] = (uint8_t) 'X';
+	data[ 0x201 ] = (uint8_t) 'X';
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with a PE/COFF executable with the extended header
+	 * stored outside the start of the file
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x3c ] ),
+	 0x00001000UL );
+
+	data[ 0x1000 ] = (uint8_t) 'P';
+	data[ 0x1001 ] = (uint8_t) 'E';
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "executable_type",
+	 executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_PE_COFF );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with an extended header offset beyond the end of the file
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x3c ] ),
+	 0x00002000UL );
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_check_file_type_file_io_handle(
+	          NULL,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file type with data too small
+	 */
+	result = exe_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          sizeof( uint8_t ) * 64,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_check_file_type_file_io_handle(
+	          file_io_handle,
+	          &executable_type,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = exe_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -786,6 +1222,15 @@ int main(
 	 exe_test_check_file_signature_file_io_handle,
 	 source );
 
+	EXE_TEST_RUN_WITH_ARGS(
+	 "libexe_check_file_type",
+	 exe_test_check_file_type,
+	 source );
+
+	EXE_TEST_RUN(
+	 "libexe_check_file_type_file_io_handle",
+	 exe_test_check_file_type_file_io_handle );
+
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,843 @@
+/*
+ * Library triage functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "exe_test_functions.h"
+#include "exe_test_getopt.h"
+#include "exe_test_libbfio.h"
+#include "exe_test_libcerror.h"
+#include "exe_test_libexe.h"
+#include "exe_test_macros.h"
+#include "exe_test_memory.h"
+
+#include "../libexe/libexe_triage.h"
+
+/* Data of a PE32 executable header with a PE header at offset 0xb0
+ */
+uint8_t exe_test_triage_data1[ 424 ];
+
+/* Fills the PE32 executable header test data
+ */
+void exe_test_triage_set_data1(
+      void )
+{
+	uint8_t *optional_header_data = NULL;
+
+	memory_set(
+	 exe_test_triage_data1,
+	 0,
+	 424 );
+
+	/* The MZ header
+	 */
+	exe_test_triage_data1[ 0 ] = (uint8_t) 'M';
+	exe_test_triage_data1[ 1 ] = (uint8_t) 'Z';
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0x18 ] ),
+	 0x0040 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( exe_test_triage_data1[ 0x3c ] ),
+	 0x000000b0UL );
+
+	/* The PE and COFF header
+	 */
+	exe_test_triage_data1[ 0xb0 ] = (uint8_t) 'P';
+	exe_test_triage_data1[ 0xb1 ] = (uint8_t) 'E';
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0xb4 ] ),
+	 0x014c );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0xb6 ] ),
+	 3 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( exe_test_triage_data1[ 0xb8 ] ),
+	 0x5f5e1000UL );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0xc4 ] ),
+	 224 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0xc6 ] ),
+	 0x0102 );
+
+	/* The COFF optional header
+	 */
+	optional_header_data = &( exe_test_triage_data1[ 0xc8 ] );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( optional_header_data[ 0 ] ),
+	 0x010b );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 16 ] ),
+	 0x00001234UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 28 ] ),
+	 0x00400000UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 64 ] ),
+	 0x0001d2a3UL );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( optional_header_data[ 68 ] ),
+	 3 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( optional_header_data[ 70 ] ),
+	 0x8140 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 92 ] ),
+	 16 );
+
+	/* The import table data directory
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 104 ] ),
+	 0x00002000UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( optional_header_data[ 108 ] ),
+	 0x00000050UL );
+}
+
+/* Tests the libexe_triage function
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_triage(
+     void )
+{
+	libexe_triage_info_t triage_info;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	exe_test_triage_set_data1();
+
+	/* Test regular cases
+	 */
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          424,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.executable_type",
+	 (int) triage_info.executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_PE_COFF );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.target_architecture_type",
+	 (int) triage_info.target_architecture_type,
+	 0x014c );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.number_of_sections",
+	 (int) triage_info.number_of_sections,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.creation_time",
+	 triage_info.creation_time,
+	 (uint32_t) 0x5f5e1000UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.characteristic_flags",
+	 (int) triage_info.characteristic_flags,
+	 0x0102 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.optional_header_signature",
+	 (int) triage_info.optional_header_signature,
+	 0x010b );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.entry_point",
+	 triage_info.entry_point,
+	 (uint32_t) 0x00001234UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT64(
+	 "triage_info.image_base",
+	 triage_info.image_base,
+	 (uint64_t) 0x00400000UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.checksum",
+	 triage_info.checksum,
+	 (uint32_t) 0x0001d2a3UL );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.subsystem",
+	 (int) triage_info.subsystem,
+	 3 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.dll_characteristic_flags",
+	 (int) triage_info.dll_characteristic_flags,
+	 0x8140 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.number_of_data_directories",
+	 triage_info.number_of_data_directories,
+	 16 );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.data_directory_virtual_addresses[ 1 ]",
+	 triage_info.data_directory_virtual_addresses[ 1 ],
+	 (uint32_t) 0x00002000UL );
+
+	EXE_TEST_ASSERT_EQUAL_UINT32(
+	 "triage_info.data_directory_sizes[ 1 ]",
+	 triage_info.data_directory_sizes[ 1 ],
+	 (uint32_t) 0x00000050UL );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 0 );
+
+	/* Test with data that is too small to contain the MZ header
+	 */
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          32,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 176 );
+
+	/* Test with data that is too small to contain the PE signature
+	 */
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          0xb1,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 0xb2 );
+
+	/* Test with data that is too small to contain the COFF header
+	 */
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          0xc0,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 0xc8 );
+
+	/* Test with data that is too small to contain the COFF optional header
+	 */
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          0x100,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 424 );
+
+	/* Test with an MZ executable without an extended header
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0x18 ] ),
+	 0x001c );
+
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          424,
+	          &triage_info,
+	          &error );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( exe_test_triage_data1[ 0x18 ] ),
+	 0x0040 );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "triage_info.executable_type",
+	 (int) triage_info.executable_type,
+	 LIBEXE_EXECUTABLE_TYPE_MZ );
+
+	/* Test with data that does not contain an executable
+	 */
+	exe_test_triage_data1[ 0 ] = (uint8_t) 'X';
+
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          424,
+	          &triage_info,
+	          &error );
+
+	exe_test_triage_data1[ 0 ] = (uint8_t) 'M';
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EXE_TEST_ASSERT_EQUAL_SIZE(
+	 "triage_info.required_size",
+	 triage_info.required_size,
+	 (size_t) 0 );
+
+	/* Test with an unsupported COFF optional header signature
+	 */
+	exe_test_triage_data1[ 0xc9 ] = 0x03;
+
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          424,
+	          &triage_info,
+	          &error );
+
+	exe_test_triage_data1[ 0xc9 ] = 0x01;
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libexe_triage(
+	          NULL,
+	          424,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libexe_triage(
+	          exe_test_triage_data1,
+	          424,
+	          NULL,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libexe_triage function on a source file
+ * Returns 1 if successful or 0 if not
+ */
+int exe_test_triage_file(
+     const system_character_t *source )
+{
+	libexe_triage_info_t triage_info;
+	uint8_t data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libexe_file_t *file              = NULL;
+	size64_t file_size               = 0;
+	size_t data_size                 = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int number_of_sections           = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Triage the start of the file with a small initial read and
+	 * a second read of the required size if more data is needed
+	 */
+	data_size = 64;
+
+	if( (size64_t) data_size > file_size )
+	{
+		data_size = (size_t) file_size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              0,
+	              &error );
+
+	EXE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) data_size );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_triage(
+	          data,
+	          data_size,
+	          &triage_info,
+	          &error );
+
+	EXE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( ( result == 0 )
+	    && ( triage_info.required_size > data_size )
+	    && ( triage_info.required_size <= 4096 )
+	    && ( (size64_t) triage_info.required_size <= file_size ) )
+	{
+		data_size = triage_info.required_size;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              data_size,
+		              0,
+		              &error );
+
+		EXE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) data_size );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libexe_triage(
+		          data,
+		          data_size,
+		          &triage_info,
+		          &error );
+
+		EXE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( result == 0 )
+	{
+		/* The source is not a PE/COFF executable the library can open
+		 */
+		goto on_close;
+	}
+	/* Compare the triage information with the file
+	 */
+	result = libexe_file_initialize(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libexe_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEXE_OPEN_READ,
+	          NULL );
+
+	if( result == 1 )
+	{
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "triage_info.executable_type",
+		 (int) triage_info.executable_type,
+		 LIBEXE_EXECUTABLE_TYPE_PE_COFF );
+
+		result = libexe_file_get_number_of_sections(
+		          file,
+		          &number_of_sections,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_sections",
+		 number_of_sections,
+		 (int) triage_info.number_of_sections );
+
+		result = libexe_file_close(
+		          file,
+		          &error );
+
+		EXE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EXE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libexe_file_free(
+	          &file,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+on_close:
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EXE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EXE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libexe_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = exe_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	EXE_TEST_RUN(
+	 "libexe_triage",
+	 exe_test_triage );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		EXE_TEST_RUN_WITH_ARGS(
+		 "libexe_triage",
+		 exe_test_triage_file,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
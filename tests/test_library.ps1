@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "coff_header coff_optional_header data_directory_descriptor debug_data error export_table import_table io_handle le_header mz_header ne_header notify section section_descriptor section_io_handle"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "arena block_cache coff_header coff_optional_header data_block data_directory_descriptor debug_data error export_table import_hash import_table io_handle le_header md5 memory_map mz_header ne_header notify ordinal_names rva_index section section_descriptor section_io_handle section_name_index string_pool"
+$LibraryTestsWithInput = "batch file scanner support triage"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1